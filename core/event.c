@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_event
+ * @{
+ *
+ * @file
+ * @brief       Event queue implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#ifdef MODULE_CORE_EVENT
+void event_queue_init(event_queue_t *queue)
+{
+    assert(queue);
+    queue->event_list.next = NULL;
+    event_queue_claim(queue);
+}
+
+void event_queue_claim(event_queue_t *queue)
+{
+    assert(queue);
+    queue->waiter = (thread_t *)sched_active_thread;
+}
+
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    /* an event with a list successor is already queued */
+    if (!event->list_node.next) {
+        clist_rpush(&queue->event_list, &event->list_node);
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    DEBUG("event_post(): posted %p\n", (void *)event);
+    /* the waiter may not be known yet, if the queue was not claimed */
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_cancel(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    clist_remove(&queue->event_list, &event->list_node);
+    event->list_node.next = NULL;
+    irq_restore(state);
+}
+
+event_t *event_get(event_queue_t *queue)
+{
+    unsigned state = irq_disable();
+    event_t *result = (event_t *)clist_lpop(&queue->event_list);
+    if (result) {
+        result->list_node.next = NULL;
+    }
+    irq_restore(state);
+
+    return result;
+}
+
+event_t *event_wait(event_queue_t *queue)
+{
+    assert(queue->waiter == sched_active_thread);
+
+    event_t *result;
+    while ((result = event_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    return result;
+}
+
+void event_loop(event_queue_t *queue)
+{
+    event_t *event;
+
+    while ((event = event_wait(queue))) {
+        DEBUG("event_loop(): handling %p\n", (void *)event);
+        event->handler(event);
+    }
+}
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_CORE_EVENT */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_event Event queue
+ * @ingroup     core
+ * @brief       Lightweight, allocation-less event queue
+ *
+ * An event queue is owned by one thread, which processes the events posted to
+ * it by calling their handler functions. Events can be posted from ISRs and
+ * from any thread.
+ *
+ * Events are intrusive: an event_t is usually embedded into a struct which
+ * carries the event's context. Posting an event which is already queued has
+ * no effect, so an event can not overflow the queue. This makes event queues
+ * the preferred choice over messages if several independent modules are to
+ * share one thread (and thus one stack): a module posts its event instead of
+ * sending a message to its own thread.
+ *
+ * The owner thread is woken up through @ref THREAD_FLAG_EVENT, so this module
+ * depends on @ref core_thread_flags.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event queue API
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+#include "clist.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Static initializer for event queues
+ *
+ * @note    The queue must be claimed by its owner thread with
+ *          event_queue_claim() before events can be waited for.
+ */
+#define EVENT_QUEUE_INIT    { { NULL }, NULL }
+
+/**
+ * @brief   Static initializer for events
+ *
+ * @param[in] _handler  handler function of the event
+ */
+#define EVENT_INIT(_handler)    { { NULL }, (_handler) }
+
+typedef struct event event_t;
+
+/**
+ * @brief   Event handler type definition
+ *
+ * @param[in] event     the event that was processed
+ */
+typedef void (*event_handler_t)(event_t *event);
+
+/**
+ * @brief   Event structure
+ */
+struct event {
+    clist_node_t list_node;     /**< event queue list entry */
+    event_handler_t handler;    /**< pointer to event handler function */
+};
+
+/**
+ * @brief   Event queue structure
+ */
+typedef struct {
+    clist_node_t event_list;    /**< list of queued events */
+    thread_t *waiter;           /**< thread owning the event queue */
+} event_queue_t;
+
+/**
+ * @brief   Initialize an event queue and claim it for the calling thread
+ *
+ * @param[out] queue    event queue object to initialize
+ */
+void event_queue_init(event_queue_t *queue);
+
+/**
+ * @brief   Claim an (statically initialized) event queue for the calling thread
+ *
+ * @param[in] queue     event queue object to claim
+ */
+void event_queue_claim(event_queue_t *queue);
+
+/**
+ * @brief   Queue an event
+ *
+ * Can be called from ISR context. If @p event is already queued, this
+ * function does nothing.
+ *
+ * @param[in] queue     event queue to queue event in
+ * @param[in] event     event to queue
+ */
+void event_post(event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Dequeue an event
+ *
+ * Can be called from ISR context. Does nothing if @p event is not queued.
+ *
+ * @param[in] queue     event queue to remove event from
+ * @param[in] event     event to remove from queue
+ */
+void event_cancel(event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Get the next event from a queue, non-blocking
+ *
+ * @param[in] queue     event queue to get event from
+ *
+ * @return  pointer to the next event
+ * @return  NULL if no event is queued
+ */
+event_t *event_get(event_queue_t *queue);
+
+/**
+ * @brief   Get the next event from a queue, blocking
+ *
+ * Must only be called by the thread owning @p queue.
+ *
+ * @param[in] queue     event queue to get event from
+ *
+ * @return  pointer to the next event
+ */
+event_t *event_wait(event_queue_t *queue);
+
+/**
+ * @brief   Process events of a queue forever
+ *
+ * Must only be called by the thread owning @p queue.
+ *
+ * @param[in] queue     event queue to process
+ */
+void event_loop(event_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_H */
+/** @} */
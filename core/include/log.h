@@ -24,7 +24,8 @@
  * 2. have a name starting with "log_" *or* depend on the pseudo-module LOG,
  * 3. implement log_write()
  *
- * See "sys/log/log_printfnoformat" for an example.
+ * See "sys/log/log_printfnoformat" for an example, and "sys/log/log_binary"
+ * for a module that defers the formatting to a host tool.
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  */
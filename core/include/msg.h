@@ -247,6 +247,24 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_send_to_self(msg_t *m);
 
+/**
+ * @brief Send a message to several threads without blocking.
+ *
+ * Has the same effect as calling msg_try_send() for every thread in
+ * @p target_pids, but takes a single critical section and causes at most one
+ * context switch. Can be called in interrupt context.
+ *
+ * @param[in] m             Pointer to preallocated ``msg_t`` structure, must
+ *                          not be NULL.
+ * @param[in] target_pids   PIDs of the target threads
+ * @param[in] num           number of entries in @p target_pids
+ *
+ * @return  number of threads the message was delivered to, the others were
+ *          not waiting and had no free space in their message queue (or did
+ *          not exist, e.g. @ref KERNEL_PID_UNDEF)
+ */
+int msg_send_bulk(msg_t *m, const kernel_pid_t *target_pids, unsigned num);
+
 /**
  * Value of msg_t::sender_pid if the sender was an interrupt service routine.
  */
@@ -309,6 +327,21 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive several queued messages at once.
+ *
+ * Takes up to @p max messages from the message queue in a single critical
+ * section. If no message is queued, this function blocks like
+ * msg_receive() and returns a single message.
+ *
+ * @param[out] m    Array of at least @p max preallocated ``msg_t``
+ *                  structures, must not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must not be 0.
+ *
+ * @return  the number of received messages, at least 1.
+ */
+int msg_receive_bulk(msg_t *m, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -39,6 +39,8 @@
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned state);
 
+/* returns 0 if the queue is full, 1 if the message was queued and 2 if it was
+ * queued and the target was woken from waiting for THREAD_FLAG_MSG_WAITING */
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -50,6 +52,12 @@ static int queue_msg(thread_t *target, const msg_t *m)
     DEBUG("queue_msg(): queuing message\n");
     msg_t *dest = &target->msg_array[n];
     *dest = *m;
+#ifdef MODULE_CORE_THREAD_FLAGS
+    target->flags |= THREAD_FLAG_MSG_WAITING;
+    if (thread_flags_wake(target)) {
+        return 2;
+    }
+#endif
     return 1;
 }
 
@@ -104,14 +112,19 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
         DEBUG("msg_send() %s:%i: Target %" PRIkernel_pid " is not RECEIVE_BLOCKED.\n",
               RIOT_FILE_RELATIVE, __LINE__, target_pid);
 
-        if (queue_msg(target, m)) {
+        int queued = queue_msg(target, m);
+        if (queued) {
             DEBUG("msg_send() %s:%i: Target %" PRIkernel_pid
                   " has a msg_queue. Queueing message.\n", RIOT_FILE_RELATIVE,
                   __LINE__, target_pid);
+            uint16_t target_prio = target->priority;
             irq_restore(state);
             if (me->status == STATUS_REPLY_BLOCKED) {
                 thread_yield_higher();
             }
+            else if (queued > 1) {
+                sched_switch(target_prio);
+            }
             return 1;
         }
 
@@ -170,7 +183,7 @@ int msg_send_to_self(msg_t *m)
     int res = queue_msg((thread_t *) sched_active_thread, m);
 
     irq_restore(state);
-    return res;
+    return (res > 0);
 }
 
 int msg_send_int(msg_t *m, kernel_pid_t target_pid)
@@ -204,7 +217,11 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
     else {
         DEBUG("msg_send_int: Receiver not waiting.\n");
-        return (queue_msg(target, m));
+        int res = queue_msg(target, m);
+        if (res > 1) {
+            sched_context_switch_request = 1;
+        }
+        return (res > 0);
     }
 }
 
@@ -267,6 +284,54 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     return 1;
 }
 
+int msg_send_bulk(msg_t *m, const kernel_pid_t *target_pids, unsigned num)
+{
+    uint16_t prio = THREAD_PRIORITY_IDLE;
+    unsigned sent = 0;
+    unsigned state = irq_disable();
+
+    m->sender_pid = irq_is_in() ? KERNEL_PID_ISR : sched_active_pid;
+
+    for (unsigned i = 0; i < num; i++) {
+        thread_t *target;
+        int woken;
+
+        if (!pid_is_valid(target_pids[i])) {
+            DEBUG("msg_send_bulk(): invalid target PID\n");
+            continue;
+        }
+        target = (thread_t *) sched_threads[target_pids[i]];
+        if (target == NULL) {
+            DEBUG("msg_send_bulk(): target thread does not exist\n");
+            continue;
+        }
+        if (target->status == STATUS_RECEIVE_BLOCKED) {
+            /* copy msg to target */
+            *((msg_t *) target->wait_data) = *m;
+            sched_set_status(target, STATUS_PENDING);
+            woken = 1;
+        }
+        else {
+            int res = queue_msg(target, m);
+
+            if (res == 0) {
+                continue;
+            }
+            woken = (res > 1);
+        }
+        sent++;
+        if (woken && (target->priority < prio)) {
+            prio = target->priority;
+        }
+    }
+
+    irq_restore(state);
+    if (prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(prio);
+    }
+    return sent;
+}
+
 int msg_try_receive(msg_t *m)
 {
     return _msg_receive(m, 0);
@@ -363,6 +428,53 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_bulk(msg_t *m, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = (thread_t *) sched_active_thread;
+    unsigned num = 0;
+    int queue_index;
+
+    if (me->msg_array) {
+        while ((num < max) &&
+               ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            m[num++] = me->msg_array[queue_index];
+        }
+    }
+
+    if (num == 0) {
+        irq_restore(state);
+        return _msg_receive(m, 1);
+    }
+
+    /* take the messages of waiting threads into the just freed queue space */
+    uint16_t prio = THREAD_PRIORITY_IDLE;
+    list_node_t *next;
+
+    for (unsigned i = 0;
+         (i < num) && ((next = list_remove_head(&me->msg_waiters)) != NULL);
+         i++) {
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+        me->msg_array[cib_put(&(me->msg_queue))] = *((msg_t *) sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < prio) {
+                prio = sender->priority;
+            }
+        }
+    }
+
+    irq_restore(state);
+    if (prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(prio);
+    }
+    return num;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -68,11 +68,41 @@ void native_interrupt_init(void);
 
 void native_irq_handler(void);
 extern void _native_sig_leave_tramp(void);
+void _native_sig_pend(int sig);
 
 void _native_syscall_leave(void);
 void _native_syscall_enter(void);
 void _native_init_syscalls(void);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/**
+ * skip the virtual time to the next timer deadline, returns 0 if there is
+ * none
+ */
+int _native_vtime_skip(void);
+#endif
+
+/**
+ * context switching
+ *
+ * With module native_fast_ctx, threads are switched with register-only
+ * replacements of swapcontext()/setcontext() on x86 Linux (see fast_ctx.S),
+ * which do not need a system call.
+ */
+#if defined(MODULE_NATIVE_FAST_CTX) && defined(__linux__) && \
+    (defined(__i386__) || defined(__x86_64__))
+#define NATIVE_FAST_CTX (1)
+
+int _native_ctx_swap(ucontext_t *oucp, const ucontext_t *ucp);
+int _native_ctx_set(const ucontext_t *ucp);
+
+#define _native_swapcontext(oucp, ucp)  _native_ctx_swap(oucp, ucp)
+#define _native_setcontext(ucp)         _native_ctx_set(ucp)
+#else
+#define _native_swapcontext(oucp, ucp)  swapcontext(oucp, ucp)
+#define _native_setcontext(ucp)         setcontext(ucp)
+#endif
+
 /**
  * external functions regularly wrapped in native for direct use
  */
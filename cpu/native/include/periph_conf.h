@@ -63,6 +63,19 @@
 
 /** @} */
 
+/**
+ * @name SPI configuration
+ *
+ * Only with the `native_spi` module: each bus is connected to an emulated
+ * device, see cpu/native/periph/spi.c.
+ * @{
+ */
+#ifdef MODULE_NATIVE_SPI
+#define SPI_NUMOF           (1U)
+#define SPI_0_EN            1
+#endif
+/** @} */
+
 /**
  * @brief UART configuration
  * @{
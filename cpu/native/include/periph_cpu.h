@@ -32,6 +32,14 @@ extern "C" {
 #define CPUID_LEN           (4U)
 #endif
 
+/**
+ * @name    Emulated SPI device
+ * @{
+ */
+#define NATIVE_SPI_REG_NUMOF    (128U)  /**< size of the register file */
+#define NATIVE_SPI_REG_WRITE    (0x80)  /**< write flag of register addresses */
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -146,34 +146,33 @@ void native_print_signals(void)
 }
 
 /**
- * block signals
+ * block interrupts
+ *
+ * Signals are not blocked at the host level: native_isr_entry() defers
+ * signals arriving while interrupts are disabled and irq_enable() replays
+ * them, so this does not need a system call.
  */
 unsigned irq_disable(void)
 {
     unsigned int prev_state;
 
-    _native_syscall_enter();
     DEBUG("irq_disable()\n");
 
     if (_native_in_isr == 1) {
         DEBUG("irq_disable + _native_in_isr\n");
     }
 
-    if (sigprocmask(SIG_SETMASK, &_native_sig_set_dint, NULL) == -1) {
-        err(EXIT_FAILURE, "irq_disable: sigprocmask");
-    }
-
     prev_state = native_interrupts_enabled;
     native_interrupts_enabled = 0;
 
     DEBUG("irq_disable(): return\n");
-    _native_syscall_leave();
 
     return prev_state;
 }
 
 /**
- * unblock signals
+ * unblock interrupts,
+ * handle signals deferred while they were blocked
  */
 unsigned irq_enable(void)
 {
@@ -187,20 +186,15 @@ unsigned irq_enable(void)
 #endif
     }
 
+    /* native_isr_entry() defers signals arriving in between to
+     * _native_syscall_leave() */
     _native_syscall_enter();
     DEBUG("irq_enable()\n");
 
-    /* Mark the IRQ as enabled first since sigprocmask could call the handler
-     * before returning to userspace.
-     */
-
     prev_state = native_interrupts_enabled;
     native_interrupts_enabled = 1;
 
-    if (sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
-        err(EXIT_FAILURE, "irq_enable: sigprocmask");
-    }
-
+    /* calls the ISR for pending signals */
     _native_syscall_leave();
 
     DEBUG("irq_enable(): return\n");
@@ -216,7 +210,7 @@ void irq_restore(unsigned state)
         irq_enable();
     }
     else {
-        irq_disable();
+        native_interrupts_enabled = 0;
     }
 
     return;
@@ -258,7 +252,9 @@ void native_irq_handler(void)
 
     while (_native_sigpend > 0) {
         int sig = _native_popsig();
-        _native_sigpend--;
+        /* native_isr_entry() may interrupt the ISR if it does not run with
+         * signals blocked (module native_fast_ctx) */
+        __sync_fetch_and_sub(&_native_sigpend, 1);
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
@@ -281,6 +277,17 @@ void isr_set_sigmask(ucontext_t *ctx)
     ctx->uc_sigmask = _native_sig_set_dint;
 }
 
+/**
+ * save signal for native_irq_handler
+ */
+void _native_sig_pend(int sig)
+{
+    if (real_write(_sig_pipefd[1], &sig, sizeof(int)) == -1) {
+        err(EXIT_FAILURE, "_native_sig_pend: real_write()");
+    }
+    __sync_fetch_and_add(&_native_sigpend, 1);
+}
+
 /**
  * save signal, return to _native_sig_leave_tramp if possible
  */
@@ -290,11 +297,7 @@ void native_isr_entry(int sig, siginfo_t *info, void *context)
     //printf("\n\033[33m\n\t\tnative_isr_entry(%i)\n\n\033[0m", sig);
 
     /* save the signal */
-    if (real_write(_sig_pipefd[1], &sig, sizeof(int)) == -1) {
-        err(EXIT_FAILURE, "native_isr_entry: real_write()");
-    }
-    _native_sigpend++;
-    //real_write(STDOUT_FILENO, "sigpend\n", 8);
+    _native_sig_pend(sig);
 
     if (context == NULL) {
         errx(EXIT_FAILURE, "native_isr_entry: context is null - unhandled");
@@ -306,10 +309,9 @@ void native_isr_entry(int sig, siginfo_t *info, void *context)
         return;
     }
 
-    /* XXX: Workaround safety check - whenever this happens it really
-     * indicates a bug in irq_disable */
+    /* interrupts are disabled: the signal is handled by the next
+     * irq_enable() */
     if (native_interrupts_enabled == 0) {
-        //printf("interrupts are off, but I caught a signal.\n");
         return;
     }
     if (_native_in_isr != 0) {
@@ -329,8 +331,8 @@ void native_isr_entry(int sig, siginfo_t *info, void *context)
     _native_cur_ctx = (ucontext_t *)sched_active_thread->sp;
 
     DEBUG("\n\n\t\tnative_isr_entry: return to _native_sig_leave_tramp\n\n");
-    /* disable interrupts in context */
-    isr_set_sigmask((ucontext_t *)context);
+    /* signals arriving before _native_sig_leave_tramp switched to
+     * native_isr_context are deferred until the ISR is running */
     _native_in_isr = 1;
     /*
      * For register access on new platforms see:
@@ -511,6 +513,12 @@ void native_interrupt_init(void)
     native_isr_context.uc_stack.ss_sp = __isr_stack;
     native_isr_context.uc_stack.ss_size = SIGSTKSZ;
     native_isr_context.uc_stack.ss_flags = 0;
+    /* the ISR is the only context running with signals blocked at the host
+     * level, threads mask interrupts with native_interrupts_enabled. The
+     * register-only context switch of module native_fast_ctx does not
+     * apply it, signals interrupting the ISR are deferred by
+     * _native_in_isr then. */
+    isr_set_sigmask(&native_isr_context);
     _native_isr_ctx = &native_isr_context;
 
     static stack_t sigstk;
@@ -543,6 +551,14 @@ void native_interrupt_init(void)
         err(EXIT_FAILURE, "native_interrupt_init: sigaction");
     }
 
+    /* threads run with no signals blocked at the host level, so a SIGPIPE
+     * would terminate the process instead of just failing the write */
+    sa.sa_handler = SIG_IGN;
+    sa.sa_flags = 0;
+    if (sigaction(SIGPIPE, &sa, NULL)) {
+        err(EXIT_FAILURE, "native_interrupt_init: sigaction");
+    }
+
 
     puts("RIOT native interrupts/signals initialized.");
 }
@@ -39,7 +39,15 @@ void lpm_init(void)
 void _native_lpm_sleep(void)
 {
     _native_in_syscall++; // no switching here
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    /* nothing to do until the next timer deadline: skip to it instead of
+     * waiting for it */
+    if ((_native_sigpend == 0) && !_native_vtime_skip()) {
+        real_pause();
+    }
+#else
     real_pause();
+#endif
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
@@ -16,11 +16,13 @@
  *
  * in-process preemptive context switching utilizes POSIX ucontexts.
  * (ucontext provides for architecture independent stack handling)
+ * Module native_fast_ctx switches them without system calls on x86 Linux.
  *
  * @author  Ludwig Knüpfer <ludwig.knuepfer@fu-berlin.de>
  * @author  Kaspar Schleiser <kaspar@schleiser.de>
  */
 
+#include <stddef.h>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -65,6 +67,18 @@ extern netdev2_tap_t netdev2_tap;
 ucontext_t end_context;
 char __end_stack[SIGSTKSZ];
 
+#ifdef NATIVE_FAST_CTX
+/* fast_ctx.S relies on this layout of ucontext_t, the register indices in
+ * uc_mcontext.gregs are fixed by the kernel's signal frame */
+#ifdef __x86_64__
+typedef char _native_fast_ctx_layout[
+    (offsetof(ucontext_t, uc_mcontext.gregs) == 40) ? 1 : -1];
+#else
+typedef char _native_fast_ctx_layout[
+    (offsetof(ucontext_t, uc_mcontext.gregs) == 20) ? 1 : -1];
+#endif
+#endif
+
 /**
  * TODO: implement
  */
@@ -81,6 +95,15 @@ int thread_arch_isr_stack_usage(void)
     return -1;
 }
 
+/* entry point of all threads, the switch to a new thread is finished when
+ * it starts running */
+static void _native_thread_start(thread_task_func_t task_func, void *arg)
+{
+    _native_in_isr = 0;
+    irq_enable();
+    task_func(arg);
+}
+
 char *thread_stack_init(thread_task_func_t task_func, void *arg, void *stack_start, int stacksize)
 {
     char *stk;
@@ -110,7 +133,7 @@ char *thread_stack_init(thread_task_func_t task_func, void *arg, void *stack_sta
         err(EXIT_FAILURE, "thread_stack_init: sigemptyset");
     }
 
-    makecontext(p, (void (*)(void)) task_func, 1, arg);
+    makecontext(p, (void (*)(void)) _native_thread_start, 2, task_func, arg);
 
     return (char *) p;
 }
@@ -127,12 +150,12 @@ void isr_cpu_switch_context_exit(void)
     DEBUG("isr_cpu_switch_context_exit: calling setcontext(%" PRIkernel_pid ")\n\n", sched_active_pid);
     ctx = (ucontext_t *)(sched_active_thread->sp);
 
-    /* the next context will have interrupts enabled due to ucontext */
+    /* the next context will have interrupts enabled, it leaves the ISR
+     * (_native_in_isr) once the switch to it is finished */
     DEBUG("isr_cpu_switch_context_exit: native_interrupts_enabled = 1;\n");
     native_interrupts_enabled = 1;
-    _native_in_isr = 0;
 
-    if (setcontext(ctx) == -1) {
+    if (_native_setcontext(ctx) == -1) {
         err(EXIT_FAILURE, "isr_cpu_switch_context_exit: setcontext");
     }
     errx(EXIT_FAILURE, "2 this should have never been reached!!");
@@ -154,7 +177,7 @@ void cpu_switch_context_exit(void)
         native_isr_context.uc_stack.ss_size = SIGSTKSZ;
         native_isr_context.uc_stack.ss_flags = 0;
         makecontext(&native_isr_context, isr_cpu_switch_context_exit, 0);
-        if (setcontext(&native_isr_context) == -1) {
+        if (_native_setcontext(&native_isr_context) == -1) {
             err(EXIT_FAILURE, "cpu_switch_context_exit: swapcontext");
         }
         errx(EXIT_FAILURE, "1 this should have never been reached!!");
@@ -174,8 +197,7 @@ void isr_thread_yield(void)
     DEBUG("isr_thread_yield: switching to(%" PRIkernel_pid ")\n\n", sched_active_pid);
 
     native_interrupts_enabled = 1;
-    _native_in_isr = 0;
-    if (setcontext(ctx) == -1) {
+    if (_native_setcontext(ctx) == -1) {
         err(EXIT_FAILURE, "isr_thread_yield: setcontext");
     }
 }
@@ -190,9 +212,10 @@ void thread_yield_higher(void)
         native_isr_context.uc_stack.ss_size = SIGSTKSZ;
         native_isr_context.uc_stack.ss_flags = 0;
         makecontext(&native_isr_context, isr_thread_yield, 0);
-        if (swapcontext(ctx, &native_isr_context) == -1) {
+        if (_native_swapcontext(ctx, &native_isr_context) == -1) {
             err(EXIT_FAILURE, "thread_yield_higher: swapcontext");
         }
+        _native_in_isr = 0;
         irq_enable();
     }
     else {
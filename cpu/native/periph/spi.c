@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     native_cpu
+ * @{
+ *
+ * @file
+ * @brief       SPI implementation with an emulated device on each bus
+ *
+ * Register accesses address a register file of @ref NATIVE_SPI_REG_NUMOF
+ * bytes. Addresses with @ref NATIVE_SPI_REG_WRITE set write to it, all
+ * others read from it; multi-byte accesses auto-increment the address. Plain
+ * transfers are looped back, as if MOSI was connected to MISO.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "mutex.h"
+#include "periph/spi.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#if SPI_NUMOF
+
+typedef struct {
+    mutex_t lock;
+    uint8_t regs[NATIVE_SPI_REG_NUMOF];
+    int init;
+} _spi_dev_t;
+
+static _spi_dev_t _devs[SPI_NUMOF];
+
+int spi_init_master(spi_t dev, spi_conf_t conf, spi_speed_t speed)
+{
+    (void)conf;
+    (void)speed;
+
+    if ((unsigned)dev >= SPI_NUMOF) {
+        return -2;
+    }
+    DEBUG("spi_init_master: SPI_%u\n", (unsigned)dev);
+    if (!_devs[dev].init) {
+        mutex_init(&_devs[dev].lock);
+        memset(_devs[dev].regs, 0, sizeof(_devs[dev].regs));
+        _devs[dev].init = 1;
+    }
+    return 0;
+}
+
+int spi_init_slave(spi_t dev, spi_conf_t conf, char (*cb)(char data))
+{
+    (void)dev;
+    (void)conf;
+    (void)cb;
+
+    /* the emulated device is always the slave */
+    return -1;
+}
+
+int spi_conf_pins(spi_t dev)
+{
+    return ((unsigned)dev < SPI_NUMOF) ? 0 : -1;
+}
+
+int spi_acquire(spi_t dev)
+{
+    if ((unsigned)dev >= SPI_NUMOF) {
+        return -1;
+    }
+    mutex_lock(&_devs[dev].lock);
+    return 0;
+}
+
+int spi_release(spi_t dev)
+{
+    if ((unsigned)dev >= SPI_NUMOF) {
+        return -1;
+    }
+    mutex_unlock(&_devs[dev].lock);
+    return 0;
+}
+
+int spi_transfer_byte(spi_t dev, char out, char *in)
+{
+    return spi_transfer_bytes(dev, &out, in, 1);
+}
+
+int spi_transfer_bytes(spi_t dev, char *out, char *in, unsigned int length)
+{
+    if (!_devs[dev].init) {
+        return -1;
+    }
+    if (in != NULL) {
+        if (out != NULL) {
+            memmove(in, out, length);
+        }
+        else {
+            memset(in, 0, length);
+        }
+    }
+    return length;
+}
+
+int spi_transfer_reg(spi_t dev, uint8_t reg, char out, char *in)
+{
+    return spi_transfer_regs(dev, reg, &out, in, 1);
+}
+
+int spi_transfer_regs(spi_t dev, uint8_t reg, char *out, char *in, unsigned int length)
+{
+    uint8_t *regs = _devs[dev].regs;
+    unsigned addr = (reg & ~NATIVE_SPI_REG_WRITE) % NATIVE_SPI_REG_NUMOF;
+
+    if (!_devs[dev].init) {
+        return -1;
+    }
+    for (unsigned i = 0; i < length; i++) {
+        /* the old content is shifted out while the new one is shifted in */
+        char tmp = (char)regs[addr];
+
+        if (reg & NATIVE_SPI_REG_WRITE) {
+            regs[addr] = (out != NULL) ? (uint8_t)out[i] : 0;
+        }
+        if (in != NULL) {
+            in[i] = tmp;
+        }
+        addr = (addr + 1) % NATIVE_SPI_REG_NUMOF;
+    }
+    return length;
+}
+
+void spi_transmission_begin(spi_t dev, char reset_val)
+{
+    (void)dev;
+    (void)reset_val;
+}
+
+void spi_poweron(spi_t dev)
+{
+    (void)dev;
+}
+
+void spi_poweroff(spi_t dev)
+{
+    (void)dev;
+}
+
+#endif /* SPI_NUMOF */
@@ -19,6 +19,14 @@
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as xtimer does the same. (kaspar)
  *
+ * With module native_virtual_time, the timer counts virtual time instead:
+ * it only advances when read (by NATIVE_VIRTUAL_TIME_READ_TICKS, so busy
+ * waiting terminates) and jumps to the next deadline when all threads are
+ * idle (see _native_lpm_sleep()). Expired deadlines raise SIGALRM without
+ * the host being involved, so runs are reproducible and not bound to wall
+ * clock time. Signals of the host (e.g. SIGIO of netdev2_tap) are still
+ * handled when they arrive and see the virtual time at that point.
+ *
  * @}
  */
 
@@ -49,13 +57,28 @@
 
 #define NATIVE_TIMER_SPEED 1000000
 
-static unsigned long time_null;
+#ifndef NATIVE_VIRTUAL_TIME_READ_TICKS
+/**
+ * @brief   Ticks the virtual time advances by each timer_read()
+ */
+#define NATIVE_VIRTUAL_TIME_READ_TICKS  (1U)
+#endif
 
 static timer_cb_t _callback;
 static void *_cb_arg;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+static unsigned int _vtime;
+static unsigned int _deadline;
+static int _deadline_set;
+static int _irq_enabled;
+#else
+static unsigned long time_null;
+
 static struct itimerval itv;
+#endif
 
+#ifndef MODULE_NATIVE_VIRTUAL_TIME
 /**
  * returns ticks for give timespec
  */
@@ -64,6 +87,7 @@ static unsigned long ts2ticks(struct timespec *tp)
     /* TODO: check for overflow */
     return((tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
+#endif
 
 /**
  * native timer signal handler
@@ -88,9 +112,14 @@ int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
         return -1;
     }
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _vtime = 0;
+    _deadline_set = 0;
+#else
     /* initialize time delta */
     time_null = 0;
     time_null = timer_read(0);
+#endif
 
     timer_irq_disable(dev);
     _callback = cb;
@@ -100,6 +129,44 @@ int timer_init(tim_t dev, unsigned long freq, timer_cb_t cb, void *arg)
     return 0;
 }
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/**
+ * raise the timer interrupt if the deadline has been reached,
+ * to be called with _native_in_syscall set
+ */
+static void _check_deadline(void)
+{
+    if (_deadline_set && _irq_enabled && ((int)(_vtime - _deadline) >= 0)) {
+        _deadline_set = 0;
+        _native_sig_pend(SIGALRM);
+    }
+}
+
+int _native_vtime_skip(void)
+{
+    if (!_deadline_set || !_irq_enabled) {
+        return 0;
+    }
+
+    DEBUG("%s: %u -> %u\n", __func__, _vtime, _deadline);
+    if ((int)(_deadline - _vtime) > 0) {
+        _vtime = _deadline;
+    }
+    _check_deadline();
+
+    return 1;
+}
+
+static void do_timer_set(unsigned int offset)
+{
+    DEBUG("%s\n", __func__);
+
+    _native_syscall_enter();
+    _deadline = _vtime + offset;
+    _deadline_set = (offset != 0);
+    _native_syscall_leave();
+}
+#else
 static void do_timer_set(unsigned int offset)
 {
     DEBUG("%s\n", __func__);
@@ -120,6 +187,7 @@ static void do_timer_set(unsigned int offset)
     }
     _native_syscall_leave();
 }
+#endif
 
 int timer_set(tim_t dev, int channel, unsigned int offset)
 {
@@ -163,6 +231,9 @@ void timer_irq_enable(tim_t dev)
     if (register_interrupt(SIGALRM, native_isr_timer) != 0) {
         DEBUG("darn!\n\n");
     }
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _irq_enabled = 1;
+#endif
 
     return;
 }
@@ -172,6 +243,9 @@ void timer_irq_disable(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _irq_enabled = 0;
+#endif
     if (unregister_interrupt(SIGALRM) != 0) {
         DEBUG("darn!\n\n");
     }
@@ -197,6 +271,18 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    unsigned int now;
+
+    _native_syscall_enter();
+    now = _vtime;
+    _vtime += NATIVE_VIRTUAL_TIME_READ_TICKS;
+    _check_deadline();
+    /* calls the timer interrupt if the deadline was reached */
+    _native_syscall_leave();
+
+    return now;
+#else
     struct timespec t;
 
     DEBUG("timer_read()\n");
@@ -220,4 +306,5 @@ unsigned int timer_read(tim_t dev)
     _native_syscall_leave();
 
     return ts2ticks(&t) - time_null;
+#endif
 }
@@ -23,10 +23,14 @@
 #include <termios.h>
 #include <fcntl.h>
 
+#include "irq.h"
 #include "thread.h"
 #include "periph/uart.h"
 #include "native_internal.h"
 #include "async_read.h"
+#ifdef MODULE_UART_ASYNC
+#include "uart_async.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -46,6 +50,13 @@ static char *tty_device_filenames[UART_NUMOF];
  */
 static int tty_fds[UART_NUMOF];
 
+#ifdef MODULE_UART_ASYNC
+/**
+ * @brief set while the TX buffer is drained
+ */
+static volatile int tx_busy[UART_NUMOF];
+#endif
+
 void tty_uart_setup(uart_t uart, const char *filename)
 {
     tty_device_filenames[uart] = strndup(filename, PATH_MAX - 1);
@@ -174,6 +185,38 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
     _native_write(tty_fds[uart], data, len);
 }
 
+#ifdef MODULE_UART_ASYNC
+/* The host accepts the data right away, so the TX-empty interrupt is
+ * emulated by draining the buffer immediately. A write from a signal handler
+ * during the drain is picked up by the running loop. */
+void uart_txirq_start(uart_t uart)
+{
+    unsigned state = irq_disable();
+
+    if (tx_busy[uart]) {
+        irq_restore(state);
+        return;
+    }
+    tx_busy[uart] = 1;
+
+    while (1) {
+        char *data;
+        unsigned len = uart_async_tx_span(uart, &data);
+
+        if (len == 0) {
+            break;
+        }
+        irq_restore(state);
+        _native_write(tty_fds[uart], data, len);
+        state = irq_disable();
+        uart_async_tx_commit(uart, len);
+    }
+
+    tx_busy[uart] = 0;
+    irq_restore(state);
+}
+#endif
+
 void uart_cleanup(void) {
     native_async_read_cleanup();
 
@@ -25,6 +25,9 @@
 #include "mutex.h"
 #include "periph/uart.h"
 #include "periph/gpio.h"
+#ifdef FEATURE_PERIPH_UART_TXIRQ
+#include "uart_async.h"
+#endif
 
 /**
  * @brief   Allocate memory to store the callback functions
@@ -45,6 +48,46 @@ static inline USART_TypeDef *_dev(uart_t uart)
 static mutex_t _tx_dma_sync[UART_NUMOF];
 static mutex_t _tx_lock[UART_NUMOF];
 
+#ifdef FEATURE_PERIPH_UART_TXIRQ
+/**
+ * @brief   Length of the running DMA transfer out of the uart_async buffer,
+ *          0 if there is none
+ *
+ * uart_write() from thread context must not be used on a UART drained this
+ * way, as both share the DMA stream.
+ */
+static uint16_t _tx_async[UART_NUMOF];
+
+/* must be called with interrupts disabled and the DMA stream idle */
+static void _tx_async_next(uart_t uart)
+{
+    DMA_Stream_TypeDef *stream = dma_stream(uart_config[uart].dma_stream);
+    char *data;
+    unsigned len = uart_async_tx_span(uart, &data);
+
+    if (len > UINT16_MAX) {
+        len = UINT16_MAX;
+    }
+    _tx_async[uart] = (uint16_t)len;
+    if (len > 0) {
+        stream->M0AR = (uint32_t)data;
+        stream->NDTR = (uint16_t)len;
+        stream->CR |= DMA_SxCR_EN;
+    }
+}
+
+void uart_txirq_start(uart_t uart)
+{
+    DMA_Stream_TypeDef *stream = dma_stream(uart_config[uart].dma_stream);
+    unsigned state = irq_disable();
+
+    if ((_tx_async[uart] == 0) && !(stream->CR & DMA_SxCR_EN)) {
+        _tx_async_next(uart);
+    }
+    irq_restore(state);
+}
+#endif
+
 int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
 {
     USART_TypeDef *dev;
@@ -156,7 +199,17 @@ static inline void dma_handler(int uart, int stream)
 {
     /* clear DMA done flag */
     dma_base(stream)->IFCR[dma_hl(stream)] = dma_ifc(stream);
+#ifdef FEATURE_PERIPH_UART_TXIRQ
+    if (_tx_async[uart] != 0) {
+        uart_async_tx_commit(uart, _tx_async[uart]);
+        _tx_async_next(uart);
+    }
+    else {
+        mutex_unlock(&_tx_dma_sync[uart]);
+    }
+#else
     mutex_unlock(&_tx_dma_sync[uart]);
+#endif
     if (sched_context_switch_request) {
         thread_yield();
     }
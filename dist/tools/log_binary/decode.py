@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2016 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Decodes the output of the log_binary module.
+
+Reads lines from the given file or stdin. Records printed by
+log_binary_dump() are replaced by the formatted messages, all other lines
+are passed through, so the tool can be put behind `make term`.
+"""
+
+import re
+import struct
+import sys
+
+MAGIC = 0xa5
+LEVELS = ["NONE", "ERROR", "WARNING", "INFO", "DEBUG", "ALL"]
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+RECORD = re.compile(r"#[LD](?: [0-9a-fA-F]+)+\s*$")
+SPEC = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?"
+                  r"(?:hh|h|ll|l|j|z|t|L)?([diouxXcsp%])")
+
+
+class Elf(object):
+    """The allocated sections of an ELF file"""
+
+    def __init__(self, filename):
+        with open(filename, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % filename)
+        bits64 = data[4] == 2
+        end = "<" if data[5] == 1 else ">"
+        if bits64:
+            shoff, = struct.unpack_from(end + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x3a)
+            shfmt = end + "IIQQQQ"
+        else:
+            shoff, = struct.unpack_from(end + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x2e)
+            shfmt = end + "IIIIII"
+
+        self.sections = []
+        for i in range(shnum):
+            _, stype, flags, addr, offset, size = \
+                struct.unpack_from(shfmt, data, shoff + i * shentsize)
+            if (flags & SHF_ALLOC) and stype != SHT_NOBITS and size:
+                self.sections.append((addr, data[offset:offset + size]))
+
+    def string(self, addr):
+        """Returns the C string at addr or None"""
+        for start, content in self.sections:
+            if start <= addr < start + len(content):
+                offset = addr - start
+                end = content.find(b"\0", offset)
+                if end < 0:
+                    end = len(content)
+                return content[offset:end].decode("utf-8", "replace")
+        return None
+
+
+def _signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_message(elf, fmt, args):
+    """Formats args like printf() would"""
+    args = list(args)
+
+    def _next():
+        return args.pop(0) if args else 0
+
+    def _convert(match):
+        flags, width, prec, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if width == "*":
+            width = str(_signed(_next()))
+        if prec == "*":
+            prec = str(_signed(_next()))
+        spec = "%" + flags + (width or "") + ("." + prec if prec else "")
+        value = _next()
+        if conv in "di":
+            return (spec + "d") % _signed(value)
+        if conv == "u":
+            return (spec + "d") % value
+        if conv in "oxX":
+            return (spec + conv) % value
+        if conv == "c":
+            return (spec + "c") % chr(value & 0xff)
+        if conv == "p":
+            return (spec + "s") % ("0x%08x" % value)
+        string = elf.string(value)
+        if string is None:
+            string = "<0x%08x>" % value
+        return (spec + "s") % string
+
+    return SPEC.sub(_convert, fmt)
+
+
+def decode(elf, line):
+    """Returns the text for one line of log_binary_dump() output"""
+    fields = line.split()
+    if fields[0] == "#D":
+        return "[%s log records dropped]" % fields[1]
+    words = [int(word, 16) for word in fields[1:]]
+    if len(words) < 2 or (words[0] >> 24) != MAGIC:
+        return line
+    level = (words[0] >> 8) & 0xff
+    fmt = elf.string(words[1])
+    if fmt is None:
+        return "[unknown format string at 0x%08x] %s" % (words[1], line)
+    msg = format_message(elf, fmt, words[2:2 + (words[0] & 0xff)])
+    if level < len(LEVELS):
+        msg = "[%s] %s" % (LEVELS[level], msg)
+    return msg.rstrip("\n")
+
+
+def main(argv):
+    if len(argv) < 2:
+        print("usage: %s <elf file> [log file]" % argv[0], file=sys.stderr)
+        return 1
+    elf = Elf(argv[1])
+    infile = open(argv[2]) if len(argv) > 2 else sys.stdin
+    for line in infile:
+        line = line.rstrip("\r\n")
+        # records may be prefixed, e.g. by the timestamps of pyterm
+        match = RECORD.search(line)
+        if match:
+            try:
+                line = line[:match.start()] + decode(elf, match.group(0))
+            except (ValueError, IndexError):
+                pass
+        print(line)
+        sys.stdout.flush()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
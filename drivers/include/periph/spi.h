@@ -13,7 +13,7 @@
  *
  * The current design of this interface targets implementations that use the SPI in blocking mode.
  *
- * TODO: add means for asynchronous SPI usage
+ * For queued, non-blocking transfers see @ref drivers_spi_async.
  *
  * @{
  * @file
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_spi_async Asynchronous SPI transactions
+ * @ingroup     drivers_periph_spi
+ * @brief       Queue of SPI transactions executed by a worker thread
+ *
+ * A transaction is an array of operations (register accesses or plain
+ * transfers) on one device. The caller submits it with spi_async_submit()
+ * and continues while the SPI worker thread acquires the bus, runs the
+ * operations and releases the bus again. Drivers can thus batch register
+ * sequences into one transaction and process the previous frame while the
+ * next one is transferred.
+ *
+ * Every operation is framed by the chip select line, unless it has the
+ * @ref SPI_ASYNC_CONT flag set, which keeps the chip select asserted for the
+ * next operation (e.g. a frame buffer command followed by the frame).
+ *
+ * On completion the worker either calls the transaction's callback or, if
+ * there is none, sets @ref SPI_ASYNC_THREAD_FLAG on the thread that
+ * submitted the transaction, which can use spi_async_wait().
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static const spi_async_op_t ops[] = {
+ *     SPI_ASYNC_REG(REG_WRITE | REG_A, &a, NULL, 1),
+ *     SPI_ASYNC_REG(REG_WRITE | REG_B, &b, NULL, 1),
+ *     SPI_ASYNC_BYTES(&cmd, NULL, 1, SPI_ASYNC_CONT),
+ *     SPI_ASYNC_BYTES(NULL, frame, sizeof(frame), 0),
+ * };
+ * spi_async_t trans;
+ *
+ * spi_async_setup(&trans, SPI_0, CS_PIN, ops, 4, NULL, NULL);
+ * spi_async_submit(&trans);
+ * process_previous_frame();
+ * spi_async_wait(&trans);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Transactions are executed in submission order by one thread, which is
+ * based on @ref core_event.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous SPI transaction API
+ */
+
+#ifndef SPI_ASYNC_H
+#define SPI_ASYNC_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "kernel_types.h"
+#include "periph/gpio.h"
+#include "periph/spi.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Priority of the SPI worker thread
+ */
+#ifndef SPI_ASYNC_PRIO
+#define SPI_ASYNC_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#endif
+
+/**
+ * @brief   Stack size of the SPI worker thread
+ *
+ * Transaction callbacks run on this stack.
+ */
+#ifndef SPI_ASYNC_STACKSIZE
+#define SPI_ASYNC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Thread flag set on the submitter of a transaction without
+ *          callback on completion
+ */
+#ifndef SPI_ASYNC_THREAD_FLAG
+#define SPI_ASYNC_THREAD_FLAG   (0x1 << 11)
+#endif
+
+/**
+ * @brief   Flags of an operation
+ * @{
+ */
+#define SPI_ASYNC_REG_ACCESS    (0x01)  /**< transfer to/from spi_async_op_t::reg */
+#define SPI_ASYNC_CONT          (0x02)  /**< keep chip select asserted */
+/** @} */
+
+/**
+ * @brief   One operation of a transaction
+ */
+typedef struct {
+    const uint8_t *out;     /**< data to send, NULL to send zeros */
+    uint8_t *in;            /**< buffer for received data, may be NULL */
+    uint16_t len;           /**< number of bytes to transfer */
+    uint8_t reg;            /**< register address, see @ref SPI_ASYNC_REG_ACCESS */
+    uint8_t flags;          /**< flags of the operation */
+} spi_async_op_t;
+
+/**
+ * @brief   Initializer for a register access operation
+ *
+ * @param[in] _reg  register address (including read/write bits of the device)
+ * @param[in] _out  data to send, may be NULL
+ * @param[in] _in   buffer for received data, may be NULL
+ * @param[in] _len  number of bytes to transfer
+ */
+#define SPI_ASYNC_REG(_reg, _out, _in, _len) \
+    { (_out), (_in), (_len), (_reg), SPI_ASYNC_REG_ACCESS }
+
+/**
+ * @brief   Initializer for a plain transfer operation
+ *
+ * @param[in] _out      data to send, may be NULL
+ * @param[in] _in       buffer for received data, may be NULL
+ * @param[in] _len      number of bytes to transfer
+ * @param[in] _flags    flags of the operation (e.g. @ref SPI_ASYNC_CONT)
+ */
+#define SPI_ASYNC_BYTES(_out, _in, _len, _flags) \
+    { (_out), (_in), (_len), 0, (_flags) }
+
+/**
+ * @brief   Transaction type
+ */
+typedef struct spi_async spi_async_t;
+
+/**
+ * @brief   Completion callback of a transaction
+ *
+ * Runs in the context of the SPI worker thread. The transaction may be
+ * submitted again from the callback.
+ *
+ * @param[in] trans The completed transaction
+ * @param[in] arg   User argument
+ */
+typedef void (*spi_async_cb_t)(spi_async_t *trans, void *arg);
+
+/**
+ * @brief   Transaction structure
+ *
+ * @note    Use spi_async_setup() to initialize it.
+ */
+struct spi_async {
+    event_t event;                  /**< queue entry of the worker thread */
+    const spi_async_op_t *ops;      /**< operations of the transaction */
+    unsigned ops_numof;             /**< number of operations */
+    spi_t dev;                      /**< SPI device */
+    gpio_t cs;                      /**< chip select pin, GPIO_UNDEF for none */
+    spi_async_cb_t cb;              /**< completion callback, may be NULL */
+    void *arg;                      /**< argument of spi_async_t::cb */
+    thread_t *thread;               /**< thread to notify if there is no callback */
+    volatile int res;               /**< result, see spi_async_result() */
+};
+
+/**
+ * @brief   Starts the SPI worker thread, if not already running
+ *
+ * Drivers using this module call this function during their initialization.
+ *
+ * @return  PID of the SPI worker thread
+ */
+kernel_pid_t spi_async_init(void);
+
+/**
+ * @brief   Initializes a transaction
+ *
+ * @param[out] trans    The transaction
+ * @param[in] dev       SPI device, must be initialized in master mode
+ * @param[in] cs        Chip select pin, GPIO_UNDEF if not needed
+ * @param[in] ops       Operations of the transaction, must stay valid until
+ *                      the transaction completed
+ * @param[in] ops_numof Number of operations in @p ops
+ * @param[in] cb        Completion callback, NULL to be notified by
+ *                      @ref SPI_ASYNC_THREAD_FLAG
+ * @param[in] arg       Argument of @p cb
+ */
+void spi_async_setup(spi_async_t *trans, spi_t dev, gpio_t cs,
+                     const spi_async_op_t *ops, unsigned ops_numof,
+                     spi_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queues a transaction for execution
+ *
+ * Can be called from interrupt context, if the transaction has a callback.
+ *
+ * @param[in] trans An initialized transaction
+ *
+ * @return  0, on success
+ * @return  -EBUSY, if @p trans is still pending
+ */
+int spi_async_submit(spi_async_t *trans);
+
+/**
+ * @brief   Checks if a transaction completed
+ *
+ * @param[in] trans A transaction
+ *
+ * @return  true, if @p trans is not pending
+ */
+static inline bool spi_async_done(const spi_async_t *trans)
+{
+    return (trans->res != -EINPROGRESS);
+}
+
+/**
+ * @brief   Gets the result of a completed transaction
+ *
+ * @param[in] trans A transaction
+ *
+ * @return  Number of bytes transferred, excluding register addresses
+ * @return  -EIO, if an operation failed. The following operations were
+ *          skipped.
+ * @return  -EINPROGRESS, if @p trans is still pending
+ */
+static inline int spi_async_result(const spi_async_t *trans)
+{
+    return trans->res;
+}
+
+/**
+ * @brief   Waits for a transaction without callback to complete
+ *
+ * Must be called by the thread that submitted @p trans.
+ *
+ * @param[in] trans A submitted transaction
+ *
+ * @return  spi_async_result() of @p trans
+ */
+int spi_async_wait(spi_async_t *trans);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPI_ASYNC_H */
+/** @} */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_uart_async Buffered UART transmission
+ * @ingroup     drivers_periph_uart
+ * @brief       Non-blocking UART writes through a TX ring buffer
+ *
+ * uart_write() returns only after all bytes were sent, which stalls the
+ * caller for the full transmission time (about 87us per byte at 115200
+ * baud). uart_write_async() instead copies the data into a per-UART ring
+ * buffer and returns; the buffer is drained by the TX-empty (or DMA
+ * completion) interrupt of the UART.
+ *
+ * When the buffer is full, the remaining bytes are either dropped and
+ * counted (@ref UART_ASYNC_DROP) or the caller waits for space
+ * (@ref UART_ASYNC_BLOCK). Callers in interrupt context never wait. Data
+ * still buffered when the system halts (e.g. in core_panic()) is lost.
+ *
+ * The interrupt driven mode needs the `periph_uart_txirq` feature, i.e. a
+ * CPU implementing uart_txirq_start() and draining the buffer with
+ * uart_async_tx_span() and uart_async_tx_commit() from its TX interrupt.
+ * Without it, uart_write_async() falls back to the blocking uart_write() and
+ * no buffer memory is allocated.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Buffered UART transmission API
+ */
+
+#ifndef UART_ASYNC_H
+#define UART_ASYNC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "periph/uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the TX buffer of each UART, must be a power of 2
+ */
+#ifndef UART_ASYNC_BUFSIZE
+#define UART_ASYNC_BUFSIZE      (128U)
+#endif
+
+/**
+ * @brief   Thread flag used to wake threads waiting for space in a TX buffer
+ */
+#ifndef UART_ASYNC_THREAD_FLAG
+#define UART_ASYNC_THREAD_FLAG  (0x1 << 10)
+#endif
+
+/**
+ * @name    Policies for writes to a full TX buffer
+ * @{
+ */
+#define UART_ASYNC_DROP         (0)     /**< drop the remaining bytes */
+#define UART_ASYNC_BLOCK        (1)     /**< wait until all bytes fit */
+/** @} */
+
+/**
+ * @brief   Initializes the TX buffer of a UART
+ *
+ * Call this before the first uart_write_async() to @p uart.
+ *
+ * @param[in] uart      UART device
+ * @param[in] policy    @ref UART_ASYNC_DROP or @ref UART_ASYNC_BLOCK
+ */
+void uart_async_init(uart_t uart, int policy);
+
+/**
+ * @brief   Queues data for transmission
+ *
+ * May be called from interrupt context and by several threads at once;
+ * the data of concurrent writers may be interleaved when the buffer runs
+ * full.
+ *
+ * @param[in] uart      UART device
+ * @param[in] data      data to send
+ * @param[in] len       number of bytes to send
+ *
+ * @return  number of bytes queued, smaller than @p len if bytes were dropped
+ */
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Waits until all queued data of a UART is sent
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in] uart      UART device
+ */
+void uart_async_flush(uart_t uart);
+
+/**
+ * @brief   Gets the number of bytes dropped because the TX buffer was full
+ *
+ * @param[in] uart      UART device
+ *
+ * @return  number of dropped bytes since uart_async_init()
+ */
+unsigned uart_async_dropped(uart_t uart);
+
+/**
+ * @name    CPU interface
+ * @{
+ */
+/**
+ * @brief   Starts draining the TX buffer of a UART
+ *
+ * Implemented by CPUs providing the `periph_uart_txirq` feature, called
+ * after data was queued. Usually this enables the TX-empty interrupt. Must
+ * not have any effect if a transmission is already running.
+ *
+ * @param[in] uart      UART device
+ */
+void uart_txirq_start(uart_t uart);
+
+/**
+ * @brief   Gets the contiguous queued data of a UART
+ *
+ * Called by the TX interrupt of the CPU, which disables the interrupt once
+ * no data is left.
+ *
+ * @param[in] uart      UART device
+ * @param[out] data     start of the data
+ *
+ * @return  number of bytes at @p data, 0 if the buffer is empty
+ */
+unsigned uart_async_tx_span(uart_t uart, char **data);
+
+/**
+ * @brief   Releases sent data from the TX buffer of a UART
+ *
+ * @param[in] uart      UART device
+ * @param[in] n         number of bytes sent, at most the last span
+ */
+void uart_async_tx_commit(uart_t uart, unsigned n);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UART_ASYNC_H */
+/** @} */
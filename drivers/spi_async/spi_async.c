@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_spi_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous SPI transaction implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "irq.h"
+#include "spi_async.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static event_queue_t _queue = EVENT_QUEUE_INIT;
+
+#if ENABLE_DEBUG
+static char _stack[SPI_ASYNC_STACKSIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
+#else
+static char _stack[SPI_ASYNC_STACKSIZE];
+#endif
+
+static inline void _cs(gpio_t cs, int active)
+{
+    if (cs != GPIO_UNDEF) {
+        if (active) {
+            gpio_clear(cs);
+        }
+        else {
+            gpio_set(cs);
+        }
+    }
+}
+
+static int _run(spi_async_t *trans)
+{
+    int res = 0;
+    int cs_active = 0;
+
+    spi_acquire(trans->dev);
+    for (unsigned i = 0; i < trans->ops_numof; i++) {
+        const spi_async_op_t *op = &trans->ops[i];
+        int tmp;
+
+        if (!cs_active) {
+            _cs(trans->cs, 1);
+            cs_active = 1;
+        }
+        if (op->flags & SPI_ASYNC_REG_ACCESS) {
+            tmp = spi_transfer_regs(trans->dev, op->reg, (char *)op->out,
+                                    (char *)op->in, op->len);
+        }
+        else {
+            tmp = spi_transfer_bytes(trans->dev, (char *)op->out,
+                                     (char *)op->in, op->len);
+        }
+        if (tmp < 0) {
+            DEBUG("spi_async: operation %u of %p failed\n", i, (void *)trans);
+            res = -EIO;
+            break;
+        }
+        res += tmp;
+        if (!(op->flags & SPI_ASYNC_CONT)) {
+            _cs(trans->cs, 0);
+            cs_active = 0;
+        }
+    }
+    if (cs_active) {
+        _cs(trans->cs, 0);
+    }
+    spi_release(trans->dev);
+
+    return res;
+}
+
+static void _handler(event_t *event)
+{
+    spi_async_t *trans = (spi_async_t *)event;
+    int res = _run(trans);
+    /* the transaction may be reused as soon as its result is set */
+    spi_async_cb_t cb = trans->cb;
+    void *arg = trans->arg;
+    thread_t *thread = trans->thread;
+
+    DEBUG("spi_async: %p done (%d)\n", (void *)trans, res);
+    trans->res = res;
+    if (cb) {
+        cb(trans, arg);
+    }
+    else if (thread) {
+        thread_flags_set(thread, SPI_ASYNC_THREAD_FLAG);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    /* never reached */
+    return NULL;
+}
+
+kernel_pid_t spi_async_init(void)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), SPI_ASYNC_PRIO,
+                             THREAD_CREATE_STACKTEST, _worker, NULL,
+                             "spi_async");
+    }
+    return _pid;
+}
+
+void spi_async_setup(spi_async_t *trans, spi_t dev, gpio_t cs,
+                     const spi_async_op_t *ops, unsigned ops_numof,
+                     spi_async_cb_t cb, void *arg)
+{
+    assert(trans && (ops || !ops_numof));
+
+    trans->event.list_node.next = NULL;
+    trans->event.handler = _handler;
+    trans->ops = ops;
+    trans->ops_numof = ops_numof;
+    trans->dev = dev;
+    trans->cs = cs;
+    trans->cb = cb;
+    trans->arg = arg;
+    trans->thread = NULL;
+    trans->res = 0;
+}
+
+int spi_async_submit(spi_async_t *trans)
+{
+    assert(_pid != KERNEL_PID_UNDEF);
+
+    unsigned state = irq_disable();
+    if (trans->res == -EINPROGRESS) {
+        irq_restore(state);
+        return -EBUSY;
+    }
+    trans->res = -EINPROGRESS;
+    trans->thread = (trans->cb) ? NULL : (thread_t *)sched_active_thread;
+    irq_restore(state);
+
+    event_post(&_queue, &trans->event);
+    return 0;
+}
+
+int spi_async_wait(spi_async_t *trans)
+{
+    assert(trans->cb == NULL);
+
+    while (!spi_async_done(trans)) {
+        thread_flags_wait_any(SPI_ASYNC_THREAD_FLAG);
+    }
+    return trans->res;
+}
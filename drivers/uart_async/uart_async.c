@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_uart_async
+ * @{
+ *
+ * @file
+ * @brief       Buffered UART transmission implementation
+ *
+ * @}
+ */
+
+#include "uart_async.h"
+
+#ifdef FEATURE_PERIPH_UART_TXIRQ
+
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+
+typedef struct waiter {
+    struct waiter *next;                /**< next waiting thread */
+    thread_t *thread;                   /**< the waiting thread */
+} _waiter_t;
+
+typedef struct {
+    tsrb_t buf;                         /**< TX ring buffer */
+    _waiter_t *waiters;                 /**< threads waiting for sent data */
+    unsigned dropped;                   /**< number of dropped bytes */
+    int policy;                         /**< policy on full buffer */
+    char mem[UART_ASYNC_BUFSIZE];       /**< memory of the ring buffer */
+} _tx_t;
+
+static _tx_t _tx[UART_NUMOF];
+
+/* must be called with interrupts disabled, wait with _wait() afterwards */
+static inline void _enqueue(_tx_t *tx, _waiter_t *w)
+{
+    w->thread = (thread_t *)sched_active_thread;
+    w->next = tx->waiters;
+    tx->waiters = w;
+}
+
+static inline void _wait(void)
+{
+    thread_flags_wait_any(UART_ASYNC_THREAD_FLAG);
+}
+
+void uart_async_init(uart_t uart, int policy)
+{
+    _tx_t *tx = &_tx[uart];
+
+    tsrb_init(&tx->buf, tx->mem, UART_ASYNC_BUFSIZE);
+    tx->waiters = NULL;
+    tx->dropped = 0;
+    tx->policy = policy;
+}
+
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    _tx_t *tx = &_tx[uart];
+    int block = (tx->policy == UART_ASYNC_BLOCK) && !irq_is_in();
+    size_t done = 0;
+    _waiter_t w;
+
+    while (1) {
+        /* tsrb allows only one producer */
+        unsigned state = irq_disable();
+        done += tsrb_add(&tx->buf, (const char *)data + done, len - done);
+        if ((done < len) && block) {
+            /* enqueued before the TX interrupt can free space, so its
+             * wake-up is not lost */
+            _enqueue(tx, &w);
+        }
+        irq_restore(state);
+        uart_txirq_start(uart);
+
+        if (done == len) {
+            break;
+        }
+        if (!block) {
+            tx->dropped += len - done;
+            break;
+        }
+        _wait();
+    }
+    return done;
+}
+
+void uart_async_flush(uart_t uart)
+{
+    _tx_t *tx = &_tx[uart];
+    _waiter_t w;
+
+    while (1) {
+        unsigned state = irq_disable();
+        int empty = tsrb_empty(&tx->buf);
+
+        if (!empty) {
+            _enqueue(tx, &w);
+        }
+        irq_restore(state);
+        if (empty) {
+            break;
+        }
+        _wait();
+    }
+}
+
+unsigned uart_async_dropped(uart_t uart)
+{
+    return _tx[uart].dropped;
+}
+
+unsigned uart_async_tx_span(uart_t uart, char **data)
+{
+    return tsrb_read_span(&_tx[uart].buf, data);
+}
+
+void uart_async_tx_commit(uart_t uart, unsigned n)
+{
+    _tx_t *tx = &_tx[uart];
+    unsigned state;
+    _waiter_t *w;
+
+    tsrb_read_commit(&tx->buf, n);
+    /* wake all waiters, each checks again if its data fits now */
+    state = irq_disable();
+    w = tx->waiters;
+    tx->waiters = NULL;
+    irq_restore(state);
+    while (w) {
+        /* w is gone once its thread runs */
+        _waiter_t *next = w->next;
+
+        thread_flags_set(w->thread, UART_ASYNC_THREAD_FLAG);
+        w = next;
+    }
+}
+
+#else /* FEATURE_PERIPH_UART_TXIRQ */
+
+void uart_async_init(uart_t uart, int policy)
+{
+    (void)uart;
+    (void)policy;
+}
+
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    uart_write(uart, data, len);
+    return len;
+}
+
+void uart_async_flush(uart_t uart)
+{
+    (void)uart;
+}
+
+unsigned uart_async_dropped(uart_t uart)
+{
+    (void)uart;
+    return 0;
+}
+
+#endif /* FEATURE_PERIPH_UART_TXIRQ */
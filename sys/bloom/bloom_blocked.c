@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_bloom_blocked
+ * @{
+ *
+ * @file
+ * @brief       Blocked Bloom filter implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "bloom_blocked.h"
+
+#define BLOCK_BYTES     (BLOOM_BLOCKED_BLOCK_BITS / 8)
+#define BIT_MASK        (BLOOM_BLOCKED_BLOCK_BITS - 1)
+
+/* 64-bit FNV-1a with the finalizer of MurmurHash3, so both halves of the
+ * result are well mixed */
+static uint64_t _hash(const uint8_t *buf, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < len; i++) {
+        h ^= buf[i];
+        h *= 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static inline uint8_t *_block(const bloom_blocked_t *bloom, uint64_t h)
+{
+    return bloom->a + (((uint32_t)h & bloom->block_mask) * BLOCK_BYTES);
+}
+
+/* the probes within the block are a + i * b; b is odd, so the k probes are
+ * distinct */
+static inline uint16_t _probe_a(uint64_t h)
+{
+    return (uint16_t)(h >> 32) & BIT_MASK;
+}
+
+static inline uint16_t _probe_b(uint64_t h)
+{
+    return ((uint16_t)(h >> 48) & BIT_MASK) | 1;
+}
+
+static void _add(const bloom_blocked_t *bloom, uint64_t h)
+{
+    uint8_t *block = _block(bloom, h);
+    uint16_t bit = _probe_a(h), step = _probe_b(h);
+
+    for (unsigned i = 0; i < bloom->k; i++) {
+        bf_set(block, bit);
+        bit = (bit + step) & BIT_MASK;
+    }
+}
+
+static bool _check(const bloom_blocked_t *bloom, uint64_t h)
+{
+    uint8_t *block = _block(bloom, h);
+    uint16_t bit = _probe_a(h), step = _probe_b(h);
+
+    for (unsigned i = 0; i < bloom->k; i++) {
+        if (!bf_isset(block, bit)) {
+            return false;
+        }
+        bit = (bit + step) & BIT_MASK;
+    }
+    return true;
+}
+
+void bloom_blocked_init(bloom_blocked_t *bloom, size_t size, uint8_t *bitfield,
+                        unsigned k)
+{
+    size_t blocks = size / BLOOM_BLOCKED_BLOCK_BITS;
+
+    assert(blocks && !(blocks & (blocks - 1)) &&
+           (blocks * BLOOM_BLOCKED_BLOCK_BITS == size));
+    assert(k && (k <= BLOOM_BLOCKED_K_MAX));
+
+    bloom->a = bitfield;
+    bloom->block_mask = blocks - 1;
+    bloom->k = k;
+    bloom_blocked_clear(bloom);
+}
+
+void bloom_blocked_clear(bloom_blocked_t *bloom)
+{
+    memset(bloom->a, 0, (bloom->block_mask + 1) * BLOCK_BYTES);
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len)
+{
+    _add(bloom, _hash(buf, len));
+}
+
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len)
+{
+    return _check(bloom, _hash(buf, len));
+}
+
+void bloom_aging_init(bloom_aging_t *bloom, size_t size, uint8_t *bitfield,
+                      unsigned k, uint32_t limit)
+{
+    bloom_blocked_init(&bloom->gen[0], size, bitfield, k);
+    bloom_blocked_init(&bloom->gen[1], size, bitfield + (size / 8), k);
+    bloom->count = 0;
+    bloom->limit = limit;
+    bloom->active = 0;
+}
+
+static void _aging_add(bloom_aging_t *bloom, uint64_t h)
+{
+    if (bloom->count >= bloom->limit) {
+        /* the older generation is forgotten */
+        bloom->active ^= 1;
+        bloom_blocked_clear(&bloom->gen[bloom->active]);
+        bloom->count = 0;
+    }
+    _add(&bloom->gen[bloom->active], h);
+    bloom->count++;
+}
+
+static inline bool _aging_check(const bloom_aging_t *bloom, uint64_t h)
+{
+    return _check(&bloom->gen[0], h) || _check(&bloom->gen[1], h);
+}
+
+void bloom_aging_add(bloom_aging_t *bloom, const uint8_t *buf, size_t len)
+{
+    _aging_add(bloom, _hash(buf, len));
+}
+
+bool bloom_aging_check(const bloom_aging_t *bloom, const uint8_t *buf,
+                       size_t len)
+{
+    return _aging_check(bloom, _hash(buf, len));
+}
+
+bool bloom_aging_check_add(bloom_aging_t *bloom, const uint8_t *buf,
+                           size_t len)
+{
+    uint64_t h = _hash(buf, len);
+
+    if (_aging_check(bloom, h)) {
+        return true;
+    }
+    _aging_add(bloom, h);
+    return false;
+}
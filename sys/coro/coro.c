@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_coro
+ * @{
+ *
+ * @file
+ * @brief       Coroutine scheduler implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "thread.h"
+#include "utlist.h"
+
+#include "coro.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+void coro_init(coro_t *coro, coro_func_t func, void *arg)
+{
+    assert(coro && func);
+    coro->next = NULL;
+    coro->func = func;
+    coro->arg = arg;
+    coro->msg = NULL;
+    coro->lc = 0;
+    coro->taken = false;
+    memset(&coro->timer, 0, sizeof(coro->timer));
+}
+
+static int _resume(coro_t *coro, msg_t *msg)
+{
+    coro->msg = msg;
+    coro->taken = false;
+    int res = coro->func(coro);
+    if (res == CORO_EXITED) {
+        DEBUG("coro: %p exited\n", (void *)coro);
+        xtimer_remove(&coro->timer);
+    }
+    return res;
+}
+
+int coro_start(coro_sched_t *sched, coro_t *coro)
+{
+    /* a coroutine started from another coroutine is offered the current
+     * message only from the next dispatch on */
+    if (_resume(coro, NULL) == CORO_EXITED) {
+        return CORO_EXITED;
+    }
+    LL_PREPEND(sched->list, coro);
+    return CORO_WAITING;
+}
+
+bool coro_sched_dispatch(coro_sched_t *sched, msg_t *msg)
+{
+    coro_t *coro, *tmp;
+
+    /* timeouts are only offered to their coroutine */
+    if (msg->type == CORO_MSG_TYPE_TIMEOUT) {
+        LL_FOREACH(sched->list, coro) {
+            if (coro == msg->content.ptr) {
+                break;
+            }
+        }
+        if (coro == NULL) {
+            DEBUG("coro: stale timeout for %p\n", msg->content.ptr);
+            return false;
+        }
+        if (_resume(coro, msg) == CORO_EXITED) {
+            LL_DELETE(sched->list, coro);
+        }
+        return true;
+    }
+    LL_FOREACH_SAFE(sched->list, coro, tmp) {
+        int res = _resume(coro, msg);
+        bool taken = coro->taken;
+
+        if (res == CORO_EXITED) {
+            LL_DELETE(sched->list, coro);
+        }
+        if (taken) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void coro_cancel(coro_sched_t *sched, coro_t *coro)
+{
+    xtimer_remove(&coro->timer);
+    LL_DELETE(sched->list, coro);
+    coro->lc = 0;
+}
+
+void coro_set_timeout(coro_t *coro, uint32_t usec)
+{
+    coro->timeout_msg.type = CORO_MSG_TYPE_TIMEOUT;
+    coro->timeout_msg.content.ptr = coro;
+    xtimer_set_msg(&coro->timer, usec, &coro->timeout_msg, thread_getpid());
+}
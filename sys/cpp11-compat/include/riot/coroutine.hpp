@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   C++ wrapper for @ref sys_coro
+ *
+ * Requires module `coro`.
+ *
+ * C++11 has no language support for coroutines, so the body of a coroutine
+ * is written with the macros of @ref sys_coro in the overridden
+ * riot::coroutine::run():
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.cpp}
+ * class echo : public riot::coroutine {
+ *  protected:
+ *   int run(coro_t *c) override {
+ *     CORO_BEGIN(c);
+ *     while (true) {
+ *       set_timeout(std::chrono::seconds(1));
+ *       CORO_RECEIVE(c, c->msg->type == MY_MSG_TYPE);
+ *       if (timed_out()) {
+ *         break;
+ *       }
+ *       handle(*c->msg);
+ *     }
+ *     CORO_END(c);
+ *   }
+ * };
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#ifndef RIOT_COROUTINE_HPP
+#define RIOT_COROUTINE_HPP
+
+#include "coro.h"
+
+#include <chrono>
+
+namespace riot {
+
+/**
+ * @brief Base class for coroutines, see @ref sys_coro
+ */
+class coroutine {
+ public:
+  inline coroutine() { coro_init(&m_coro, trampoline, this); }
+  virtual ~coroutine() { coro_remove_timeout(&m_coro); }
+
+  inline coro_t* native_handle() { return &m_coro; }
+
+ protected:
+  /**
+   * @brief Body of the coroutine, see @ref coro_func_t
+   */
+  virtual int run(coro_t* c) = 0;
+
+  /**
+   * @brief (Re-)sets the timeout of the coroutine
+   */
+  template <class Rep, class Period>
+  void set_timeout(const std::chrono::duration<Rep, Period>& timeout) {
+    using namespace std::chrono;
+    coro_set_timeout(&m_coro,
+                     static_cast<uint32_t>(duration_cast<microseconds>(timeout).count()));
+  }
+
+  /**
+   * @brief Removes the timeout of the coroutine
+   */
+  inline void remove_timeout() { coro_remove_timeout(&m_coro); }
+
+  /**
+   * @brief Checks if the current message is the timeout of the coroutine
+   */
+  inline bool timed_out() const { return coro_timed_out(&m_coro); }
+
+ private:
+  coroutine(const coroutine&);
+  coroutine& operator=(const coroutine&);
+
+  static int trampoline(coro_t* c) {
+    return static_cast<coroutine*>(c->arg)->run(c);
+  }
+
+  coro_t m_coro;
+};
+
+/**
+ * @brief Runs coroutines on the calling thread, see @ref coro_sched_t
+ */
+class coroutine_scheduler {
+ public:
+  inline coroutine_scheduler() : m_sched{nullptr} {}
+
+  /**
+   * @brief Starts a coroutine, see coro_start()
+   */
+  inline int start(coroutine& c) {
+    return coro_start(&m_sched, c.native_handle());
+  }
+
+  /**
+   * @brief Offers a message to the coroutines, see coro_sched_dispatch()
+   */
+  inline bool dispatch(msg_t& msg) { return coro_sched_dispatch(&m_sched, &msg); }
+
+  /**
+   * @brief Stops a coroutine, see coro_cancel()
+   */
+  inline void cancel(coroutine& c) { coro_cancel(&m_sched, c.native_handle()); }
+
+  /**
+   * @brief Checks if no coroutine is running
+   */
+  inline bool idle() const { return coro_sched_idle(&m_sched); }
+
+  /**
+   * @brief Receives and dispatches messages until all coroutines finished
+   */
+  void run() {
+    msg_t msg;
+    while (!idle()) {
+      msg_receive(&msg);
+      dispatch(msg);
+    }
+  }
+
+ private:
+  coro_sched_t m_sched;
+};
+
+} // namespace riot
+
+#endif // RIOT_COROUTINE_HPP
+/** @} */
@@ -22,7 +22,6 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <unistd.h>
-#include <string.h>
 
 #ifdef __WITH_AVRLIBC__
 #include <stdio.h>  /* for fwrite() */
@@ -84,23 +83,87 @@ size_t fmt_str(char *out, const char *str)
     return len;
 }
 
+/* Converts the four nibbles of val to hex digits, most significant first.
+ * The nibbles are spread to the bytes of a word, which are then converted
+ * all at once: lanes > 9 get the offset from '9' + 1 to 'A' added. */
+static inline void _hex4(char *out, uint16_t val)
+{
+    uint32_t x = ((val >> 12) & 0xf) | ((uint32_t)val & 0xf00) |
+                 (((uint32_t)val << 12) & 0xf0000) |
+                 (((uint32_t)val << 24) & 0xf000000);
+
+    x += 0x30303030 + ((((x + 0x06060606) >> 4) & 0x01010101) * 7);
+    out[0] = (char)x;
+    out[1] = (char)(x >> 8);
+    out[2] = (char)(x >> 16);
+    out[3] = (char)(x >> 24);
+}
+
+size_t fmt_bytes_hex(char *out, const uint8_t *ptr, size_t n)
+{
+    if (out) {
+        size_t i = 0;
+        for (; (i + 1) < n; i += 2) {
+            _hex4(out, (ptr[i] << 8) | ptr[i + 1]);
+            out += 4;
+        }
+        if (i < n) {
+            fmt_byte_hex(out, ptr[i]);
+        }
+    }
+    return (n << 1);
+}
+
 size_t fmt_bytes_hex_reverse(char *out, const uint8_t *ptr, size_t n)
 {
-    size_t i = n;
-    while (i--) {
-        out += fmt_byte_hex(out, ptr[i]);
+    if (out) {
+        size_t i = n;
+        for (; i > 1; i -= 2) {
+            _hex4(out, (ptr[i - 1] << 8) | ptr[i - 2]);
+            out += 4;
+        }
+        if (i) {
+            fmt_byte_hex(out, ptr[0]);
+        }
     }
-    return (n<<1);
+    return (n << 1);
 }
 
 size_t fmt_u32_hex(char *out, uint32_t val)
 {
-    return fmt_bytes_hex_reverse(out, (uint8_t*) &val, 4);
+    if (out) {
+        _hex4(out, val >> 16);
+        _hex4(out + 4, val);
+    }
+    return 8;
 }
 
 size_t fmt_u64_hex(char *out, uint64_t val)
 {
-    return fmt_bytes_hex_reverse(out, (uint8_t*) &val, 8);
+    if (out) {
+        fmt_u32_hex(out, val >> 32);
+        fmt_u32_hex(out + 8, val);
+    }
+    return 16;
+}
+
+/* Writes the two digits of val < 100. val * 103 >> 10 equals val / 10 in
+ * this range, so no division is needed. */
+static inline void _dec2(char *out, unsigned val)
+{
+    unsigned tens = (val * 103) >> 10;
+
+    out[0] = '0' + tens;
+    out[1] = '0' + (val - (tens * 10));
+}
+
+/* writes the four digits of val < 10000, including leading zeros */
+static inline void _dec4(char *out, unsigned val)
+{
+    unsigned hi = (val * 5243) >> 19;   /* val / 100 */
+
+    _dec2(out, hi);
+    _dec2(out + 2, val - (hi * 100));
 }
 
 size_t fmt_u64_dec(char *out, uint64_t val)
@@ -143,13 +206,9 @@ size_t fmt_u64_dec(char *out, uint64_t val)
 
     if (out) {
         out += len;
-        memset(out, '0', total_len - len);
-        while(first) {
+        while (first) {
             first--;
-            if (d[first]) {
-                size_t tmp = fmt_u32_dec(NULL, d[first]);
-                fmt_u32_dec(out+(4-tmp), d[first]);
-            }
+            _dec4(out, d[first]);
             out += 4;
         }
     }
@@ -162,15 +221,25 @@ size_t fmt_u32_dec(char *out, uint32_t val)
     size_t len = 1;
 
     /* count needed characters */
-    for (uint32_t tmp = val; (tmp > 9); len++) {
-        tmp /= 10;
+    for (uint32_t pow = 10; (len < 10) && (val >= pow); pow *= 10) {
+        len++;
     }
 
     if (out) {
+        /* two digits per division */
         char *ptr = out + len;
-        do {
-            *--ptr = (val % 10) + '0';
-        } while ((val /= 10));
+        while (val >= 100) {
+            uint32_t q = val / 100;
+            ptr -= 2;
+            _dec2(ptr, val - (q * 100));
+            val = q;
+        }
+        if (val >= 10) {
+            _dec2(ptr - 2, val);
+        }
+        else {
+            ptr[-1] = '0' + val;
+        }
     }
 
     return len;
@@ -305,7 +374,7 @@ void print_u64_hex(uint64_t val)
 
 void print_u64_dec(uint64_t val)
 {
-    char buf[18];
+    char buf[20];
     size_t len = fmt_u64_dec(buf, val);
     print(buf, len);
 }
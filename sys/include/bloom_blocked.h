@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_bloom_blocked Blocked Bloom filter
+ * @ingroup     sys_bloom
+ * @brief       Cache-friendly Bloom filter with one hash per key
+ *
+ * The bit array is split into blocks of @ref BLOOM_BLOCKED_BLOCK_BITS bits
+ * (one 64 byte cache line). A key is hashed once into 64 bits: the lower half
+ * selects the block, the upper half derives all probes within that block by
+ * double hashing (g_i = a + i * b, see Kirsch and Mitzenmacher, "Less
+ * Hashing, Same Performance: Building a Better Bloom Filter"). Adding or
+ * checking a key thus costs one pass over the key and touches one block,
+ * whereas @ref sys_bloom runs k hash functions and touches up to k random
+ * locations. The number of blocks is a power of 2, so no division is needed.
+ *
+ * Confining the probes of a key to one block slightly raises the false
+ * positive rate compared to a classic filter of the same size.
+ *
+ * The aging filter (@ref bloom_aging_t) keeps two blocked filters of the
+ * same geometry to remember the keys of a sliding window, e.g. for
+ * duplicate suppression: keys are added to the active filter and checked
+ * against both. Once the active filter holds its limit of keys, the other
+ * one is cleared and becomes the active one, so keys are remembered for at
+ * least `limit` and at most `2 * limit` insertions.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Blocked Bloom filter API
+ */
+
+#ifndef BLOOM_BLOCKED_H
+#define BLOOM_BLOCKED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bits in one block
+ */
+#define BLOOM_BLOCKED_BLOCK_BITS    (512U)
+
+/**
+ * @brief   Maximum number of probes per key
+ */
+#define BLOOM_BLOCKED_K_MAX         (16U)
+
+/**
+ * @brief   Blocked Bloom filter
+ */
+typedef struct {
+    uint8_t *a;             /**< the bit array */
+    uint32_t block_mask;    /**< number of blocks - 1 */
+    uint8_t k;              /**< number of probes per key */
+} bloom_blocked_t;
+
+/**
+ * @brief   Aging Bloom filter over a sliding window of keys
+ */
+typedef struct {
+    bloom_blocked_t gen[2]; /**< the two generations */
+    uint32_t count;         /**< keys added to the active generation */
+    uint32_t limit;         /**< keys per generation */
+    uint8_t active;         /**< index of the active generation */
+} bloom_aging_t;
+
+/**
+ * @brief   Initializes a blocked Bloom filter and clears its bit array
+ *
+ * @param[out] bloom    The filter
+ * @param[in] size      Size of the filter in bits. Must be
+ *                      @ref BLOOM_BLOCKED_BLOCK_BITS times a power of 2.
+ * @param[in] bitfield  The bit array of @p size bits, ideally aligned to
+ *                      64 bytes
+ * @param[in] k         Number of probes per key, 1 to
+ *                      @ref BLOOM_BLOCKED_K_MAX
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, size_t size, uint8_t *bitfield,
+                        unsigned k);
+
+/**
+ * @brief   Removes all keys from a blocked Bloom filter
+ *
+ * @param[in] bloom     The filter
+ */
+void bloom_blocked_clear(bloom_blocked_t *bloom);
+
+/**
+ * @brief   Adds a key to a blocked Bloom filter
+ *
+ * @param[in] bloom     The filter
+ * @param[in] buf       The key
+ * @param[in] len       Length of @p buf
+ */
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Checks if a key may be in a blocked Bloom filter
+ *
+ * @param[in] bloom     The filter
+ * @param[in] buf       The key
+ * @param[in] len       Length of @p buf
+ *
+ * @return  false, if @p buf is not in the filter
+ * @return  true, if @p buf may be in the filter
+ */
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len);
+
+/**
+ * @brief   Initializes an aging Bloom filter
+ *
+ * @param[out] bloom    The filter
+ * @param[in] size      Size of each generation in bits, see
+ *                      bloom_blocked_init()
+ * @param[in] bitfield  Bit array of 2 * @p size bits
+ * @param[in] k         Number of probes per key
+ * @param[in] limit     Number of keys per generation
+ */
+void bloom_aging_init(bloom_aging_t *bloom, size_t size, uint8_t *bitfield,
+                      unsigned k, uint32_t limit);
+
+/**
+ * @brief   Adds a key to an aging Bloom filter
+ *
+ * @param[in] bloom     The filter
+ * @param[in] buf       The key
+ * @param[in] len       Length of @p buf
+ */
+void bloom_aging_add(bloom_aging_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Checks if a key may be in an aging Bloom filter
+ *
+ * @param[in] bloom     The filter
+ * @param[in] buf       The key
+ * @param[in] len       Length of @p buf
+ *
+ * @return  false, if @p buf is not in the filter
+ * @return  true, if @p buf may be in the filter
+ */
+bool bloom_aging_check(const bloom_aging_t *bloom, const uint8_t *buf,
+                       size_t len);
+
+/**
+ * @brief   Checks if a key may be in an aging Bloom filter and adds it if not
+ *
+ * Hashes the key only once, which makes it the function of choice for
+ * duplicate suppression.
+ *
+ * @param[in] bloom     The filter
+ * @param[in] buf       The key
+ * @param[in] len       Length of @p buf
+ *
+ * @return  false, if @p buf was not in the filter and was added
+ * @return  true, if @p buf may already be in the filter
+ */
+bool bloom_aging_check_add(bloom_aging_t *bloom, const uint8_t *buf,
+                           size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOOM_BLOCKED_H */
+/** @} */
@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_coro Coroutines
+ * @ingroup     sys
+ * @brief       Stackless, message driven coroutines
+ *
+ * Coroutines allow several concurrent transactions (e.g. transfers of an
+ * application protocol) to share one thread and thus one stack. They are
+ * written as sequential code, but suspend at every CORO_RECEIVE() until the
+ * thread they are running on receives a message the coroutine is interested
+ * in. A message is offered to every coroutine of a @ref coro_sched_t until
+ * one of them takes it.
+ *
+ * Coroutines are stackless (protothread-style): local variables are
+ * **not** preserved across CORO_RECEIVE(), so keep all state in the struct
+ * the coroutine is embedded in. Also, CORO_RECEIVE() must not be used within
+ * a `switch` statement.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static int _echo(coro_t *c)
+ * {
+ *     CORO_BEGIN(c);
+ *     while (1) {
+ *         coro_set_timeout(c, SEC_IN_USEC);
+ *         CORO_RECEIVE(c, c->msg->type == MY_MSG_TYPE);
+ *         if (coro_timed_out(c)) {
+ *             break;
+ *         }
+ *         coro_remove_timeout(c);
+ *         handle(c->msg);
+ *     }
+ *     CORO_END(c);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Coroutine definitions
+ */
+
+#ifndef CORO_H_
+#define CORO_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Message type of coroutine timeouts
+ */
+#define CORO_MSG_TYPE_TIMEOUT   (0x0a00)
+
+/**
+ * @brief   Return values of coroutine functions
+ * @{
+ */
+#define CORO_WAITING            (0)     /**< coroutine waits for a message */
+#define CORO_EXITED             (1)     /**< coroutine has finished */
+/** @} */
+
+/**
+ * @brief   Coroutine type
+ */
+typedef struct coro coro_t;
+
+/**
+ * @brief   Coroutine function
+ *
+ * Must be enclosed by CORO_BEGIN() and CORO_END().
+ *
+ * @param[in] coro  The coroutine
+ *
+ * @return  @ref CORO_WAITING or @ref CORO_EXITED
+ */
+typedef int (*coro_func_t)(coro_t *coro);
+
+/**
+ * @brief   Coroutine structure
+ */
+struct coro {
+    coro_t *next;           /**< next coroutine of the scheduler */
+    coro_func_t func;       /**< coroutine function */
+    void *arg;              /**< user argument */
+    msg_t *msg;             /**< message currently offered to the coroutine */
+    xtimer_t timer;         /**< timer for coro_set_timeout() */
+    msg_t timeout_msg;      /**< message sent by coro_t::timer */
+    uint16_t lc;            /**< local continuation */
+    bool taken;             /**< coro_t::msg was taken by the coroutine */
+};
+
+/**
+ * @brief   Coroutine scheduler
+ *
+ * Holds the running coroutines of one thread.
+ */
+typedef struct {
+    coro_t *list;           /**< running coroutines */
+} coro_sched_t;
+
+/**
+ * @brief   Static initializer for @ref coro_sched_t
+ */
+#define CORO_SCHED_INIT         { NULL }
+
+/**
+ * @brief   Starts a coroutine function
+ *
+ * @param[in] c     The coroutine
+ */
+#define CORO_BEGIN(c)           switch ((c)->lc) { case 0:
+
+/**
+ * @brief   Ends a coroutine function
+ *
+ * @param[in] c     The coroutine
+ */
+#define CORO_END(c)             } (c)->lc = 0; return CORO_EXITED
+
+/**
+ * @brief   Suspends the coroutine until it receives a message
+ *
+ * The coroutine takes the next message fulfilling @p cond, which may use
+ * coro_t::msg. A timeout of the coroutine (see coro_set_timeout()) is always
+ * taken. After this macro, coro_t::msg is the taken message.
+ *
+ * @param[in] c     The coroutine
+ * @param[in] cond  Condition on coro_t::msg for the message to take
+ */
+#define CORO_RECEIVE(c, cond) \
+    do { \
+        (c)->lc = __LINE__; \
+        if (0) { \
+            /* resumed here, not reached by falling through */ \
+            case __LINE__: ; \
+        } \
+        if (((c)->msg == NULL) || (c)->taken || \
+            (!coro_timed_out(c) && !(cond))) { \
+            return CORO_WAITING; \
+        } \
+        (c)->taken = true; \
+    } while (0)
+
+/**
+ * @brief   Exits the coroutine
+ *
+ * @param[in] c     The coroutine
+ */
+#define CORO_EXIT(c)            do { (c)->lc = 0; return CORO_EXITED; } while (0)
+
+/**
+ * @brief   Initializes a coroutine
+ *
+ * @param[out] coro The coroutine
+ * @param[in] func  The coroutine function
+ * @param[in] arg   User argument, available as coro_t::arg
+ */
+void coro_init(coro_t *coro, coro_func_t func, void *arg);
+
+/**
+ * @brief   Starts a coroutine on the calling thread
+ *
+ * Runs @p coro until it waits for its first message.
+ *
+ * @param[in] sched The scheduler of the calling thread
+ * @param[in] coro  An initialized coroutine
+ *
+ * @return  @ref CORO_WAITING, if @p coro was added to @p sched
+ * @return  @ref CORO_EXITED, if @p coro finished right away
+ */
+int coro_start(coro_sched_t *sched, coro_t *coro);
+
+/**
+ * @brief   Offers a message to the coroutines of a scheduler
+ *
+ * Coroutines that exit are removed from @p sched.
+ *
+ * @param[in] sched The scheduler
+ * @param[in] msg   A message received by the calling thread
+ *
+ * @return  true, if a coroutine took @p msg. The coroutine is then
+ *          responsible for the message's content.
+ * @return  false, if no coroutine took @p msg.
+ */
+bool coro_sched_dispatch(coro_sched_t *sched, msg_t *msg);
+
+/**
+ * @brief   Stops a coroutine and removes it from its scheduler
+ *
+ * @param[in] sched The scheduler
+ * @param[in] coro  The coroutine
+ */
+void coro_cancel(coro_sched_t *sched, coro_t *coro);
+
+/**
+ * @brief   Checks if a scheduler has running coroutines
+ *
+ * @param[in] sched The scheduler
+ *
+ * @return  true, if no coroutine is running on @p sched
+ */
+static inline bool coro_sched_idle(const coro_sched_t *sched)
+{
+    return (sched->list == NULL);
+}
+
+/**
+ * @brief   (Re-)sets the timeout of a coroutine
+ *
+ * The calling thread will receive a @ref CORO_MSG_TYPE_TIMEOUT message for
+ * @p coro after @p usec, which only @p coro takes.
+ *
+ * @param[in] coro  The coroutine
+ * @param[in] usec  Timeout in microseconds
+ */
+void coro_set_timeout(coro_t *coro, uint32_t usec);
+
+/**
+ * @brief   Removes the timeout of a coroutine
+ *
+ * @param[in] coro  The coroutine
+ */
+static inline void coro_remove_timeout(coro_t *coro)
+{
+    xtimer_remove(&coro->timer);
+}
+
+/**
+ * @brief   Checks if coro_t::msg is the timeout of the coroutine
+ *
+ * @param[in] coro  The coroutine
+ *
+ * @return  true, if coro_t::msg is the timeout of @p coro
+ */
+static inline bool coro_timed_out(const coro_t *coro)
+{
+    return (coro->msg != NULL) && (coro->msg->type == CORO_MSG_TYPE_TIMEOUT) &&
+           (coro->msg->content.ptr == (void *)coro);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CORO_H_ */
+/** @} */
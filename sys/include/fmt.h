@@ -45,6 +45,21 @@ extern "C" {
  */
 size_t fmt_byte_hex(char *out, uint8_t byte);
 
+/**
+ * @brief Formats a sequence of bytes as hex bytes
+ *
+ * Will write 2*n bytes to @p out.
+ * If @p out is NULL, will only return the number of bytes that would have
+ * been written.
+ *
+ * @param[out] out  Pointer to output buffer, or NULL
+ * @param[in]  ptr  Pointer to bytes to convert
+ * @param[in]  n    Number of bytes to convert
+ *
+ * @return     2*n
+ */
+size_t fmt_bytes_hex(char *out, const uint8_t *ptr, size_t n);
+
 /**
  * @brief Formats a sequence of bytes as hex bytes, starting with the last byte
  *
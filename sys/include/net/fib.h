@@ -87,6 +87,19 @@ typedef struct {
  */
 #define FIB_FLAG_NET_PREFIX_MASK (0xffUL << FIB_FLAG_NET_PREFIX_SHIFT)
 
+/**
+ * @brief number of entries a single hop table grows by at once, when it is
+ *        full and allowed to grow (see fib_table_t::max_size)
+ */
+#ifndef FIB_DYNAMIC_GROW_STEP
+#define FIB_DYNAMIC_GROW_STEP (4)
+#endif
+
+/**
+ * @brief version of the binary format written by fib_snapshot()
+ */
+#define FIB_SNAPSHOT_VERSION (1)
+
 /**
  * @brief initializes all FIB entries with 0
  *
@@ -465,6 +478,51 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
  */
 int fib_get_num_used_entries(fib_table_t *table);
 
+/**
+ * @brief Writes all valid entries of a FIB table to a buffer, to be restored
+ *        e.g. after a reboot with fib_restore()
+ *
+ * The snapshot is a compact little endian binary format:
+ * a header of `'F' 'I' 'B'`, @ref FIB_SNAPSHOT_VERSION, the table type and
+ * the 16 bit number of entries, followed by the entries.
+ * A single hop entry is written as interface ID (16 bit), destination flags,
+ * next-hop flags and remaining lifetime in ms (32 bit each), followed by the
+ * destination and the next-hop address, each prefixed by its size (8 bit).
+ * A source route is written as interface ID (16 bit), flags and remaining
+ * lifetime in ms (32 bit each) and the number of hops (8 bit), followed by
+ * the hop addresses, each prefixed by its size (8 bit).
+ * A remaining lifetime of 0xffffffff marks an entry that does not expire.
+ *
+ * @param[in] table         the fib instance to snapshot
+ * @param[out] buf          the buffer to write the snapshot to,
+ *                          may be NULL if *buf_size is 0
+ * @param[in, out] buf_size the size of buf,
+ *                          overwritten with the size of the snapshot
+ *
+ * @return 0 on success
+ *         -EFAULT if buf_size is NULL
+ *         -ENOBUFS if buf is too small, the required size is written to
+ *         buf_size
+ */
+int fib_snapshot(fib_table_t *table, uint8_t *buf, size_t *buf_size);
+
+/**
+ * @brief Adds the entries of a snapshot taken by fib_snapshot() to a FIB
+ *        table of the same type
+ *
+ * Existing entries for the same destination are updated.
+ *
+ * @param[in] table         the initialized fib instance to restore to
+ * @param[in] buf           the snapshot
+ * @param[in] buf_size      the size of the snapshot
+ *
+ * @return 0 on success
+ *         -EFAULT if buf is NULL
+ *         -EINVAL if buf is not a valid snapshot for this table
+ *         -ENOMEM if the table is too small to hold all entries
+ */
+int fib_restore(fib_table_t *table, const uint8_t *buf, size_t buf_size);
+
 /**
  * @brief Prints the kernel_pid_t for all registered RRPs
  */
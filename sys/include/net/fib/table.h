@@ -35,6 +35,13 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief number of buckets of the destination index of a source route table
+ */
+#ifndef FIB_SR_INDEX_SIZE
+#define FIB_SR_INDEX_SIZE (8)
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
@@ -53,6 +60,8 @@ typedef struct {
     universal_address_container_t *next_hop;
 } fib_entry_t;
 
+struct fib_sr;
+
 /**
 * @brief Container descriptor for a FIB source route entry
 */
@@ -61,12 +70,16 @@ typedef struct fib_sr_entry {
     universal_address_container_t *address;
     /** Pointer to the next shared generic address on the source route */
     struct fib_sr_entry *next;
+    /** Pointer to the next entry in the same bucket of the destination index */
+    struct fib_sr_entry *index_next;
+    /** Pointer to the source route this entry belongs to */
+    struct fib_sr *sr;
 } fib_sr_entry_t;
 
 /**
 * @brief Container descriptor for a FIB source route
 */
-typedef struct {
+typedef struct fib_sr {
     /** interface ID */
     kernel_pid_t sr_iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -90,6 +103,8 @@ typedef struct {
     fib_sr_entry_t *entry_pool;
     /** the maximum number of elements in the entry pool */
     size_t entry_pool_size;
+    /** all used hop entries, hashed by the container of their address */
+    fib_sr_entry_t *index[FIB_SR_INDEX_SIZE];
 } fib_sr_meta_t;
 
 /**
@@ -119,6 +134,19 @@ typedef struct {
     uint8_t table_type;
     /** the maximim number of entries in this FIB table */
     size_t size;
+#if defined(MODULE_FIB_DYNAMIC) || defined(DOXYGEN)
+    /** the number of entries a single hop table may grow to by allocating
+    *   from the heap, 0 if the table is not allowed to grow.
+    *   Tables with max_size > 0 MUST either have heap allocated entries or
+    *   `NULL` entries, which are then allocated by fib_init() and freed
+    *   by fib_deinit()
+    */
+    size_t max_size;
+    /** the number of entries allocated by fib_init(). A grown table shrinks
+    *   back towards it when its last entries are removed
+    */
+    size_t min_size;
+#endif
     /** table access mutex to grant exclusive operations on calls */
     mutex_t mtx_access;
     /** current number of registered RPs. */
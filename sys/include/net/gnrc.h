@@ -235,6 +235,16 @@
  *   USEMODULE += gnrc_conn_udp
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * - For @ref net_gnrc_tcp support include
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ *   USEMODULE += gnrc_tcp
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * - To use @ref net_conn_tcp with GNRC include
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ *   USEMODULE += gnrc_conn_tcp
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * - To include the @ref net_gnrc_rpl module
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
  *   USEMODULE += gnrc_rpl
@@ -28,6 +28,10 @@
 #include "net/gnrc.h"
 #include "sched.h"
 
+#ifdef MODULE_GNRC_CONN_TCP
+#include "net/gnrc/tcp.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -71,6 +75,17 @@ struct conn_udp {
     size_t local_addr_len;                      /**< length of struct conn_ip::local_addr */
 };
 
+#if defined(MODULE_GNRC_CONN_TCP) || defined(DOXYGEN)
+/**
+ * @brief   TCP connection type
+ * @internal
+ */
+struct conn_tcp {
+    gnrc_tcp_tcb_t *tcb;                        /**< @ref net_gnrc_tcp connection,
+                                                 *   NULL if closed */
+};
+#endif
+
 /**
  * @brief  Bind connection to demux context
  *
@@ -83,8 +98,7 @@ struct conn_udp {
 static inline void gnrc_conn_reg(gnrc_netreg_entry_t *entry, gnrc_nettype_t type,
                                  uint32_t demux_ctx)
 {
-    entry->pid = sched_active_pid;
-    entry->demux_ctx = demux_ctx;
+    gnrc_netreg_entry_init_pid(entry, demux_ctx, sched_active_pid);
     gnrc_netreg_register(type, entry);
 }
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_event Shared event thread
+ * @ingroup     net_gnrc
+ * @brief       Runs several GNRC layers on one shared thread
+ *
+ * By default every GNRC layer runs in its own thread, with its own stack and
+ * message queue. With module `gnrc_event` supporting layers (currently
+ * @ref net_gnrc_sixlowpan and @ref net_gnrc_udp) instead register a callback
+ * at @ref net_gnrc_netreg (see module `gnrc_netapi_callbacks`) and process
+ * their packets as @ref core_event events on one shared thread.
+ *
+ * Handing a packet to such a layer then is a function call that enqueues the
+ * packet and posts the layer's event, instead of a message to another thread
+ * and the context switch that comes with it. Each ported layer saves its own
+ * stack (@ref GNRC_UDP_STACK_SIZE, @ref GNRC_SIXLOWPAN_STACK_SIZE), at the
+ * cost of a single @ref GNRC_EVENT_STACK_SIZE stack for all of them.
+ *
+ * @note    The PID of the layers running on the shared thread is
+ *          @ref gnrc_event_pid. This thread does not reply to
+ *          @ref GNRC_NETAPI_MSG_TYPE_GET or @ref GNRC_NETAPI_MSG_TYPE_SET
+ *          messages, so do not use gnrc_netapi_get() or gnrc_netapi_set() on
+ *          it.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread definitions
+ */
+
+#ifndef GNRC_EVENT_THREAD_H_
+#define GNRC_EVENT_THREAD_H_
+
+#include <stdint.h>
+
+#include "cib.h"
+#include "event.h"
+#include "kernel_types.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Priority of the shared event thread
+ *
+ * @note    Should be at least as high as the priority of the most important
+ *          layer running on it.
+ */
+#ifndef GNRC_EVENT_PRIO
+#define GNRC_EVENT_PRIO         (THREAD_PRIORITY_MAIN - 4)
+#endif
+
+/**
+ * @brief   Default stack size to use for the shared event thread
+ */
+#ifndef GNRC_EVENT_STACK_SIZE
+#define GNRC_EVENT_STACK_SIZE   (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   PID of the shared event thread
+ *
+ * KERNEL_PID_UNDEF, before gnrc_event_init() was called.
+ */
+extern kernel_pid_t gnrc_event_pid;
+
+/**
+ * @brief   Event queue of the shared event thread
+ */
+extern event_queue_t gnrc_event_queue;
+
+/**
+ * @brief   Packet handler of a layer running on the shared event thread
+ *
+ * @param[in] type  Message type, e.g. @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * @param[in] ptr   Message content, e.g. the packet
+ */
+typedef void (*gnrc_event_netapi_handler_t)(uint16_t type, void *ptr);
+
+/**
+ * @brief   NETAPI adapter of a layer running on the shared event thread
+ *
+ * Bundles the layer's event, its netreg callback and a ring of pending
+ * messages, so that packets dispatched to the layer in a burst are processed
+ * in order by one event.
+ */
+typedef struct {
+    event_t super;                          /**< event base class */
+    gnrc_netreg_entry_cbd_t cbd;            /**< netreg callback */
+    gnrc_event_netapi_handler_t handler;    /**< packet handler of the layer */
+    cib_t cib;                              /**< index into gnrc_event_netapi_t::queue */
+    msg_t *queue;                           /**< ring of pending messages */
+} gnrc_event_netapi_t;
+
+/**
+ * @brief   Starts the shared event thread
+ *
+ * Does nothing, if the thread is already running.
+ *
+ * @return  PID of the shared event thread
+ */
+kernel_pid_t gnrc_event_init(void);
+
+/**
+ * @brief   Initializes a NETAPI adapter and registers it at netreg
+ *
+ * @param[out] ev           The adapter to initialize
+ * @param[out] entry        The netreg entry to register for the adapter
+ * @param[in] type          Type to register @p entry for
+ * @param[in] handler       Packet handler of the layer
+ * @param[in] queue         Ring of pending messages
+ * @param[in] queue_size    Number of elements in @p queue. Must be a power
+ *                          of two.
+ */
+void gnrc_event_netapi_init(gnrc_event_netapi_t *ev,
+                            gnrc_netreg_entry_t *entry, gnrc_nettype_t type,
+                            gnrc_event_netapi_handler_t handler,
+                            msg_t *queue, unsigned queue_size);
+
+/**
+ * @brief   Posts a message to a layer running on the shared event thread
+ *
+ * Can be called from ISR context.
+ *
+ * @param[in] ev    The layer's adapter
+ * @param[in] type  Message type
+ * @param[in] ptr   Message content
+ *
+ * @return  1, on success
+ * @return  0, if the ring of pending messages is full
+ */
+int gnrc_event_netapi_post(gnrc_event_netapi_t *ev, uint16_t type, void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_EVENT_THREAD_H_ */
+/** @} */
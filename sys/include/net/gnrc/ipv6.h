@@ -91,6 +91,15 @@ extern kernel_pid_t gnrc_ipv6_pid;
 #   endif
 #endif
 
+/**
+ * @brief   Maximum number of entries the IPv6 FIB table may grow to with
+ *          module `fib_dynamic`. The table starts with
+ *          @ref GNRC_IPV6_FIB_TABLE_SIZE entries.
+ */
+#ifndef GNRC_IPV6_FIB_TABLE_MAX_SIZE
+#define GNRC_IPV6_FIB_TABLE_MAX_SIZE    (8 * GNRC_IPV6_FIB_TABLE_SIZE)
+#endif
+
 /**
  * @brief   The forwarding information base (FIB) for the IPv6 stack.
  *
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_mcast IPv6 multicast group table
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Hashed table of the multicast groups joined by the interfaces
+ *
+ * Multicast addresses added to an interface with gnrc_ipv6_netif_add_addr()
+ * join the respective group on that interface, so @ref net_gnrc_ipv6 can
+ * check the group membership of received packets with one hash lookup
+ * instead of scanning the address lists of all interfaces. Each group keeps
+ * a bitmap of the joined interfaces and counts the packets received for and
+ * sent to it.
+ * @{
+ *
+ * @file
+ * @brief   IPv6 multicast group table definitions
+ */
+#ifndef GNRC_IPV6_MCAST_H_
+#define GNRC_IPV6_MCAST_H_
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/gnrc/netif.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of groups in the multicast group table.
+ *
+ * Every interface joins at least the all-nodes group and the solicited-nodes
+ * group of each of its unicast addresses.
+ */
+#ifndef GNRC_IPV6_MCAST_GROUP_NUMOF
+#define GNRC_IPV6_MCAST_GROUP_NUMOF (8 * GNRC_NETIF_NUMOF)
+#endif
+
+/**
+ * @brief   Packet counters of a multicast group
+ */
+typedef struct {
+    uint32_t rx_count;      /**< packets received for the group */
+    uint32_t tx_count;      /**< packets sent to the group */
+} gnrc_ipv6_mcast_stats_t;
+
+/**
+ * @brief   Joins a multicast group on an interface.
+ *
+ * @param[in] iface An interface.
+ * @param[in] group A multicast address.
+ *
+ * @return  0, on success.
+ * @return  -EINVAL, if @p iface is undefined or @p group is no multicast
+ *          address.
+ * @return  -ENOMEM, if the table is full.
+ */
+int gnrc_ipv6_mcast_join(kernel_pid_t iface, const ipv6_addr_t *group);
+
+/**
+ * @brief   Leaves a multicast group on an interface.
+ *
+ * @param[in] iface An interface.
+ * @param[in] group A multicast address.
+ */
+void gnrc_ipv6_mcast_leave(kernel_pid_t iface, const ipv6_addr_t *group);
+
+/**
+ * @brief   Leaves all multicast groups on an interface.
+ *
+ * @param[in] iface An interface.
+ */
+void gnrc_ipv6_mcast_leave_all(kernel_pid_t iface);
+
+/**
+ * @brief   Checks if a packet received for a multicast group is for this
+ *          node, and counts it for the group if so.
+ *
+ * @param[in] iface The interface the packet was received on.
+ *                  KERNEL_PID_UNDEF for any interface.
+ * @param[in] group The destination address of the packet.
+ *
+ * @return  @p iface or, if @p iface is KERNEL_PID_UNDEF, the first interface
+ *          that joined @p group.
+ * @return  KERNEL_PID_UNDEF, if @p group was not joined on @p iface.
+ */
+kernel_pid_t gnrc_ipv6_mcast_rcv(kernel_pid_t iface, const ipv6_addr_t *group);
+
+/**
+ * @brief   Counts a packet sent to a multicast group.
+ *
+ * Packets to groups that are not in the table are not counted.
+ *
+ * @param[in] group The destination address of the packet.
+ */
+void gnrc_ipv6_mcast_sent(const ipv6_addr_t *group);
+
+/**
+ * @brief   Gets the packet counters of a multicast group.
+ *
+ * @param[in] group     A multicast address.
+ * @param[out] stats    The counters of @p group.
+ *
+ * @return  0, on success.
+ * @return  -ENOENT, if @p group was not joined on any interface.
+ */
+int gnrc_ipv6_mcast_get_stats(const ipv6_addr_t *group, gnrc_ipv6_mcast_stats_t *stats);
+
+/**
+ * @brief   Prints the multicast group table.
+ */
+void gnrc_ipv6_mcast_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_IPV6_MCAST_H_ */
+/** @} */
@@ -75,6 +75,21 @@ extern "C" {
 #define GNRC_IPV6_NETIF_DEFAULT_MTU             (IPV6_MIN_MTU)
 #endif
 
+/**
+ * @brief   Number of entries in the source address cache of an interface
+ *
+ * @details gnrc_ipv6_netif_find_best_src_addr() remembers the chosen source
+ *          address for the last @ref GNRC_IPV6_NETIF_SRC_CACHE_SIZE
+ *          destinations, so the RFC 6724 selection does not have to be run
+ *          for every outgoing packet. The cache of an interface is flushed
+ *          whenever an address is added to or removed from it or the state of
+ *          one of its addresses changes (see gnrc_ipv6_netif_src_cache_flush()).
+ *          Set to 0 to disable the cache.
+ */
+#ifndef GNRC_IPV6_NETIF_SRC_CACHE_SIZE
+#define GNRC_IPV6_NETIF_SRC_CACHE_SIZE          (4U)
+#endif
+
 /**
  * @brief   Default hop limit
  *
@@ -266,6 +281,21 @@ typedef struct {
      */
 } gnrc_ipv6_netif_addr_t;
 
+#if (GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0) || defined(DOXYGEN)
+/**
+ * @brief   Entry of the source address cache of an interface.
+ */
+typedef struct {
+    ipv6_addr_t dst;        /**< destination address */
+    /**
+     * @brief   Source address chosen for gnrc_ipv6_netif_src_cache_t::dst
+     *          from gnrc_ipv6_netif_t::addrs. NULL if the entry is unused.
+     */
+    ipv6_addr_t *src;
+    bool ll_only;           /**< only link-local sources were requested */
+} gnrc_ipv6_netif_src_cache_t;
+#endif
+
 /**
  * @brief   Definition of IPv6 interface type.
  */
@@ -348,6 +378,15 @@ typedef struct {
 #ifdef MODULE_NETSTATS_IPV6
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if (GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0) || defined(DOXYGEN)
+    /**
+     * @brief   Source address cache, see @ref GNRC_IPV6_NETIF_SRC_CACHE_SIZE
+     */
+    gnrc_ipv6_netif_src_cache_t src_cache[GNRC_IPV6_NETIF_SRC_CACHE_SIZE];
+    uint32_t src_cache_hits;    /**< lookups answered from the source address cache */
+    uint32_t src_cache_misses;  /**< lookups that needed a full source address selection */
+    uint8_t src_cache_next;     /**< next entry of the source address cache to replace */
+#endif
 } gnrc_ipv6_netif_t;
 
 /**
@@ -532,6 +571,19 @@ ipv6_addr_t *gnrc_ipv6_netif_match_prefix(kernel_pid_t pid, const ipv6_addr_t *p
  */
 ipv6_addr_t *gnrc_ipv6_netif_find_best_src_addr(kernel_pid_t pid, const ipv6_addr_t *dest, bool ll_only);
 
+/**
+ * @brief   Flushes the source address cache of an interface.
+ *
+ * @details Must be called after the state of an address of the interface that
+ *          is relevant for source address selection (e.g.
+ *          gnrc_ipv6_netif_addr_t::preferred) was changed directly. Adding,
+ *          removing, and resetting addresses with the functions of this module
+ *          flushes the cache automatically.
+ *
+ * @param[in] pid   The PID to the interface.
+ */
+void gnrc_ipv6_netif_src_cache_flush(kernel_pid_t pid);
+
 /**
  * @brief   Get interface specific meta-information on an address
  *
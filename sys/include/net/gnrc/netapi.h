@@ -37,6 +37,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of messages the GNRC threads receive at once
+ *
+ * Also the maximum number of subscribers gnrc_netapi_dispatch() sends a
+ * packet to at once.
+ */
+#ifndef GNRC_NETAPI_MSG_BULK
+#define GNRC_NETAPI_MSG_BULK            (4U)
+#endif
+
 /**
  * @brief   @ref core_msg type for passing a @ref net_gnrc_pkt up the network stack
  */
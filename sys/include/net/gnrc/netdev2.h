@@ -33,6 +33,14 @@
 #include "net/netdev2.h"
 #include "net/gnrc.h"
 
+#ifdef MODULE_GNRC_NETDEV2_COALESCE
+#include "xtimer.h"
+#endif
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+#include "cib.h"
+#include "net/gnrc/netdev2/txq.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -42,6 +50,43 @@ extern "C" {
  */
 #define NETDEV2_MSG_TYPE_EVENT 0x1234
 
+/**
+ * @name    Interrupt coalescing
+ *
+ * By default, every device interrupt is posted to the gnrc_netdev2 thread as
+ * a message. If the message queue of the thread is full, the interrupt is
+ * lost (and counted in the layer 2 @ref net_netstats, if enabled).
+ *
+ * With the `gnrc_netdev2_coalesce` module, the interrupt only increments a
+ * counter and sets @ref GNRC_NETDEV2_FLAG_IRQ for the thread, so no interrupt
+ * is lost and no message is needed per frame. The thread then handles up to
+ * @ref GNRC_NETDEV2_RX_BUDGET device events in a row before it serves pending
+ * netapi messages again. If @ref GNRC_NETDEV2_COALESCE_US is not 0, the
+ * thread is woken at most this long after the first interrupt, or earlier
+ * when the budget is reached, to handle several frames per wakeup.
+ * @{
+ */
+/**
+ * @brief   Maximum number of device events handled per wakeup
+ */
+#ifndef GNRC_NETDEV2_RX_BUDGET
+#define GNRC_NETDEV2_RX_BUDGET      (8U)
+#endif
+
+/**
+ * @brief   Maximum delay between an interrupt and its handling in
+ *          microseconds, 0 to disable the coalescing timer
+ */
+#ifndef GNRC_NETDEV2_COALESCE_US
+#define GNRC_NETDEV2_COALESCE_US    (0U)
+#endif
+
+/**
+ * @brief   Thread flag signaling pending device interrupts
+ */
+#define GNRC_NETDEV2_FLAG_IRQ       (0x0001)
+/** @} */
+
 /**
  * @brief Structure holding GNRC netdev2 adapter state
  *
@@ -77,6 +122,36 @@ typedef struct gnrc_netdev2 {
      * @brief PID of this adapter for netapi messages
      */
     kernel_pid_t pid;
+
+#if defined(MODULE_GNRC_NETDEV2_COALESCE) || defined(DOXYGEN)
+    /**
+     * @brief Number of device interrupts not handled yet
+     */
+    volatile uint16_t irq_pending;
+#if GNRC_NETDEV2_COALESCE_US || defined(DOXYGEN)
+    /**
+     * @brief Timer bounding the delay of coalesced interrupts
+     */
+    xtimer_t coalesce_timer;
+#endif
+#endif
+
+#if defined(MODULE_GNRC_NETDEV2_TXQ) || defined(DOXYGEN)
+    /**
+     * @brief Queued packets per priority class
+     */
+    gnrc_pktsnip_t *txq[GNRC_NETDEV2_TXQ_NUMOF][GNRC_NETDEV2_TXQ_LEN];
+
+    /**
+     * @brief Indexes into gnrc_netdev2_t::txq
+     */
+    cib_t txq_cib[GNRC_NETDEV2_TXQ_NUMOF];
+
+    /**
+     * @brief Number of bytes of the queued packets per priority class
+     */
+    size_t txq_bytes[GNRC_NETDEV2_TXQ_NUMOF];
+#endif
 } gnrc_netdev2_t;
 
 /**
@@ -94,6 +169,42 @@ typedef struct gnrc_netdev2 {
 kernel_pid_t gnrc_netdev2_init(char *stack, int stacksize, char priority,
                                const char *name, gnrc_netdev2_t *gnrc_netdev2);
 
+#if defined(MODULE_GNRC_NETDEV2_TXQ) && defined(TEST_SUITES)
+/**
+ * @brief   Initializes the transmit queue of @p gnrc_netdev2 without
+ *          starting its thread
+ *
+ * @note    Only available for unittests
+ *
+ * @param[in] gnrc_netdev2  the adapter, gnrc_netdev2_t::send is called for
+ *                          sent packets
+ */
+void gnrc_netdev2_txq_test_init(gnrc_netdev2_t *gnrc_netdev2);
+
+/**
+ * @brief   Queues a packet like a @ref GNRC_NETAPI_MSG_TYPE_SND message
+ *
+ * @note    Only available for unittests
+ *
+ * @param[in] gnrc_netdev2  the adapter
+ * @param[in] pkt           the packet to queue
+ */
+void gnrc_netdev2_txq_test_put(gnrc_netdev2_t *gnrc_netdev2, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Sends the next queued packet, like the thread after all pending
+ *          messages are handled
+ *
+ * @note    Only available for unittests
+ *
+ * @param[in] gnrc_netdev2  the adapter
+ *
+ * @return  1 if a packet was sent
+ * @return  0 if the queue was empty
+ */
+int gnrc_netdev2_txq_test_send_next(gnrc_netdev2_t *gnrc_netdev2);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup   net_gnrc_netdev2
+ * @{
+ *
+ * @file
+ * @brief     Transmit queue of the netdev2-GNRC glue code
+ *
+ * By default, every packet is handed to the device as soon as its
+ * @ref GNRC_NETAPI_MSG_TYPE_SND message is handled, in the order of the
+ * messages. With the `gnrc_netdev2_txq` module, packets are first put into a
+ * queue per priority class. The thread handles all pending messages before
+ * it sends the queued packet of the highest class, so routing control
+ * traffic overtakes bulk data waiting for the device.
+ *
+ * The queue is bounded by @ref GNRC_NETDEV2_TXQ_BYTES and by
+ * @ref GNRC_NETDEV2_TXQ_LEN packets per class. If a packet does not fit, the
+ * oldest packets of lower classes are dropped to make room, as long as this
+ * lets the packet fit; otherwise the packet itself is dropped. Dropped
+ * packets are released with `ENOBUFS`, which is reported to
+ * @ref net_gnrc_neterr subscribers. Sent and dropped packets are counted per
+ * class in the layer 2 @ref net_netstats, if enabled.
+ *
+ * The class is derived from the IPv6 header and the ICMPv6 message type.
+ * Layers that compress or encapsulate these headers, like 6LoWPAN, keep the
+ * class in the netif header with gnrc_netdev2_txq_mark() first.
+ */
+
+#ifndef GNRC_NETDEV2_TXQ_H
+#define GNRC_NETDEV2_TXQ_H
+
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of bytes of all queued packets
+ *
+ * Queued packets occupy the packet buffer, so this should be well below
+ * @ref GNRC_PKTBUF_SIZE.
+ */
+#ifndef GNRC_NETDEV2_TXQ_BYTES
+#define GNRC_NETDEV2_TXQ_BYTES      (1536U)
+#endif
+
+/**
+ * @brief   Maximum number of queued packets per class, must be a power of 2
+ */
+#ifndef GNRC_NETDEV2_TXQ_LEN
+#define GNRC_NETDEV2_TXQ_LEN        (8U)
+#endif
+
+/**
+ * @brief   Priority classes, from highest to lowest
+ */
+typedef enum {
+    GNRC_NETDEV2_TXQ_CTRL = 0,      /**< NDP and RPL messages, DSCP CS6 and
+                                     *   CS7 (network control) */
+    GNRC_NETDEV2_TXQ_PRIO,          /**< DSCP CS4 and above, e.g. EF */
+    GNRC_NETDEV2_TXQ_BULK,          /**< everything else */
+    GNRC_NETDEV2_TXQ_NUMOF,         /**< number of classes */
+} gnrc_netdev2_txq_class_t;
+
+/**
+ * @brief   Classifies a packet and keeps the class in its netif header
+ *
+ * @pre `pkt` starts with a writable netif header
+ *
+ * @param[in,out] pkt   the packet to send, before its network layer headers
+ *                      are compressed
+ */
+void gnrc_netdev2_txq_mark(gnrc_pktsnip_t *pkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_NETDEV2_TXQ_H */
+/** @} */
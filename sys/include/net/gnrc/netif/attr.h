@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_attr Interface attribute cache
+ * @ingroup     net_gnrc_netif
+ * @brief       Cached copies of rarely changing interface options
+ *
+ * gnrc_netapi_get() sends a message to the interface thread and waits for
+ * the reply, i.e. it costs two context switches. Options like the link
+ * layer addresses, the source address length or the MTU are queried that
+ * way for many packets, but rarely change.
+ *
+ * With this module, an interface thread publishes the values of these
+ * options (NETOPT_ADDRESS, NETOPT_ADDRESS_LONG, NETOPT_SRC_LEN,
+ * NETOPT_MAX_PACKET_SIZE, NETOPT_IPV6_IID, NETOPT_PROTO and NETOPT_IS_WIRED)
+ * after its device was initialized and after every option was set. Each
+ * option is queried with the size its drivers expect, e.g.
+ * `sizeof(uint16_t)` for NETOPT_SRC_LEN. gnrc_netapi_get() then answers
+ * queries for them from the cache. The cache is protected by a @ref sys_seqlock, so
+ * readers never block; if a reader catches the interface thread during an
+ * update, or the interface does not publish its options, the query falls
+ * back to the message.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Interface attribute cache definitions
+ */
+#ifndef GNRC_NETIF_ATTR_H_
+#define GNRC_NETIF_ATTR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/netopt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum size of a cached option value
+ *
+ * The link layer addresses are queried with this size. Larger values are
+ * not cached.
+ */
+#ifndef GNRC_NETIF_ATTR_MAXLEN
+#define GNRC_NETIF_ATTR_MAXLEN  (8U)
+#endif
+
+/**
+ * @brief   Gets an option from the device of an interface
+ *
+ * Same semantics as gnrc_netapi_get() for context 0, but called in the
+ * interface thread.
+ *
+ * @param[in] ctx       context passed to gnrc_netif_attr_publish()
+ * @param[in] opt       the option
+ * @param[out] value    buffer for the value
+ * @param[in] max_len   size of @p value
+ *
+ * @return  number of bytes written to @p value or a negative errno
+ */
+typedef int (*gnrc_netif_attr_get_t)(void *ctx, netopt_t opt, void *value,
+                                     size_t max_len);
+
+/**
+ * @brief   Publishes the current options of an interface
+ *
+ * Must be called by the interface thread @p pid only.
+ *
+ * @param[in] pid   PID of the interface
+ * @param[in] get   function getting the options from the device
+ * @param[in] ctx   context for @p get
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if there is no cache entry left
+ */
+int gnrc_netif_attr_publish(kernel_pid_t pid, gnrc_netif_attr_get_t get,
+                            void *ctx);
+
+/**
+ * @brief   Removes the options of an interface from the cache
+ *
+ * @param[in] pid   PID of the interface
+ */
+void gnrc_netif_attr_remove(kernel_pid_t pid);
+
+/**
+ * @brief   Gets a cached option of an interface
+ *
+ * @param[in] pid       PID of the interface
+ * @param[in] opt       the option
+ * @param[out] value    buffer for the value
+ * @param[in] max_len   size of @p value
+ * @param[out] res      the result gnrc_netapi_get() would return
+ *
+ * @return  1 if @p res and @p value are set
+ * @return  0 if the option is not cached (at the moment)
+ */
+int gnrc_netif_attr_get(kernel_pid_t pid, netopt_t opt, void *value,
+                        size_t max_len, int *res);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_NETIF_ATTR_H_ */
+/** @} */
@@ -65,6 +65,22 @@ extern "C" {
  *          this flag the same way it does @ref GNRC_NETIF_HDR_FLAGS_BROADCAST.
  */
 #define GNRC_NETIF_HDR_FLAGS_MULTICAST  (0x40)
+
+/**
+ * @brief   Send packet in the network control transmit class.
+ *
+ * @details Set by gnrc_netdev2_txq_mark() for layers that compress the
+ *          headers the class is derived from, e.g. 6LoWPAN.
+ */
+#define GNRC_NETIF_HDR_FLAGS_TXQ_CTRL   (0x20)
+
+/**
+ * @brief   Send packet in the prioritized transmit class.
+ *
+ * @details Set by gnrc_netdev2_txq_mark() for layers that compress the
+ *          headers the class is derived from, e.g. 6LoWPAN.
+ */
+#define GNRC_NETIF_HDR_FLAGS_TXQ_PRIO   (0x10)
 /**
  * @}
  */
@@ -38,8 +38,35 @@ extern "C" {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
+/**
+ * @brief   Packet handler callback for netreg entries
+ *
+ * @param[in] cmd   NETAPI command type (@ref GNRC_NETAPI_MSG_TYPE_RCV or
+ *                  @ref GNRC_NETAPI_MSG_TYPE_SND)
+ * @param[in] pkt   The packet to handle
+ * @param[in] ctx   Application context
+ */
+typedef void (*gnrc_netreg_entry_cb_t)(uint16_t cmd, gnrc_pktsnip_t *pkt,
+                                       void *ctx);
+
+/**
+ * @brief   Callback + context container
+ *
+ * @note    Only available with module `gnrc_netapi_callbacks`
+ */
+typedef struct {
+    gnrc_netreg_entry_cb_t cb;  /**< The callback */
+    void *ctx;                  /**< Application context for the callback */
+} gnrc_netreg_entry_cbd_t;
+#endif
+
 /**
  * @brief   Entry to the @ref net_gnrc_netreg
+ *
+ * @note    With module `gnrc_netapi_callbacks` an entry must be initialized
+ *          with gnrc_netreg_entry_init_pid(), gnrc_netreg_entry_init_cb() or
+ *          @ref GNRC_NETREG_ENTRY_INIT_PID.
  */
 typedef struct gnrc_netreg_entry {
     /**
@@ -58,8 +85,72 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
     kernel_pid_t pid;       /**< The PID of the registering thread */
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
+    /**
+     * @brief   Callback to call instead of sending a message to
+     *          gnrc_netreg_entry_t::pid, if not NULL
+     *
+     * @note    Only available with module `gnrc_netapi_callbacks`
+     */
+    gnrc_netreg_entry_cbd_t *cbd;
+#endif
 } gnrc_netreg_entry_t;
 
+/**
+ * @brief   Static initializer for a netreg entry of a thread
+ *
+ * @param[in] demux_ctx The demultiplexing context
+ * @param[in] pid       The PID of the registering thread
+ */
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, pid, NULL }
+#else
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, pid }
+#endif
+
+/**
+ * @brief   Initializes a netreg entry of a thread dynamically
+ *
+ * @param[out] entry        The entry to initialize
+ * @param[in] demux_ctx     The demultiplexing context
+ * @param[in] pid           The PID of the registering thread
+ */
+static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
+                                              uint32_t demux_ctx,
+                                              kernel_pid_t pid)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->pid = pid;
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+    entry->cbd = NULL;
+#endif
+}
+
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry with a callback dynamically
+ *
+ * The callback is called in the context of the thread dispatching a packet,
+ * so it should hand the packet over as fast as possible.
+ *
+ * @note    Only available with module `gnrc_netapi_callbacks`
+ *
+ * @param[out] entry        The entry to initialize
+ * @param[in] demux_ctx     The demultiplexing context
+ * @param[in] cbd           Callback and context to call
+ */
+static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
+                                             uint32_t demux_ctx,
+                                             gnrc_netreg_entry_cbd_t *cbd)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->pid = KERNEL_PID_UNDEF;
+    entry->cbd = cbd;
+}
+#endif
+
 /**
  * @brief   Initializes module.
  */
@@ -79,7 +170,8 @@ void gnrc_netreg_init(void);
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
  *
- * @pre The calling thread must provide a message queue.
+ * @pre The calling thread must provide a message queue, unless @p entry has a
+ *      callback.
  *
  * @return  0 on success
  * @return  -EINVAL if @p type was < GNRC_NETTYPE_UNDEF or >= GNRC_NETTYPE_NUMOF
@@ -115,6 +115,13 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+    /**
+     * @brief   Unused bytes reserved in front of this snip for headers
+     *          prepended later, see @ref gnrc_pktbuf_add_headroom().
+     *
+     * @internal
+     */
+    uint16_t headroom;
 } gnrc_pktsnip_t;
 
 /**
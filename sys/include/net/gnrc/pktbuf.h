@@ -59,6 +59,18 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @def     GNRC_PKTBUF_HEADROOM
+ * @brief   Default headroom for outgoing payload, see gnrc_pktbuf_add_headroom().
+ *
+ * @details Fits the UDP, IPv6 and interface headers (with 8 byte addresses)
+ *          and the I/O vector of the device driver, each with its
+ *          gnrc_pktsnip_t. Set to 0 to disable.
+ */
+#ifndef GNRC_PKTBUF_HEADROOM
+#define GNRC_PKTBUF_HEADROOM    ((4 * sizeof(gnrc_pktsnip_t)) + 80 + (8 * sizeof(void *)))
+#endif
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -71,6 +83,10 @@ void gnrc_pktbuf_init(void);
  *          function externally. This will most likely create memory leaks or
  *          not allowed memory access.
  *
+ * If @p next has enough headroom left (see gnrc_pktbuf_add_headroom()) and
+ * the caller is its only user, the new gnrc_pktsnip_t is placed there without
+ * searching the packet buffer or taking its lock.
+ *
  * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
  *                      want to create a new packet.
  * @param[in] data      Data of the new gnrc_pktsnip_t. If @p data is NULL no data
@@ -85,6 +101,56 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds a new gnrc_pktsnip_t and reserves space in front of it for
+ *          headers that are prepended later.
+ *
+ * Meant for the payload of outgoing packets: lower layers prepending their
+ * headers with gnrc_pktbuf_add() (and gnrc_pktbuf_get_iovec()) take them
+ * from the headroom instead of allocating. Each such header uses its size
+ * and the size of a gnrc_pktsnip_t, both rounded up to the alignment of the
+ * packet buffer. The headroom is passed on to the prepended header and
+ * returned to the packet buffer with the packet.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      Data of the new gnrc_pktsnip_t. If @p data is NULL no data
+ *                      will be inserted into `result`.
+ * @param[in] size      Length of @p data. May not be 0.
+ * @param[in] headroom  Number of bytes to reserve, e.g. @ref GNRC_PKTBUF_HEADROOM.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ * @return  NULL, if @p size == 0.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, void *data, size_t size,
+                                         size_t headroom, gnrc_nettype_t type);
+
+/**
+ * @brief   Adds a new gnrc_pktsnip_t that refers to a part of the data of
+ *          another one instead of copying it.
+ *
+ * The new gnrc_pktsnip_t shares its data with @p src, which is kept in the
+ * packet buffer until the new gnrc_pktsnip_t is released (only @p src
+ * itself, not the snips following it). As the data is shared, it must not
+ * be changed: use gnrc_pktbuf_start_write() to get a writable copy.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] src       The gnrc_pktsnip_t whose data to refer to.
+ * @param[in] offset    Offset of the data in gnrc_pktsnip_t::data of @p src.
+ * @param[in] size      Length of the data. May not be 0.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ * @return  NULL, if @p src == NULL, @p size == 0 or @p offset + @p size
+ *          exceeds the data of @p src.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_slice(gnrc_pktsnip_t *next, gnrc_pktsnip_t *src,
+                                      size_t offset, size_t size, gnrc_nettype_t type);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -167,14 +233,15 @@ static inline void gnrc_pktbuf_release(gnrc_pktsnip_t *pkt)
  * @brief   Must be called once before there is a write operation in a thread.
  *
  * @details This function duplicates a packet in the packet buffer if
- *          gnrc_pktsnip_t::users of @p pkt > 1.
+ *          gnrc_pktsnip_t::users of @p pkt > 1 or if @p pkt shares its data
+ *          (see gnrc_pktbuf_add_slice()).
  *
  * @note    Do *not* call this function in a thread twice on the same packet.
  *
  * @param[in] pkt   The packet you want to write into.
  *
  * @return  The (new) pointer to the pkt.
- * @return  NULL, if gnrc_pktsnip_t::users of @p pkt > 1 and if there is not
+ * @return  NULL, if @p pkt needs to be duplicated and if there is not
  *          enough space in the packet buffer.
  */
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt);
@@ -274,6 +341,29 @@ gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t t
  * @details Statistics include maximum number of reserved bytes.
  */
 void gnrc_pktbuf_stats(void);
+
+/**
+ * @brief   Usage statistics of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+typedef struct {
+    size_t used;            /**< number of bytes currently allocated */
+    size_t max_used;        /**< maximum of gnrc_pktbuf_usage_t::used */
+    uint32_t alloc_fails;   /**< number of allocations that failed for lack of space */
+} gnrc_pktbuf_usage_t;
+
+/**
+ * @brief   Gets usage statistics of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ *
+ * @param[out] usage    The current statistics.
+ * @param[in] reset     Restart gnrc_pktbuf_usage_t::max_used at the current
+ *                      usage and gnrc_pktbuf_usage_t::alloc_fails at 0 after
+ *                      reading.
+ */
+void gnrc_pktbuf_get_usage(gnrc_pktbuf_usage_t *usage, bool reset);
 #endif
 
 /* for testing */
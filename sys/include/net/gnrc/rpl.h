@@ -148,6 +148,9 @@ extern "C" {
 
 /**
  * @brief   Message type for lifetime updates
+ *
+ * @note    Only used by P2P-RPL. Parents, DAOs and instance cleanups are
+ *          scheduled with their own timers.
  */
 #define GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE     (0x0900)
 
@@ -166,6 +169,16 @@ extern "C" {
  */
 #define GNRC_RPL_MSG_TYPE_DAO_HANDLE  (0x0903)
 
+/**
+ * @brief   Message type for parent timeouts
+ */
+#define GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT      (0x0904)
+
+/**
+ * @brief   Message type for instance cleanups
+ */
+#define GNRC_RPL_MSG_TYPE_INSTANCE_CLEANUP    (0x0905)
+
 /**
  * @brief   Infinite rank
  * @see <a href="https://tools.ietf.org/html/rfc6550#section-17">
@@ -316,6 +329,14 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
 #define GNRC_RPL_DEFAULT_DAO_DELAY (5)
 /** @} */
 
+/**
+ * @brief Time in seconds before the expiry of a parent, at which the parent is
+ *        probed with a DIS
+ */
+#ifndef GNRC_RPL_PARENT_PROBE_TIME
+#define GNRC_RPL_PARENT_PROBE_TIME (GNRC_RPL_LIFETIME_UPDATE_STEP * 2)
+#endif
+
 /**
  * @brief Cleanup timeout in seconds
  */
@@ -538,6 +559,18 @@ void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag);
  */
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag);
 
+/**
+ * @brief   Schedule a DAO after the reception of a DAO from a child
+ *
+ * Contrary to @ref gnrc_rpl_delay_dao() an already scheduled DAO, which is due
+ * within @ref GNRC_RPL_DEFAULT_DAO_DELAY, is not postponed. Thus, the targets
+ * of all DAOs received within this period are announced to the preferred parent
+ * with one DAO.
+ *
+ * @param[in] dodag     The DODAG of the DAO
+ */
+void gnrc_rpl_aggregate_dao(gnrc_rpl_dodag_t *dodag);
+
 /**
  * @brief Create a new RPL instance and RPL DODAG.
  *
@@ -131,6 +131,30 @@ void gnrc_rpl_dodag_remove_all_parents(gnrc_rpl_dodag_t *dodag);
 bool gnrc_rpl_parent_add_by_addr(gnrc_rpl_dodag_t *dodag, ipv6_addr_t *addr,
                                  gnrc_rpl_parent_t **parent);
 
+/**
+ * @brief   Handle the timeout of @p parent.
+ *
+ * Sends a DIS to the @p parent, if its lifetime is about to expire, and removes
+ * the @p parent otherwise.
+ *
+ * @param[in] parent     Pointer to the parent.
+ */
+void gnrc_rpl_parent_timeout(gnrc_rpl_parent_t *parent);
+
+/**
+ * @brief   Schedule the removal of @p inst after @ref GNRC_RPL_CLEANUP_TIME.
+ *
+ * @param[in] inst     Pointer to the RPL instance.
+ */
+void gnrc_rpl_instance_cleanup_start(gnrc_rpl_instance_t *inst);
+
+/**
+ * @brief   Remove @p inst, if its DODAG has no parents and an infinite rank.
+ *
+ * @param[in] inst     Pointer to the RPL instance.
+ */
+void gnrc_rpl_instance_cleanup(gnrc_rpl_instance_t *inst);
+
 /**
  * @brief   Remove the @p parent from its DODAG.
  *
@@ -217,6 +217,8 @@ struct gnrc_rpl_parent {
     uint32_t lifetime;              /**< lifetime of this parent in seconds */
     double  link_metric;            /**< metric of the link */
     uint8_t link_metric_type;       /**< type of the metric */
+    xtimer_t timer;                 /**< timer for probing and timing out this parent */
+    msg_t timeout_msg;              /**< message for @ref gnrc_rpl_parent_t::timer */
 };
 
 /**
@@ -256,9 +258,12 @@ struct gnrc_rpl_dodag {
     uint8_t dao_seq;                /**< dao sequence number */
     uint8_t dao_counter;            /**< amount of retried DAOs */
     bool dao_ack_received;          /**< flag to check for DAO-ACK */
+    bool dao_pending;               /**< a DAO is scheduled with
+                                         @ref GNRC_RPL_DEFAULT_DAO_DELAY */
     uint8_t dio_opts;               /**< options in the next DIO
                                          (see @ref GNRC_RPL_REQ_DIO_OPTS "DIO Options") */
-    uint8_t dao_time;               /**< time to schedule a DAO in seconds */
+    xtimer_t dao_timer;             /**< timer to schedule the next DAO */
+    msg_t dao_msg;                  /**< message for @ref gnrc_rpl_dodag_t::dao_timer */
     trickle_t trickle;              /**< trickle representation */
 };
 
@@ -273,7 +278,10 @@ struct gnrc_rpl_instance {
     gnrc_rpl_of_t *of;              /**< configured Objective Function */
     uint16_t min_hop_rank_inc;      /**< minimum hop rank increase */
     uint16_t max_rank_inc;          /**< max increase in the rank */
-    int8_t cleanup;                 /**< cleanup time in seconds */
+    int8_t cleanup;                 /**< cleanup time in seconds, 0 if no
+                                         cleanup is pending */
+    xtimer_t cleanup_timer;         /**< timer to remove this instance */
+    msg_t cleanup_msg;              /**< message for @ref gnrc_rpl_instance_t::cleanup_timer */
 };
 
 #ifdef __cplusplus
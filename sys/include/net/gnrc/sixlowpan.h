@@ -128,6 +128,9 @@ extern "C" {
 
 /**
  * @brief   Default message queue size to use for the 6LoWPAN thread.
+ *
+ * With module `gnrc_event` this is the size of 6LoWPAN's ring of pending
+ * messages on the shared event thread. Must be a power of two.
  */
 #ifndef GNRC_SIXLOWPAN_MSG_QUEUE_SIZE
 #define GNRC_SIXLOWPAN_MSG_QUEUE_SIZE   (8U)
@@ -138,6 +141,8 @@ extern "C" {
  *
  * @details If 6LoWPAN was already initialized, it will just return the PID of
  *          the 6LoWPAN thread.
+ *          With module `gnrc_event` 6LoWPAN runs on the shared event thread
+ *          (see @ref net_gnrc_event) instead of its own thread.
  *
  * @return  The PID to the 6LoWPAN thread, on success.
  * @return  -EINVAL, if @ref GNRC_SIXLOWPAN_PRIO was greater than or equal to
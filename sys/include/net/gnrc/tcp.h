@@ -0,0 +1,472 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       GNRC's implementation of the TCP protocol
+ *
+ * All connections are handled by the TCP thread. Applications use them via
+ * @ref net_conn_tcp (module `gnrc_conn_tcp`) or the functions below, which
+ * pass requests to the TCP thread and block until they are answered.
+ *
+ * Data to send is copied into the packet buffer once, split into segments
+ * of at most one MSS. The segments stay in the send queue until they are
+ * acknowledged, every (re)transmission only adds a TCP header in front of
+ * the held segment. Likewise, received segments are queued without copying
+ * until the application reads them, so the receive window is bounded by
+ * @ref GNRC_TCP_RCV_BUFSIZE and @ref GNRC_TCP_RCV_SEGS.
+ *
+ * Implemented are:
+ * - sliding windows with window updates once the application read data
+ * - congestion control with slow start, congestion avoidance, fast
+ *   retransmit and fast recovery (RFC 5681)
+ * - retransmission timeout as of RFC 6298 and Karn's algorithm
+ * - delayed acknowledgements: every second full segment is acknowledged
+ *   immediately, otherwise after @ref GNRC_TCP_DELACK_MS
+ * - the MSS option
+ *
+ * Out-of-order segments are dropped (and answered with a duplicate
+ * acknowledgement), urgent data and further options are not supported.
+ *
+ * The timers of all connections are kept in one timer wheel, which is
+ * driven by a single xtimer that only runs while any timer is armed.
+ *
+ * For high throughput, increase @ref GNRC_TCP_SND_BUFSIZE,
+ * @ref GNRC_TCP_RCV_BUFSIZE and the segment queues together with
+ * `GNRC_PKTBUF_SIZE`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP GNRC definition
+ */
+
+#ifndef GNRC_TCP_H_
+#define GNRC_TCP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cib.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/ipv6/addr.h"
+#include "net/tcp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default message queue size for the TCP thread
+ */
+#ifndef GNRC_TCP_MSG_QUEUE_SIZE
+#define GNRC_TCP_MSG_QUEUE_SIZE (8U)
+#endif
+
+/**
+ * @brief   Priority of the TCP thread
+ */
+#ifndef GNRC_TCP_PRIO
+#define GNRC_TCP_PRIO           (THREAD_PRIORITY_MAIN - 2)
+#endif
+
+/**
+ * @brief   Default stack size to use for the TCP thread
+ */
+#ifndef GNRC_TCP_STACK_SIZE
+#define GNRC_TCP_STACK_SIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Number of connections (including listening ones and connections
+ *          waiting in TIME-WAIT)
+ */
+#ifndef GNRC_TCP_TCB_NUMOF
+#define GNRC_TCP_TCB_NUMOF      (4U)
+#endif
+
+/**
+ * @brief   Maximum segment size announced and used
+ *
+ * The MSS is further limited by the MTU of the interface.
+ */
+#ifndef GNRC_TCP_MSS
+#define GNRC_TCP_MSS            (1220U)
+#endif
+
+/**
+ * @brief   Maximum number of bytes in the send queue of a connection,
+ *          including unacknowledged ones
+ */
+#ifndef GNRC_TCP_SND_BUFSIZE
+#define GNRC_TCP_SND_BUFSIZE    (2048U)
+#endif
+
+/**
+ * @brief   Maximum number of segments in the send queue of a connection
+ *
+ * Must be a power of two.
+ */
+#ifndef GNRC_TCP_SND_SEGS
+#define GNRC_TCP_SND_SEGS       (8U)
+#endif
+
+/**
+ * @brief   Maximum number of received bytes a connection buffers, i.e. the
+ *          maximum receive window
+ */
+#ifndef GNRC_TCP_RCV_BUFSIZE
+#define GNRC_TCP_RCV_BUFSIZE    (2048U)
+#endif
+
+/**
+ * @brief   Maximum number of received segments a connection buffers
+ *
+ * Must be a power of two.
+ */
+#ifndef GNRC_TCP_RCV_SEGS
+#define GNRC_TCP_RCV_SEGS       (8U)
+#endif
+
+/**
+ * @brief   Granularity of the TCP timers in microseconds
+ */
+#ifndef GNRC_TCP_TICK_US
+#define GNRC_TCP_TICK_US        (10000U)
+#endif
+
+/**
+ * @brief   Number of slots of the timer wheel
+ *
+ * Must be a power of two.
+ */
+#ifndef GNRC_TCP_WHEEL_SIZE
+#define GNRC_TCP_WHEEL_SIZE     (32U)
+#endif
+
+/**
+ * @brief   Initial retransmission timeout in milliseconds
+ */
+#ifndef GNRC_TCP_RTO_INIT_MS
+#define GNRC_TCP_RTO_INIT_MS    (1000U)
+#endif
+
+/**
+ * @brief   Lower bound of the retransmission timeout in milliseconds
+ *
+ * Lower than the 1s of RFC 6298 to recover quickly from losses on links
+ * with short round trip times.
+ */
+#ifndef GNRC_TCP_RTO_MIN_MS
+#define GNRC_TCP_RTO_MIN_MS     (200U)
+#endif
+
+/**
+ * @brief   Upper bound of the retransmission timeout in milliseconds
+ */
+#ifndef GNRC_TCP_RTO_MAX_MS
+#define GNRC_TCP_RTO_MAX_MS     (60000U)
+#endif
+
+/**
+ * @brief   Number of retransmissions after which a connection is aborted
+ */
+#ifndef GNRC_TCP_MAX_RETRIES
+#define GNRC_TCP_MAX_RETRIES    (8U)
+#endif
+
+/**
+ * @brief   Maximum delay of an acknowledgement in milliseconds
+ */
+#ifndef GNRC_TCP_DELACK_MS
+#define GNRC_TCP_DELACK_MS      (40U)
+#endif
+
+/**
+ * @brief   Time a closed connection stays in TIME-WAIT in milliseconds
+ */
+#ifndef GNRC_TCP_TIME_WAIT_MS
+#define GNRC_TCP_TIME_WAIT_MS   (4000U)
+#endif
+
+/**
+ * @brief   Time a closed connection waits in FIN-WAIT-2 for the peer's FIN
+ *          in milliseconds
+ *
+ * The application can not receive anymore, so the connection is dropped if
+ * the peer does not close it in time.
+ */
+#ifndef GNRC_TCP_FIN_WAIT_2_MS
+#define GNRC_TCP_FIN_WAIT_2_MS  (60000U)
+#endif
+
+/**
+ * @brief   Number of duplicate acknowledgements that trigger a fast
+ *          retransmit
+ */
+#ifndef GNRC_TCP_DUPACK_THRESH
+#define GNRC_TCP_DUPACK_THRESH  (3U)
+#endif
+
+/**
+ * @brief   Connection states (RFC 793)
+ */
+typedef enum {
+    GNRC_TCP_STATE_CLOSED = 0,      /**< no connection */
+    GNRC_TCP_STATE_LISTEN,          /**< waiting for connection requests */
+    GNRC_TCP_STATE_SYN_SENT,        /**< sent a connection request */
+    GNRC_TCP_STATE_SYN_RCVD,        /**< received a connection request */
+    GNRC_TCP_STATE_ESTABLISHED,     /**< connection is open */
+    GNRC_TCP_STATE_FIN_WAIT_1,      /**< closed, FIN not acknowledged yet */
+    GNRC_TCP_STATE_FIN_WAIT_2,      /**< closed, waiting for peer's FIN */
+    GNRC_TCP_STATE_CLOSE_WAIT,      /**< peer closed, waiting for close */
+    GNRC_TCP_STATE_CLOSING,         /**< both closed, FIN not acknowledged */
+    GNRC_TCP_STATE_LAST_ACK,        /**< both closed, waiting for last ACK */
+    GNRC_TCP_STATE_TIME_WAIT,       /**< both closed, waiting for stray
+                                     *   segments */
+} gnrc_tcp_state_t;
+
+/**
+ * @brief   Timer in the timer wheel of the TCP thread
+ */
+typedef struct gnrc_tcp_timer {
+    struct gnrc_tcp_timer *next;    /**< next timer in the same slot */
+    uint32_t expiry;                /**< tick the timer expires at */
+    uint8_t armed;                  /**< timer is in the wheel */
+    uint8_t type;                   /**< which timer of the connection */
+} gnrc_tcp_timer_t;
+
+/**
+ * @brief   Segment in the send queue
+ */
+typedef struct {
+    gnrc_pktsnip_t *data;           /**< payload, held by the queue */
+    uint32_t seq;                   /**< sequence number of the first byte */
+} gnrc_tcp_seg_t;
+
+/**
+ * @brief   Transmission control block, i.e. the state of a connection
+ *
+ * Only to be accessed by the TCP thread.
+ */
+typedef struct gnrc_tcp_tcb {
+    ipv6_addr_t local_addr;         /**< local address, may be unspecified
+                                     *   for listening connections */
+    ipv6_addr_t peer_addr;          /**< address of the peer */
+    uint16_t local_port;            /**< local port, 0 if not in use */
+    uint16_t peer_port;             /**< port of the peer */
+    kernel_pid_t iface;             /**< interface to send over, or
+                                     *   KERNEL_PID_UNDEF */
+    uint8_t state;                  /**< state (see @ref gnrc_tcp_state_t) */
+    uint16_t flags;                 /**< internal flags */
+    int8_t error;                   /**< negative errno the connection was
+                                     *   closed with */
+    uint8_t dupacks;                /**< number of duplicate ACKs received */
+    uint8_t retries;                /**< number of retransmissions of the
+                                     *   oldest unacknowledged segment */
+    uint8_t backlog;                /**< maximum number of connections
+                                     *   waiting to be accepted (LISTEN) */
+    struct gnrc_tcp_tcb *parent;    /**< listening connection of a
+                                     *   connection not accepted yet */
+    /* send sequence space */
+    uint32_t iss;                   /**< initial send sequence number */
+    uint32_t snd_una;               /**< oldest unacknowledged number */
+    uint32_t snd_nxt;               /**< next sequence number to send */
+    uint32_t snd_max;               /**< highest sequence number sent */
+    uint32_t snd_wnd;               /**< send window of the peer */
+    uint32_t snd_wl1;               /**< segment sequence number of the last
+                                     *   window update */
+    uint32_t snd_wl2;               /**< segment acknowledgement number of
+                                     *   the last window update */
+    uint32_t recover;               /**< snd_max when fast recovery began */
+    uint16_t mss;                   /**< maximum segment size to send */
+    /* congestion control */
+    uint32_t cwnd;                  /**< congestion window */
+    uint32_t ssthresh;              /**< slow start threshold */
+    /* receive sequence space */
+    uint32_t irs;                   /**< initial receive sequence number */
+    uint32_t rcv_nxt;               /**< next sequence number expected */
+    uint32_t rcv_adv;               /**< right edge of the advertised
+                                     *   window */
+    /* round trip time estimation, in ticks */
+    uint32_t srtt;                  /**< smoothed RTT, scaled by 8 */
+    uint32_t rttvar;                /**< RTT variation, scaled by 4 */
+    uint32_t rto;                   /**< retransmission timeout */
+    uint32_t rtt_seq;               /**< sequence number being timed */
+    uint32_t rtt_start;             /**< tick the timed segment was sent */
+    /* queues */
+    gnrc_tcp_seg_t snd_segs[GNRC_TCP_SND_SEGS]; /**< send queue */
+    cib_t snd_cib;                  /**< indices of the send queue */
+    unsigned snd_next;              /**< count of the next segment to send,
+                                     *   in terms of gnrc_tcp_tcb_t::snd_cib */
+    size_t snd_queued;              /**< number of bytes in the send queue */
+    gnrc_pktsnip_t *rcv_segs[GNRC_TCP_RCV_SEGS];    /**< receive queue */
+    cib_t rcv_cib;                  /**< indices of the receive queue */
+    size_t rcv_queued;              /**< number of unread bytes */
+    size_t rcv_offset;              /**< bytes read from the oldest
+                                     *   received segment */
+    /* timers */
+    gnrc_tcp_timer_t rtx_timer;     /**< retransmission, persist,
+                                     *   FIN-WAIT-2 and TIME-WAIT timer */
+    gnrc_tcp_timer_t ack_timer;     /**< delayed ACK timer */
+    /* requests waiting for the connection */
+    msg_t rcv_waiter;               /**< pending receive, accept or connect */
+    msg_t snd_waiter;               /**< pending send */
+} gnrc_tcp_tcb_t;
+
+/**
+ * @brief   Allocates a connection and binds it to a local address and port
+ *
+ * @param[out] tcb  the new connection
+ * @param[in] addr  local address, may be unspecified
+ * @param[in] port  local port, 0 for an ephemeral port
+ *
+ * @return  0 on success
+ * @return  -EADDRINUSE if @p port is in use
+ * @return  -ENOMEM if there is no free connection
+ */
+int gnrc_tcp_open(gnrc_tcp_tcb_t **tcb, const ipv6_addr_t *addr,
+                  uint16_t port);
+
+/**
+ * @brief   Connects to a peer
+ *
+ * Blocks until the connection is established or failed.
+ *
+ * @param[in] tcb   a connection
+ * @param[in] addr  address of the peer
+ * @param[in] port  port of the peer
+ *
+ * @return  0 on success
+ * @return  -EISCONN if @p tcb is already in use
+ * @return  -ENETUNREACH if there is no source address for @p addr
+ * @return  -ECONNREFUSED if the peer refused the connection
+ * @return  -ETIMEDOUT if the peer did not answer
+ */
+int gnrc_tcp_connect(gnrc_tcp_tcb_t *tcb, const ipv6_addr_t *addr,
+                     uint16_t port);
+
+/**
+ * @brief   Listens for connection requests
+ *
+ * @param[in] tcb       a connection
+ * @param[in] backlog   maximum number of connections waiting to be accepted
+ *
+ * @return  0 on success
+ * @return  -EISCONN if @p tcb is already in use
+ */
+int gnrc_tcp_listen(gnrc_tcp_tcb_t *tcb, unsigned backlog);
+
+/**
+ * @brief   Accepts a connection on a listening connection
+ *
+ * Blocks until a connection was established.
+ *
+ * @param[in] tcb   a listening connection
+ * @param[out] out  the accepted connection
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p tcb is not listening
+ */
+int gnrc_tcp_accept(gnrc_tcp_tcb_t *tcb, gnrc_tcp_tcb_t **out);
+
+/**
+ * @brief   Queues data to send
+ *
+ * Blocks until at least one byte was queued.
+ *
+ * @param[in] tcb   a connection
+ * @param[in] data  data to send
+ * @param[in] len   length of @p data
+ *
+ * @return  number of bytes queued
+ * @return  -ENOTCONN if @p tcb is not connected
+ * @return  -EPIPE if @p tcb was closed for sending
+ * @return  -ENOMEM if the packet buffer is full
+ * @return  the error the connection was aborted with
+ */
+int gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, size_t len);
+
+/**
+ * @brief   Receives data
+ *
+ * Blocks until data was received or the peer closed the connection.
+ *
+ * @param[in] tcb       a connection
+ * @param[out] data     buffer for the data
+ * @param[in] max_len   size of @p data
+ *
+ * @return  number of bytes received
+ * @return  0 if the peer closed the connection
+ * @return  -ENOTCONN if @p tcb is not connected
+ * @return  the error the connection was aborted with
+ */
+int gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, size_t max_len);
+
+/**
+ * @brief   Closes a connection
+ *
+ * Returns immediately, queued data is still sent. @p tcb must not be used
+ * afterwards.
+ *
+ * @param[in] tcb   a connection
+ */
+void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief   Calculate the checksum for the given packet
+ *
+ * @param[in] hdr           Pointer to the TCP header
+ * @param[in] pseudo_hdr    Pointer to the network layer header
+ *
+ * @return  0 on success
+ * @return  -EBADMSG if @p hdr is not of type GNRC_NETTYPE_TCP
+ * @return  -EFAULT if @p hdr or @p pseudo_hdr is NULL
+ * @return  -ENOENT if gnrc_pktsnip_t::type of @p pseudo_hdr is not known
+ */
+int gnrc_tcp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr);
+
+/**
+ * @brief   Initialize and start TCP
+ *
+ * @return  PID of the TCP thread
+ * @return  negative value on error
+ */
+int gnrc_tcp_init(void);
+
+#ifdef TEST_SUITES
+/**
+ * @brief   Passes a received segment to TCP
+ *
+ * As long as gnrc_tcp_init() was not called, TCP runs in the calling
+ * thread: the functions above return -EINPROGRESS instead of blocking and
+ * the timers only advance with gnrc_tcp_test_tick().
+ *
+ * @param[in] pkt   a segment as passed up by IPv6
+ */
+void gnrc_tcp_test_receive(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Advances the timers by one tick of @ref GNRC_TCP_TICK_US
+ */
+void gnrc_tcp_test_tick(void);
+
+/**
+ * @brief   Frees all connections
+ */
+void gnrc_tcp_test_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_H_ */
+/** @} */
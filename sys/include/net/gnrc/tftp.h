@@ -88,6 +88,16 @@ extern "C" {
 #define GNRC_TFTP_DEFAULT_TIMEOUT           (1 * SEC_IN_USEC)
 #endif
 
+/**
+ * @brief The number of transfers a TFTP server serves simultaneously
+ *
+ * All transfers run as @ref sys_coro "coroutines" on the server's thread, so
+ * each one only costs a transfer context, not a thread.
+ */
+#ifndef GNRC_TFTP_SERVER_TRANSFERS
+#define GNRC_TFTP_SERVER_TRANSFERS          (2)
+#endif
+
 /**
  * @brief TFTP action to perform
  */
@@ -151,6 +161,16 @@ typedef void (*tftp_stop_cb_t)(tftp_event_t event, const char *msg);
  */
 int gnrc_tftp_server(tftp_data_cb_t data_cb, tftp_start_cb_t start_cb, tftp_stop_cb_t stop_cb, bool use_options);
 
+/**
+ * @brief Get the file name of the transfer a callback is called for
+ *
+ * As a server serves up to @ref GNRC_TFTP_SERVER_TRANSFERS transfers at once,
+ * callbacks can use this to tell the transfers apart.
+ *
+ * @return the file name of the current transfer, only valid within a callback
+ */
+const char *gnrc_tftp_transfer_file_name(void);
+
 /**
  * @brief Stop the TFTP server
  *
@@ -34,6 +34,9 @@ extern "C" {
 
 /**
  * @brief   Default message queue size for the UDP thread
+ *
+ * With module `gnrc_event` this is the size of UDP's ring of pending messages
+ * on the shared event thread. Must be a power of two.
  */
 #ifndef GNRC_UDP_MSG_QUEUE_SIZE
 #define GNRC_UDP_MSG_QUEUE_SIZE (8U)
@@ -83,6 +86,9 @@ gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
 /**
  * @brief   Initialize and start UDP
  *
+ * With module `gnrc_event` UDP runs on the shared event thread
+ * (see @ref net_gnrc_event) instead of its own thread.
+ *
  * @return  PID of the UDP thread
  * @return  negative value on error
  */
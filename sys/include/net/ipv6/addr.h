@@ -192,6 +192,39 @@ typedef union {
                                                0x00, 0x00, 0x00, 0x01, \
                                                0xff, 0x00, 0x00, 0x00 }}
 
+/**
+ * @cond INTERNAL
+ */
+#define _IPV6_ADDR_MASK_BYTE(bits, i) \
+    (((bits) >= (8 * ((i) + 1))) ? 0xff : \
+     ((bits) <= (8 * (i))) ? 0x00 : ((0xff << ((8 * ((i) + 1)) - (bits))) & 0xff))
+/** @endcond */
+
+/**
+ * @brief   Static initializer for the mask of a prefix of length @p bits
+ *
+ * @p bits must be a constant between 0 and 128. The mask can be used with
+ * ipv6_addr_match_mask() and ipv6_addr_init_prefix_mask().
+ *
+ * @param[in] bits  length of the prefix
+ */
+#define IPV6_ADDR_MASK(bits)    {{ _IPV6_ADDR_MASK_BYTE(bits, 0), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 1), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 2), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 3), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 4), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 5), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 6), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 7), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 8), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 9), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 10), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 11), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 12), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 13), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 14), \
+                                   _IPV6_ADDR_MASK_BYTE(bits, 15) }}
+
 /**
  * @name    Multicast address flags
  * @brief   Values for the flag field in multicast addresses.
@@ -529,6 +562,9 @@ uint8_t ipv6_addr_match_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b);
  * @brief   Sets IPv6 address @p out with the first @p bits taken
  *          from @p prefix and leaves the remaining bits untouched.
  *
+ * @note    @p out is read and written as a whole, so it must be a complete
+ *          IPv6 address even if @p bits is small.
+ *
  * @param[out]  out     Prefix to be set.
  * @param[in]   prefix  Address to take prefix from.
  * @param[in]   bits    Bits to be copied from @p prefix to @p out
@@ -536,6 +572,54 @@ uint8_t ipv6_addr_match_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b);
  */
 void ipv6_addr_init_prefix(ipv6_addr_t *out, const ipv6_addr_t *prefix, uint8_t bits);
 
+/**
+ * @brief   Sets @p mask to the mask of a prefix of length @p bits
+ *
+ * For prefix lengths that are used for many addresses, computing the mask
+ * once and using ipv6_addr_match_mask() and ipv6_addr_init_prefix_mask() is
+ * cheaper than ipv6_addr_match_prefix() and ipv6_addr_init_prefix(). For
+ * constant prefix lengths see @ref IPV6_ADDR_MASK.
+ *
+ * @param[out]  mask    The mask.
+ * @param[in]   bits    Length of the prefix (set to 128 when greater than
+ *                      128).
+ */
+void ipv6_addr_init_mask(ipv6_addr_t *mask, uint8_t bits);
+
+/**
+ * @brief   Checks if two IPv6 addresses match in the bits set in @p mask.
+ *
+ * @param[in] a     An IPv6 address.
+ * @param[in] b     Another IPv6 address.
+ * @param[in] mask  A mask, see ipv6_addr_init_mask().
+ *
+ * @return  true, if @p a and @p b match in all bits set in @p mask.
+ * @return  false, otherwise.
+ */
+static inline bool ipv6_addr_match_mask(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                                        const ipv6_addr_t *mask)
+{
+    return (((a->u64[0].u64 ^ b->u64[0].u64) & mask->u64[0].u64) |
+            ((a->u64[1].u64 ^ b->u64[1].u64) & mask->u64[1].u64)) == 0;
+}
+
+/**
+ * @brief   Sets the bits of @p out that are set in @p mask to those of
+ *          @p prefix and leaves the remaining bits untouched.
+ *
+ * @param[in,out] out   IPv6 address to be set.
+ * @param[in] prefix    Address to take the prefix from.
+ * @param[in] mask      A mask, see ipv6_addr_init_mask().
+ */
+static inline void ipv6_addr_init_prefix_mask(ipv6_addr_t *out, const ipv6_addr_t *prefix,
+                                              const ipv6_addr_t *mask)
+{
+    out->u64[0].u64 = (out->u64[0].u64 & ~mask->u64[0].u64) |
+                      (prefix->u64[0].u64 & mask->u64[0].u64);
+    out->u64[1].u64 = (out->u64[1].u64 & ~mask->u64[1].u64) |
+                      (prefix->u64[1].u64 & mask->u64[1].u64);
+}
+
 /**
  * @brief   Sets the last @p bits of IPv6 address @p out to @p iid.
  *          Leading bits of @p out stay untouched.
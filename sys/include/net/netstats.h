@@ -23,6 +23,10 @@
 #ifndef NETSTATS_H
 #define NETSTATS_H
 
+#if defined(MODULE_GNRC_NETDEV2_TXQ) || defined(DOXYGEN)
+#include "net/gnrc/netdev2/txq.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +40,14 @@ extern "C" {
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
+#if defined(MODULE_GNRC_NETDEV2_TXQ) || defined(DOXYGEN)
+/**
+ * @brief       Number of transmit priority classes counted separately, see
+ *              @ref gnrc_netdev2_txq_class_t
+ */
+#define NETSTATS_TX_CLASSES (GNRC_NETDEV2_TXQ_NUMOF)
+#endif
+
 /**
  * @brief       Global statistics struct
  */
@@ -50,6 +62,16 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+    uint32_t isr_lost;          /**< device interrupts lost because the
+                                     interface thread could not be notified */
+#if defined(MODULE_GNRC_NETDEV2_TXQ) || defined(DOXYGEN)
+    uint32_t tx_class_count[NETSTATS_TX_CLASSES];   /**< packets sent per
+                                                         priority class */
+    uint32_t tx_class_dropped[NETSTATS_TX_CLASSES]; /**< packets dropped per
+                                                         priority class
+                                                         because the transmit
+                                                         queue was full */
+#endif
 } netstats_t;
 
 #ifdef __cplusplus
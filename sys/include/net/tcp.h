@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_tcp TCP
+ * @ingroup     net
+ * @brief       Provides TCP header definitions
+ * @see         <a href="https://tools.ietf.org/html/rfc793">
+ *                  RFC 793
+ *              </a>
+ * @{
+ *
+ * @file
+ * @brief   TCP header definitions
+ */
+#ifndef TCP_H_
+#define TCP_H_
+
+#include <stddef.h>
+
+#include "byteorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    TCP control flags
+ * @{
+ */
+#define TCP_FLAG_FIN            (0x0001)  /**< no more data from sender */
+#define TCP_FLAG_SYN            (0x0002)  /**< synchronize sequence numbers */
+#define TCP_FLAG_RST            (0x0004)  /**< reset the connection */
+#define TCP_FLAG_PSH            (0x0008)  /**< push function */
+#define TCP_FLAG_ACK            (0x0010)  /**< acknowledgement field is significant */
+#define TCP_FLAG_URG            (0x0020)  /**< urgent pointer field is significant */
+#define TCP_FLAGS_MASK          (0x003f)  /**< all control flags */
+/** @} */
+
+/**
+ * @name    TCP options
+ * @{
+ */
+#define TCP_OPTION_KIND_EOL     (0U)    /**< end of option list */
+#define TCP_OPTION_KIND_NOP     (1U)    /**< no operation */
+#define TCP_OPTION_KIND_MSS     (2U)    /**< maximum segment size */
+#define TCP_OPTION_LENGTH_MSS   (4U)    /**< length of the MSS option */
+/** @} */
+
+/**
+ * @brief   Minimum size of a TCP header, i.e. without options
+ */
+#define TCP_HDR_MIN_SIZE        (20U)
+
+/**
+ * @brief   TCP header
+ */
+typedef struct __attribute__((packed)) {
+    network_uint16_t src_port;      /**< source port */
+    network_uint16_t dst_port;      /**< destination port */
+    network_uint32_t seq_num;       /**< sequence number */
+    network_uint32_t ack_num;       /**< acknowledgement number */
+    network_uint16_t off_ctl;       /**< data offset (4 bit), reserved and
+                                     *   control flags */
+    network_uint16_t window;        /**< receive window */
+    network_uint16_t checksum;      /**< checksum */
+    network_uint16_t urgent_ptr;    /**< urgent pointer */
+} tcp_hdr_t;
+
+/**
+ * @brief   Gets the length of a TCP header including options
+ *
+ * @param[in] hdr   a TCP header
+ *
+ * @return  length of @p hdr in bytes
+ */
+static inline size_t tcp_hdr_get_len(const tcp_hdr_t *hdr)
+{
+    return (byteorder_ntohs(hdr->off_ctl) >> 12) * 4;
+}
+
+/**
+ * @brief   Gets the control flags of a TCP header
+ *
+ * @param[in] hdr   a TCP header
+ *
+ * @return  the control flags of @p hdr
+ */
+static inline uint16_t tcp_hdr_get_flags(const tcp_hdr_t *hdr)
+{
+    return byteorder_ntohs(hdr->off_ctl) & TCP_FLAGS_MASK;
+}
+
+/**
+ * @brief   Sets the length and control flags of a TCP header
+ *
+ * @param[out] hdr  a TCP header
+ * @param[in] len   length of @p hdr in bytes, must be a multiple of 4
+ * @param[in] flags control flags
+ */
+static inline void tcp_hdr_set_off_ctl(tcp_hdr_t *hdr, size_t len,
+                                       uint16_t flags)
+{
+    hdr->off_ctl = byteorder_htons((uint16_t)(((len / 4) << 12) | flags));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCP_H_ */
+/** @} */
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_saul_sampler SAUL sampler
+ * @ingroup     sys_saul_reg
+ * @brief       Periodic sampling of SAUL devices into a ring of records
+ *
+ * A sampler reads a set of SAUL devices, each at its own interval, and
+ * stores the results as compact records in a ring buffer. All devices of a
+ * sampler share one xtimer. When it fires, all devices due are read in one
+ * pass on the thread owning the sampler's @ref core_event queue. Multi-axis
+ * sensors keep all their values in one record.
+ *
+ * The devices are looked up once when the entries are set up, consumers
+ * stream the records with saul_sampler_read(), e.g. from the sampler's
+ * callback, which is called after every pass. If the ring is full, the
+ * oldest record is overwritten.
+ *
+ * All memory is provided by the user:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static saul_sampler_entry_t entries[2];
+ * static saul_sampler_rec_t ring[16];
+ * static saul_sampler_t sampler;
+ *
+ * entries[0].dev = saul_reg_find_type(SAUL_SENSE_TEMP);
+ * entries[0].interval = 10 * SEC_IN_USEC;
+ * entries[1].dev = saul_reg_find_type(SAUL_SENSE_ACCEL);
+ * entries[1].interval = 100 * MS_IN_USEC;
+ * saul_sampler_init(&sampler, entries, 2, ring, 16, _store, NULL);
+ * saul_sampler_start(&sampler, &queue);
+ * event_loop(&queue);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       SAUL sampler interface definition
+ */
+
+#ifndef SAUL_SAMPLER_H
+#define SAUL_SAMPLER_H
+
+#include <stdint.h>
+
+#include "cib.h"
+#include "event.h"
+#include "phydat.h"
+#include "saul_reg.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Device of a sampler
+ */
+typedef struct {
+    saul_reg_t *dev;        /**< the device, NULL to skip the entry */
+    uint32_t interval;      /**< sampling interval in microseconds, 0 to
+                             *   skip the entry */
+    uint32_t due;           /**< time of the next sample (set by the sampler) */
+} saul_sampler_entry_t;
+
+/**
+ * @brief   Sample record
+ */
+typedef struct {
+    uint32_t time;          /**< xtimer_now() at the time of reading */
+    uint8_t entry;          /**< index of the entry read */
+    uint8_t dim;            /**< number of values in saul_sampler_rec_t::data */
+    phydat_t data;          /**< the values read */
+} saul_sampler_rec_t;
+
+/**
+ * @brief   Sampler type
+ */
+typedef struct saul_sampler saul_sampler_t;
+
+/**
+ * @brief   Callback called after each sampling pass
+ *
+ * Runs on the thread owning the queue given to saul_sampler_start().
+ *
+ * @param[in] sampler   The sampler
+ * @param[in] arg       User argument
+ */
+typedef void (*saul_sampler_cb_t)(saul_sampler_t *sampler, void *arg);
+
+/**
+ * @brief   Sampler structure
+ *
+ * @note    Use saul_sampler_init() to initialize it.
+ */
+struct saul_sampler {
+    event_t event;                      /**< posted when entries are due */
+    xtimer_t timer;                     /**< timer of the next due entry */
+    event_queue_t *queue;               /**< queue @ref saul_sampler_t::event
+                                         *   is posted to, NULL if stopped */
+    saul_sampler_entry_t *entries;      /**< the devices to sample */
+    unsigned entries_numof;             /**< number of entries */
+    saul_sampler_rec_t *ring;           /**< ring buffer of the records */
+    cib_t cib;                          /**< index of saul_sampler_t::ring */
+    saul_sampler_cb_t cb;               /**< callback, may be NULL */
+    void *arg;                          /**< argument of saul_sampler_t::cb */
+    uint32_t dropped;                   /**< number of overwritten records */
+    uint32_t errors;                    /**< number of failed reads */
+};
+
+/**
+ * @brief   Initializes a sampler
+ *
+ * @param[out] sampler      The sampler
+ * @param[in] entries       The devices to sample, at most 256
+ * @param[in] entries_numof Number of entries in @p entries
+ * @param[in] ring          Ring buffer for the records
+ * @param[in] ring_size     Number of records in @p ring, must be a power of 2
+ * @param[in] cb            Callback called after each pass, may be NULL
+ * @param[in] arg           Argument of @p cb
+ */
+void saul_sampler_init(saul_sampler_t *sampler, saul_sampler_entry_t *entries,
+                       unsigned entries_numof, saul_sampler_rec_t *ring,
+                       unsigned ring_size, saul_sampler_cb_t cb, void *arg);
+
+/**
+ * @brief   Starts sampling
+ *
+ * All entries are sampled right away, then at their interval.
+ *
+ * @param[in] sampler   An initialized sampler
+ * @param[in] queue     Event queue of the thread that reads the devices
+ */
+void saul_sampler_start(saul_sampler_t *sampler, event_queue_t *queue);
+
+/**
+ * @brief   Stops sampling
+ *
+ * Must be called from the thread owning the sampler's queue, this includes
+ * the sampler's callback.
+ *
+ * @param[in] sampler   A started sampler
+ */
+void saul_sampler_stop(saul_sampler_t *sampler);
+
+/**
+ * @brief   Takes the oldest record from the ring
+ *
+ * @param[in] sampler   A sampler
+ * @param[out] rec      The record
+ *
+ * @return  1, if a record was taken
+ * @return  0, if the ring is empty
+ */
+int saul_sampler_read(saul_sampler_t *sampler, saul_sampler_rec_t *rec);
+
+/**
+ * @brief   Gets the number of records in the ring
+ *
+ * @param[in] sampler   A sampler
+ *
+ * @return  number of records that can be read
+ */
+unsigned saul_sampler_avail(saul_sampler_t *sampler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAUL_SAMPLER_H */
+/** @} */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_seqlock Sequence lock
+ * @ingroup     sys
+ * @brief       Lock-free reads of data that is written by a single writer
+ *
+ * The writer increments a sequence counter before and after every update,
+ * so the counter is odd while an update is in progress. A reader copies the
+ * data and afterwards checks that the counter was even and did not change;
+ * otherwise the copy may be torn and must be discarded.
+ *
+ * In contrast to the usual seqlock, readers should not spin until the copy
+ * succeeds: with strict priority scheduling, a reader preempting the writer
+ * would spin forever. Instead, a reader whose copy failed should get the
+ * data in some other (blocking) way.
+ *
+ * Only compiler barriers are used, so the writer and the readers must run
+ * on the same CPU core.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sequence lock interface
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sequence lock
+ */
+typedef struct {
+    volatile unsigned seq;  /**< sequence counter, odd during an update */
+} seqlock_t;
+
+/**
+ * @brief   Static initializer for @ref seqlock_t
+ */
+#define SEQLOCK_INIT    { 0 }
+
+/**
+ * @cond INTERNAL
+ */
+#define _SEQLOCK_BARRIER()  __asm__ volatile ("" : : : "memory")
+/** @endcond */
+
+/**
+ * @brief   Starts an update of the protected data
+ *
+ * @param[in] lock  the lock
+ */
+static inline void seqlock_write_begin(seqlock_t *lock)
+{
+    lock->seq++;
+    _SEQLOCK_BARRIER();
+}
+
+/**
+ * @brief   Ends an update of the protected data
+ *
+ * @param[in] lock  the lock
+ */
+static inline void seqlock_write_end(seqlock_t *lock)
+{
+    _SEQLOCK_BARRIER();
+    lock->seq++;
+}
+
+/**
+ * @brief   Starts reading the protected data
+ *
+ * @param[in] lock  the lock
+ *
+ * @return  sequence number to pass to seqlock_read_valid()
+ */
+static inline unsigned seqlock_read_begin(const seqlock_t *lock)
+{
+    unsigned seq = lock->seq;
+    _SEQLOCK_BARRIER();
+    return seq;
+}
+
+/**
+ * @brief   Checks whether the data read since seqlock_read_begin() is
+ *          consistent
+ *
+ * @param[in] lock  the lock
+ * @param[in] seq   return value of seqlock_read_begin()
+ *
+ * @return  1 if the data is consistent, 0 if it must be discarded
+ */
+static inline int seqlock_read_valid(const seqlock_t *lock, unsigned seq)
+{
+    _SEQLOCK_BARRIER();
+    return !(seq & 1) && (lock->seq == seq);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQLOCK_H */
+/** @} */
@@ -19,6 +19,19 @@
  * This ringbuffer implementation can be used without locking if
  * there's only one producer and one consumer.
  *
+ * Single producer, single consumer (SPSC) mode: one context (thread or ISR)
+ * may call the add and write functions while another context calls the get,
+ * peek and read functions, without disabling interrupts. Each side only
+ * writes its own counter (tsrb_t::writes or tsrb_t::reads), and only after
+ * the data was copied. This relies on a single core, as there are no memory
+ * barriers beyond compiler barriers. Several producers or several consumers
+ * need external locking.
+ *
+ * Bulk operations copy the data with at most two memcpy() calls. The span
+ * functions (tsrb_write_span(), tsrb_read_span()) give direct access to the
+ * contiguous part of the free space or the data, e.g. to let a driver
+ * receive into the buffer without an intermediate copy.
+ *
  * @note Buffer size must be a power of two!
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
@@ -128,6 +141,34 @@ int tsrb_get_one(tsrb_t *rb);
  */
 int tsrb_get(tsrb_t *rb, char *dst, size_t n);
 
+/**
+ * @brief       Get bytes from ringbuffer, without removing them
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ * @return      nr of bytes written to @p dst
+ */
+int tsrb_peek(const tsrb_t *rb, char *dst, size_t n);
+
+/**
+ * @brief       Get the contiguous data at the start of the ringbuffer
+ *
+ * The data stays in the ringbuffer until it is removed with
+ * tsrb_read_commit(). The ringbuffer may hold more data after a wrap-around.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the data
+ * @return      nr of bytes readable at @p data
+ */
+unsigned tsrb_read_span(const tsrb_t *rb, char **data);
+
+/**
+ * @brief       Remove bytes from the start of the ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to remove, at most tsrb_avail()
+ */
+void tsrb_read_commit(tsrb_t *rb, unsigned n);
+
 /**
  * @brief       Add a byte to ringbuffer
  * @param[in]   rb  Ringbuffer to operate on
@@ -146,6 +187,25 @@ int tsrb_add_one(tsrb_t *rb, char c);
  */
 int tsrb_add(tsrb_t *rb, const char *src, size_t n);
 
+/**
+ * @brief       Get the contiguous free space at the end of the ringbuffer
+ *
+ * Bytes written to the space are added to the ringbuffer with
+ * tsrb_write_commit(). There may be more free space after a wrap-around.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the free space
+ * @return      nr of bytes writable at @p data
+ */
+unsigned tsrb_write_span(const tsrb_t *rb, char **data);
+
+/**
+ * @brief       Add bytes written to the span of tsrb_write_span()
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to add, at most the size of the span
+ */
+void tsrb_write_commit(tsrb_t *rb, unsigned n);
+
 #ifdef __cplusplus
 }
 #endif
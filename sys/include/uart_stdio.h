@@ -23,6 +23,7 @@
 /* Boards may override the default STDIO UART device */
 #include <stdint.h>
 #include "board.h"
+#include "uart_async.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,17 @@ extern "C" {
 #define UART_STDIO_RX_BUFSIZE    (64)
 #endif
 
+#ifndef UART_STDIO_TX_POLICY
+/**
+ * @brief Behavior of writes when the TX buffer is full
+ *
+ * Output is written through @ref drivers_uart_async, so writes return as
+ * soon as the data is buffered. Set to @ref UART_ASYNC_DROP to never wait
+ * for the UART.
+ */
+#define UART_STDIO_TX_POLICY     (UART_ASYNC_BLOCK)
+#endif
+
 /**
  * @brief initialize the module
  */
@@ -92,6 +92,20 @@ universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_
  */
 void universal_address_rem(universal_address_container_t *entry);
 
+/**
+ * @brief Find the container of a given address without changing its
+ *        universal_address_container_t::use_count.
+ *        Since every address is stored only once, two entries hold the same
+ *        address if and only if they point to the same container.
+ *
+ * @param[in] addr       pointer to the address
+ * @param[in] addr_size  the number of bytes of the address
+ *
+ * @return pointer to the universal_address_container_t containing the address
+ * @return NULL if the address is not in use
+ */
+universal_address_container_t *universal_address_search(uint8_t *addr, size_t addr_size);
+
 /**
  * @brief Copy the address from the given container to the provided pointer
  *
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_binary
+ * @{
+ *
+ * @file
+ * @brief       Binary log module implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "log_module.h"
+
+#define MASK    (LOG_BINARY_BUFSIZE - 1)
+
+/* MASK only wraps the indices correctly for a power of 2 */
+typedef char _log_binary_bufsize_check[
+    ((LOG_BINARY_BUFSIZE & MASK) == 0) ? 1 : -1];
+
+static uint32_t _buf[LOG_BINARY_BUFSIZE];
+static unsigned _head, _tail;
+static unsigned _dropped;
+
+void log_binary_write(const uint32_t *rec, unsigned len)
+{
+    /* the buffer is shared by all threads and ISRs, masking interrupts for a
+     * handful of stores is cheaper than any lock */
+    unsigned state = irq_disable();
+
+    if ((LOG_BINARY_BUFSIZE - (_head - _tail)) < len) {
+        _dropped++;
+    }
+    else {
+        for (unsigned i = 0; i < len; i++) {
+            _buf[(_head + i) & MASK] = rec[i];
+        }
+        _head += len;
+    }
+    irq_restore(state);
+}
+
+/* removes the oldest record, returns its length or 0 if there is none */
+static unsigned _pop(uint32_t *rec)
+{
+    unsigned len = 0;
+    unsigned state = irq_disable();
+
+    if (_head != _tail) {
+        len = (_buf[_tail & MASK] & 0xff) + 2;
+        for (unsigned i = 0; i < len; i++) {
+            rec[i] = _buf[(_tail + i) & MASK];
+        }
+        _tail += len;
+    }
+    irq_restore(state);
+    return len;
+}
+
+void log_binary_dump(void)
+{
+    uint32_t rec[LOG_BINARY_ARGS_MAX + 2];
+    unsigned len, dropped;
+    unsigned state = irq_disable();
+
+    dropped = _dropped;
+    _dropped = 0;
+    irq_restore(state);
+
+    if (dropped) {
+        printf("#D %u\n", dropped);
+    }
+    while ((len = _pop(rec)) != 0) {
+        printf("#L");
+        for (unsigned i = 0; i < len; i++) {
+            printf(" %08" PRIx32, rec[i]);
+        }
+        puts("");
+    }
+}
+
+void log_binary_clear(void)
+{
+    unsigned state = irq_disable();
+
+    _tail = _head;
+    irq_restore(state);
+}
+
+unsigned log_binary_dropped(void)
+{
+    return _dropped;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_binary Binary log module
+ * @ingroup     sys
+ * @brief       Logging with deferred formatting
+ *
+ * Instead of formatting the message, a LOG_* call stores a binary record of
+ * the format string's address and the raw arguments in a ring buffer. The
+ * format strings are placed in the `.log_fmt` section of the ELF file.
+ * log_binary_dump() prints the buffered records as hex lines that
+ * `dist/tools/log_binary/decode.py` turns back into text using the ELF file:
+ *
+ *     make term | ./dist/tools/log_binary/decode.py bin/<board>/<app>.elf
+ *
+ * A LOG_* call thus costs a few stores, so even LOG_DEBUG messages may be
+ * kept enabled.
+ *
+ * Arguments are recorded as 32-bit words. Integers, characters and pointers
+ * are supported; 64-bit integers and floating point values are not. A `%s`
+ * argument is decoded only if it points to a constant string in the ELF
+ * file. At most @ref LOG_BINARY_ARGS_MAX arguments are supported.
+ *
+ * If the buffer is full, new records are dropped and counted.
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the record buffer in 32-bit words, must be a power of 2
+ */
+#ifndef LOG_BINARY_BUFSIZE
+#define LOG_BINARY_BUFSIZE      (128U)
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a log message
+ */
+#define LOG_BINARY_ARGS_MAX     (8U)
+
+/**
+ * @brief   Marker in the upper byte of the first word of every record
+ */
+#define LOG_BINARY_MAGIC        (0xa5000000UL)
+
+/**
+ * @brief   Builds the first word of a record
+ */
+#define LOG_BINARY_HDR(level, nargs) \
+    (LOG_BINARY_MAGIC | ((uint32_t)(level) << 8) | (nargs))
+
+/**
+ * @brief   Logs a message without formatting it
+ *
+ * @param[in] level     log level
+ * @param[in] format    format string, must be a string literal
+ */
+#define log_write(level, format, ...) \
+    do { \
+        static const char _log_fmt[] \
+            __attribute__((section(".log_fmt"))) = format; \
+        const uint32_t _log_rec[] = { \
+            LOG_BINARY_HDR(level, _LB_NARGS(__VA_ARGS__)), \
+            (uint32_t)(uintptr_t)_log_fmt _LB_MAP(__VA_ARGS__) \
+        }; \
+        log_binary_write(_log_rec, sizeof(_log_rec) / sizeof(uint32_t)); \
+    } while (0)
+
+/**
+ * @brief   Stores a record in the buffer
+ *
+ * @param[in] rec       the record
+ * @param[in] len       length of @p rec in words
+ */
+void log_binary_write(const uint32_t *rec, unsigned len);
+
+/**
+ * @brief   Prints and removes all buffered records
+ *
+ * Every record is printed as one line starting with `#L` followed by its
+ * words in hex. If records were dropped since the last dump, a line starting
+ * with `#D` followed by their number is printed first.
+ */
+void log_binary_dump(void);
+
+/**
+ * @brief   Removes all buffered records without printing them
+ */
+void log_binary_clear(void);
+
+/**
+ * @brief   Gets the number of records dropped since the last dump
+ *
+ * @return  the number of dropped records
+ */
+unsigned log_binary_dropped(void);
+
+/**
+ * @cond INTERNAL
+ * Counts the arguments and converts each of them to a word.
+ */
+#define _LB_NARGS(...) _LB_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _LB_NARGS_(_, a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+#define _LB_CAT(a, b) _LB_CAT_(a, b)
+#define _LB_CAT_(a, b) a ## b
+#define _LB_MAP(...) _LB_CAT(_LB_MAP_, _LB_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define _LB_W(x) , (uint32_t)(uintptr_t)(x)
+#define _LB_MAP_0()
+#define _LB_MAP_1(a) _LB_W(a)
+#define _LB_MAP_2(a, ...) _LB_W(a) _LB_MAP_1(__VA_ARGS__)
+#define _LB_MAP_3(a, ...) _LB_W(a) _LB_MAP_2(__VA_ARGS__)
+#define _LB_MAP_4(a, ...) _LB_W(a) _LB_MAP_3(__VA_ARGS__)
+#define _LB_MAP_5(a, ...) _LB_W(a) _LB_MAP_4(__VA_ARGS__)
+#define _LB_MAP_6(a, ...) _LB_W(a) _LB_MAP_5(__VA_ARGS__)
+#define _LB_MAP_7(a, ...) _LB_W(a) _LB_MAP_6(__VA_ARGS__)
+#define _LB_MAP_8(a, ...) _LB_W(a) _LB_MAP_7(__VA_ARGS__)
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_MODULE_H */
+/** @} */
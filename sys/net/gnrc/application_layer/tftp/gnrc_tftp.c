@@ -16,10 +16,12 @@
  */
 
 #include <errno.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
 
+#include "coro.h"
 #include "net/gnrc/tftp.h"
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/netreg.h"
@@ -37,6 +39,9 @@
 
 static kernel_pid_t _tftp_kernel_pid;
 
+/* file name of the transfer a callback is called for */
+static const char *_tftp_cb_file_name;
+
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 #define CT_HTONS(x)                 ((uint16_t)((          \
                                                     (((uint16_t)(x)) >> 8) & 0x00FF) |  \
@@ -48,7 +53,6 @@ static kernel_pid_t _tftp_kernel_pid;
 #define MIN(a, b)                    ((a) > (b) ? (b) : (a))
 #define ARRAY_LEN(x)                (sizeof(x) / sizeof(x[0]))
 
-#define TFTP_TIMEOUT_MSG            0x4000
 #define TFTP_STOP_SERVER_MSG        0x4001
 #define TFTP_DEFAULT_DATA_SIZE      (GNRC_TFTP_MAX_TRANSFER_UNIT    \
                                      + sizeof(tftp_packet_data_t))
@@ -145,8 +149,6 @@ typedef struct {
     tftp_mode_t mode;
     tftp_opcodes_t op;
     ipv6_addr_t peer;
-    xtimer_t timer;
-    msg_t timer_msg;
     uint32_t timeout;
     uint16_t dst_port;
     uint16_t src_port;
@@ -165,6 +167,10 @@ typedef struct {
     bool use_options;
     bool enable_options;
     bool write_finished;
+
+    /* not reset by _tftp_init_ctxt(), must stay last */
+    tftp_state state;
+    coro_t coro;
 } tftp_context_t;
 
 /**
@@ -214,6 +220,9 @@ static int _tftp_set_opts(tftp_context_t *ctxt, size_t blksize, uint32_t timeout
 /* this function registers the UDP port and won't return till the TFTP transfer is finished */
 static int _tftp_do_client_transfer(tftp_context_t *ctxt);
 
+/* the coroutine of a single TFTP transfer */
+static int _tftp_transfer(coro_t *coro);
+
 /* the state process of the TFTP transfer */
 static tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m);
 
@@ -245,7 +254,7 @@ static int _tftp_process_data(tftp_context_t *ctxt, gnrc_pktsnip_t *buf);
 static int _tftp_decode_error(uint8_t *buf, tftp_err_codes_t *err, const char * *err_msg);
 
 /* TFTP super loop server */
-static int _tftp_server(tftp_context_t *ctxt);
+static int _tftp_server(tftp_context_t *ctxts, unsigned num);
 
 /* get the maximum allowed transfer unit to avoid 6Lo fragmentation */
 static uint16_t _tftp_get_maximum_block_size(void)
@@ -288,12 +297,7 @@ int gnrc_tftp_client_read(ipv6_addr_t *addr, const char *file_name, tftp_mode_t
     }
 
     /* start the process */
-    int ret = _tftp_do_client_transfer(&ctxt);
-
-    /* remove possibly stale timer */
-    xtimer_remove(&(ctxt.timer));
-
-    return ret;
+    return _tftp_do_client_transfer(&ctxt);
 }
 
 int gnrc_tftp_client_write(ipv6_addr_t *addr, const char *file_name, tftp_mode_t mode,
@@ -322,12 +326,7 @@ int gnrc_tftp_client_write(ipv6_addr_t *addr, const char *file_name, tftp_mode_t
     }
 
     /* start the process */
-    int ret = _tftp_do_client_transfer(&ctxt);
-
-    /* remove possibly stale timer */
-    xtimer_remove(&(ctxt.timer));
-
-    return ret;
+    return _tftp_do_client_transfer(&ctxt);
 }
 
 int _tftp_init_ctxt(ipv6_addr_t *addr, const char *file_name,
@@ -340,7 +339,9 @@ int _tftp_init_ctxt(ipv6_addr_t *addr, const char *file_name,
         return TS_FAILED;
     }
 
-    memset(ctxt, 0, sizeof(*ctxt));
+    /* keep the coroutine, a server transfer reinitializes its context from
+     * within the coroutine */
+    memset(ctxt, 0, offsetof(tftp_context_t, state));
 
     /* set the default context parameters */
     ctxt->op = op;
@@ -402,12 +403,15 @@ int gnrc_tftp_server(tftp_data_cb_t data_cb, tftp_start_cb_t start_cb, tftp_stop
         return -1;
     }
 
-    /* context will be initialized when a connection is established */
-    tftp_context_t ctxt;
-    ctxt.data_cb = data_cb;
-    ctxt.start_cb = start_cb;
-    ctxt.stop_cb = stop_cb;
-    ctxt.enable_options = use_options;
+    /* contexts will be initialized when a connection is established */
+    tftp_context_t ctxts[GNRC_TFTP_SERVER_TRANSFERS];
+    for (unsigned i = 0; i < GNRC_TFTP_SERVER_TRANSFERS; i++) {
+        ctxts[i].data_cb = data_cb;
+        ctxts[i].start_cb = start_cb;
+        ctxts[i].stop_cb = stop_cb;
+        ctxts[i].enable_options = use_options;
+        ctxts[i].state = TS_FINISHED;
+    }
 
     /* validate our arguments */
     assert(data_cb);
@@ -418,10 +422,7 @@ int gnrc_tftp_server(tftp_data_cb_t data_cb, tftp_start_cb_t start_cb, tftp_stop
     _tftp_kernel_pid = thread_getpid();
 
     /* start the server */
-    int ret = _tftp_server(&ctxt);
-
-    /* remove possibly stale timer */
-    xtimer_remove(&(ctxt.timer));
+    int ret = _tftp_server(ctxts, GNRC_TFTP_SERVER_TRANSFERS);
 
     /* reset the kernel PID */
     _tftp_kernel_pid = KERNEL_PID_UNDEF;
@@ -429,6 +430,11 @@ int gnrc_tftp_server(tftp_data_cb_t data_cb, tftp_start_cb_t start_cb, tftp_stop
     return ret;
 }
 
+const char *gnrc_tftp_transfer_file_name(void)
+{
+    return _tftp_cb_file_name;
+}
+
 int gnrc_tftp_server_stop(void)
 {
     /* check if there is a server running */
@@ -450,62 +456,132 @@ int gnrc_tftp_server_stop(void)
     return 0;
 }
 
-int _tftp_server(tftp_context_t *ctxt)
+/* checks if a message belongs to the transfer of a context */
+static bool _tftp_msg_for_ctxt(tftp_context_t *ctxt, msg_t *m)
 {
-    msg_t msg;
-    bool active = true;
-    gnrc_netreg_entry_t entry = { NULL, GNRC_TFTP_DEFAULT_DST_PORT,
-                                  thread_getpid() };
+    if (m->type != GNRC_NETAPI_MSG_TYPE_RCV) {
+        return false;
+    }
 
-    while (active) {
-        int ret = TS_BUSY;
-        bool got_client = false;
+    gnrc_pktsnip_t *tmp = gnrc_pktsnip_search_type(m->content.ptr,
+                                                   GNRC_NETTYPE_UDP);
+    udp_hdr_t *udp = (udp_hdr_t *)tmp->data;
 
-        /* register the servers main listening port */
-        if (gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry)) {
-            DEBUG("tftp: error starting server.");
-            return TS_FAILED;
+    return (byteorder_ntohs(udp->dst_port) == ctxt->src_port);
+}
+
+/* checks if the server already serves the transfer a request belongs to,
+ * i.e. if the request is a retransmission */
+static bool _tftp_server_has_transfer(tftp_context_t *ctxts, unsigned num,
+                                      gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *tmp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    udp_hdr_t *udp = (udp_hdr_t *)tmp->data;
+
+    tmp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *ip = (ipv6_hdr_t *)tmp->data;
+
+    for (unsigned i = 0; i < num; i++) {
+        if ((ctxts[i].state == TS_BUSY) &&
+            (ctxts[i].dst_port == byteorder_ntohs(udp->src_port)) &&
+            ipv6_addr_equal(&(ctxts[i].peer), &(ip->src))) {
+            return true;
         }
+    }
+    return false;
+}
 
-        /* main processing loop */
-        while (ret == TS_BUSY) {
-            /* wait for a message */
-            msg_receive(&msg);
+int _tftp_transfer(coro_t *coro)
+{
+    tftp_context_t *ctxt = coro->arg;
 
-            /* check if the server stop message has been received */
-            if (msg.type == TFTP_STOP_SERVER_MSG) {
-                active = false;
-                ret = TS_FAILED;
-                break;
-            }
-            else {
-                /* continue normal server opration */
-                DEBUG("tftp: message incoming\n");
-                ret = _tftp_state_processes(ctxt, &msg);
+    CORO_BEGIN(coro);
 
-                /* release packet if we received one */
-                if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
-                    gnrc_pktbuf_release(msg.content.ptr);
-                }
-            }
+    /* try to start the TFTP transfer */
+    if (ctxt->ct == CT_CLIENT) {
+        _tftp_cb_file_name = ctxt->file_name;
+        ctxt->state = _tftp_state_processes(ctxt, NULL);
+    }
 
-            /* if we just accepted a client, disable the server main listening port */
-            if (!got_client) {
-                gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &entry);
+    /* main processing loop */
+    while (ctxt->state == TS_BUSY) {
+        /* wait for a message */
+        CORO_RECEIVE(coro, _tftp_msg_for_ctxt(ctxt, coro->msg));
+        DEBUG("tftp: message received\n");
+        _tftp_cb_file_name = ctxt->file_name;
+        ctxt->state = _tftp_state_processes(ctxt, coro->msg);
 
-                if (ret == TS_BUSY) {
-                    got_client = true;
+        /* release packet if we received one */
+        if (coro->msg->type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(coro->msg->content.ptr);
+        }
+    }
+
+    /* unregister the UDP listener of the transfer */
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &(ctxt->entry));
+    DEBUG("tftp: connection terminated\n");
+
+    CORO_END(coro);
+}
+
+int _tftp_server(tftp_context_t *ctxts, unsigned num)
+{
+    msg_t msg;
+    coro_sched_t sched = CORO_SCHED_INIT;
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(GNRC_TFTP_DEFAULT_DST_PORT,
+                                                           thread_getpid());
+
+    /* register the servers main listening port */
+    if (gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry)) {
+        DEBUG("tftp: error starting server.");
+        return TS_FAILED;
+    }
+
+    while (1) {
+        /* wait for a message */
+        msg_receive(&msg);
+
+        /* check if the server stop message has been received */
+        if (msg.type == TFTP_STOP_SERVER_MSG) {
+            break;
+        }
+
+        /* offer the message to the running transfers */
+        if (coro_sched_dispatch(&sched, &msg) ||
+            (msg.type != GNRC_NETAPI_MSG_TYPE_RCV)) {
+            continue;
+        }
+
+        /* start a new transfer for a request on the listening port */
+        if (!_tftp_server_has_transfer(ctxts, num, msg.content.ptr)) {
+            for (unsigned i = 0; i < num; i++) {
+                if (ctxts[i].state != TS_BUSY) {
                     DEBUG("tftp: connection established\n");
+                    /* the transfer takes the request on the listening port,
+                     * then switches to its own port */
+                    ctxts[i].src_port = GNRC_TFTP_DEFAULT_DST_PORT;
+                    ctxts[i].ct = CT_SERVER;
+                    ctxts[i].state = TS_BUSY;
+                    coro_init(&(ctxts[i].coro), _tftp_transfer, &ctxts[i]);
+                    coro_start(&sched, &(ctxts[i].coro));
+                    break;
                 }
             }
+            if (coro_sched_dispatch(&sched, &msg)) {
+                continue;
+            }
         }
 
-        /* remove any stall timers */
-        xtimer_remove(&(ctxt->timer));
+        DEBUG("tftp: dropping request\n");
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
 
-        /* if the server transfer has finished, unregister the client dst port */
-        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &(ctxt->entry));
-        DEBUG("tftp: connection terminated\n");
+    /* abort all running transfers */
+    for (unsigned i = 0; i < num; i++) {
+        if (ctxts[i].state == TS_BUSY) {
+            coro_cancel(&sched, &(ctxts[i].coro));
+            gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &(ctxts[i].entry));
+        }
     }
 
     /* unregister our UDP listener on this thread */
@@ -517,41 +593,35 @@ int _tftp_server(tftp_context_t *ctxt)
 int _tftp_do_client_transfer(tftp_context_t *ctxt)
 {
     msg_t msg;
-    tftp_state ret = TS_BUSY;
+    coro_sched_t sched = CORO_SCHED_INIT;
 
     /* register our DNS response listener */
-    gnrc_netreg_entry_t entry = { NULL, ctxt->src_port, thread_getpid() };
+    gnrc_netreg_entry_init_pid(&(ctxt->entry), ctxt->src_port,
+                               thread_getpid());
 
-    if (gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry)) {
+    if (gnrc_netreg_register(GNRC_NETTYPE_UDP, &(ctxt->entry))) {
         DEBUG("tftp: error starting server.");
         return TS_FAILED;
     }
 
-    /* try to start the TFTP transfer */
-    ret = _tftp_state_processes(ctxt, NULL);
-    if (ret != TS_BUSY) {
-        DEBUG("tftp: transfer failed\n");
-        /* if the start failed return */
-        return ret;
-    }
+    ctxt->state = TS_BUSY;
+    coro_init(&(ctxt->coro), _tftp_transfer, ctxt);
+    coro_start(&sched, &(ctxt->coro));
 
-    /* main processing loop */
-    while (ret == TS_BUSY) {
-        /* wait for a message */
+    /* run the transfer until it has finished */
+    while (!coro_sched_idle(&sched)) {
         msg_receive(&msg);
-        DEBUG("tftp: message received\n");
-        ret = _tftp_state_processes(ctxt, &msg);
-
-        /* release packet if we received one */
-        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+        if (!coro_sched_dispatch(&sched, &msg) &&
+            (msg.type == GNRC_NETAPI_MSG_TYPE_RCV)) {
             gnrc_pktbuf_release(msg.content.ptr);
         }
     }
 
-    /* unregister our UDP listener on this thread */
-    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &entry);
+    if (ctxt->state != TS_FINISHED) {
+        DEBUG("tftp: transfer failed\n");
+    }
 
-    return ret;
+    return ctxt->state;
 }
 
 tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
@@ -564,7 +634,7 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
         DEBUG("tftp: starting transaction as client\n");
         return _tftp_send_start(ctxt, outbuf);
     }
-    else if (m->type == TFTP_TIMEOUT_MSG) {
+    else if (m->type == CORO_MSG_TYPE_TIMEOUT) {
         DEBUG("tftp: timeout occured\n");
         if (++(ctxt->retries) > GNRC_TFTP_MAX_RETRIES) {
             /* transfer failed due to lost peer */
@@ -605,7 +675,7 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
     ipv6_hdr_t *ip = (ipv6_hdr_t *)tmp->data;
     uint8_t *data = (uint8_t *)pkt->data;
 
-    xtimer_remove(&(ctxt->timer));
+    coro_remove_timeout(&(ctxt->coro));
 
     switch (_tftp_parse_type(data)) {
         case TO_RRQ:
@@ -636,9 +706,8 @@ tftp_state _tftp_state_processes(tftp_context_t *ctxt, msg_t *m)
             }
 
             /* register a listener for the UDP port */
-            ctxt->entry.next = NULL;
-            ctxt->entry.demux_ctx = ctxt->src_port;
-            ctxt->entry.pid = thread_getpid();
+            gnrc_netreg_entry_init_pid(&(ctxt->entry), ctxt->src_port,
+                                       thread_getpid());
             gnrc_netreg_register(GNRC_NETTYPE_UDP, &(ctxt->entry));
 
             /* try to decode the options */
@@ -999,8 +1068,7 @@ tftp_state _tftp_send(gnrc_pktsnip_t *buf, tftp_context_t *ctxt, size_t len)
 
     /* only set timeout if enabled for this block */
     if (ctxt->block_timeout) {
-        ctxt->timer_msg.type = TFTP_TIMEOUT_MSG;
-        xtimer_set_msg(&(ctxt->timer), ctxt->block_timeout, &(ctxt->timer_msg), thread_getpid());
+        coro_set_timeout(&(ctxt->coro), ctxt->block_timeout);
         DEBUG("tftp: set timeout %" PRIu32 " ms\n", ctxt->block_timeout / MS_IN_USEC);
     }
 
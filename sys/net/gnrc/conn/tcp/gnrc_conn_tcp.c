@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       GNRC implementation of the tcp interface defined by net/conn/tcp.h
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/conn.h"
+#include "net/gnrc/tcp.h"
+
+#include "net/conn/tcp.h"
+
+int conn_tcp_create(conn_tcp_t *conn, const void *addr, size_t addr_len, int family,
+                    uint16_t port)
+{
+    ipv6_addr_t local;
+
+    conn->tcb = NULL;
+    switch (family) {
+        case AF_INET6:
+            if (addr_len != sizeof(ipv6_addr_t)) {
+                return -EINVAL;
+            }
+            if (!gnrc_conn6_set_local_addr(local.u8, addr)) {
+                return -EADDRNOTAVAIL;
+            }
+            return gnrc_tcp_open(&conn->tcb, &local, port);
+        default:
+            (void)addr;
+            (void)addr_len;
+            (void)port;
+            return -EAFNOSUPPORT;
+    }
+}
+
+void conn_tcp_close(conn_tcp_t *conn)
+{
+    if (conn->tcb != NULL) {
+        gnrc_tcp_close(conn->tcb);
+        conn->tcb = NULL;
+    }
+}
+
+int conn_tcp_getlocaladdr(conn_tcp_t *conn, void *addr, uint16_t *port)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    memcpy(addr, &conn->tcb->local_addr, sizeof(ipv6_addr_t));
+    *port = conn->tcb->local_port;
+    return sizeof(ipv6_addr_t);
+}
+
+int conn_tcp_getpeeraddr(conn_tcp_t *conn, void *addr, uint16_t *port)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    if (conn->tcb->peer_port == 0) {
+        return -ENOTCONN;
+    }
+    memcpy(addr, &conn->tcb->peer_addr, sizeof(ipv6_addr_t));
+    *port = conn->tcb->peer_port;
+    return sizeof(ipv6_addr_t);
+}
+
+int conn_tcp_connect(conn_tcp_t *conn, const void *addr, size_t addr_len, uint16_t port)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    if (addr_len != sizeof(ipv6_addr_t)) {
+        return -EINVAL;
+    }
+    return gnrc_tcp_connect(conn->tcb, addr, port);
+}
+
+int conn_tcp_listen(conn_tcp_t *conn, int queue_len)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    return gnrc_tcp_listen(conn->tcb, (queue_len > 0) ? (unsigned)queue_len : 0);
+}
+
+int conn_tcp_accept(conn_tcp_t *conn, conn_tcp_t *out_conn)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    return gnrc_tcp_accept(conn->tcb, &out_conn->tcb);
+}
+
+int conn_tcp_recv(conn_tcp_t *conn, void *data, size_t max_len)
+{
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    return gnrc_tcp_recv(conn->tcb, data, max_len);
+}
+
+int conn_tcp_send(conn_tcp_t *conn, const void *data, size_t len)
+{
+    size_t sent = 0;
+
+    if (conn->tcb == NULL) {
+        return -EBADF;
+    }
+    /* gnrc_tcp_send() returns as soon as some data is queued */
+    while (sent < len) {
+        int res = gnrc_tcp_send(conn->tcb, (const uint8_t *)data + sent, len - sent);
+
+        if (res < 0) {
+            return (sent > 0) ? (int)sent : res;
+        }
+        sent += res;
+    }
+    return (int)sent;
+}
+
+/** @} */
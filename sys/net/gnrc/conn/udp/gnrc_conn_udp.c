@@ -95,7 +95,9 @@ int conn_udp_sendto(const void *data, size_t len, const void *src, size_t src_le
 {
     gnrc_pktsnip_t *pkt, *hdr = NULL;
 
-    pkt = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF); /* data will only be copied */
+    /* data will only be copied; headroom takes the headers of the lower layers */
+    pkt = gnrc_pktbuf_add_headroom(NULL, (void *)data, len, GNRC_PKTBUF_HEADROOM,
+                                   GNRC_NETTYPE_UNDEF);
     hdr = gnrc_udp_hdr_build(pkt, sport, dport);
     if (hdr == NULL) {
         gnrc_pktbuf_release(pkt);
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_event
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event.h"
+#include "irq.h"
+#include "thread.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/event_thread.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+kernel_pid_t gnrc_event_pid = KERNEL_PID_UNDEF;
+event_queue_t gnrc_event_queue = EVENT_QUEUE_INIT;
+
+#if ENABLE_DEBUG
+static char _stack[GNRC_EVENT_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
+#else
+static char _stack[GNRC_EVENT_STACK_SIZE];
+#endif
+
+static void *_event_loop(void *args)
+{
+    (void)args;
+    event_queue_claim(&gnrc_event_queue);
+    event_loop(&gnrc_event_queue);
+    /* never reached */
+    return NULL;
+}
+
+kernel_pid_t gnrc_event_init(void)
+{
+    if (gnrc_event_pid == KERNEL_PID_UNDEF) {
+        gnrc_event_pid = thread_create(_stack, sizeof(_stack), GNRC_EVENT_PRIO,
+                                       THREAD_CREATE_STACKTEST, _event_loop,
+                                       NULL, "gnrc_event");
+    }
+    return gnrc_event_pid;
+}
+
+/* drains all pending messages of a layer */
+static void _netapi_handler(event_t *event)
+{
+    gnrc_event_netapi_t *ev = (gnrc_event_netapi_t *)event;
+    msg_t msg;
+    int idx;
+
+    while (1) {
+        unsigned state = irq_disable();
+        idx = cib_get(&ev->cib);
+        if (idx >= 0) {
+            /* the slot may be reused by gnrc_event_netapi_post() as soon as
+             * interrupts are enabled again */
+            msg = ev->queue[idx];
+        }
+        irq_restore(state);
+        if (idx < 0) {
+            break;
+        }
+        DEBUG("gnrc_event: handling message of type 0x%04x\n", msg.type);
+        ev->handler(msg.type, msg.content.ptr);
+    }
+}
+
+/* netreg callback: the dispatching thread enqueues the packet */
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    if (!gnrc_event_netapi_post(ctx, cmd, pkt)) {
+        DEBUG("gnrc_event: queue full, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+void gnrc_event_netapi_init(gnrc_event_netapi_t *ev,
+                            gnrc_netreg_entry_t *entry, gnrc_nettype_t type,
+                            gnrc_event_netapi_handler_t handler,
+                            msg_t *queue, unsigned queue_size)
+{
+    /* cib requires a power of two */
+    assert((queue_size != 0) && ((queue_size & (queue_size - 1)) == 0));
+    ev->super.list_node.next = NULL;
+    ev->super.handler = _netapi_handler;
+    ev->cbd.cb = _netapi_cb;
+    ev->cbd.ctx = ev;
+    ev->handler = handler;
+    cib_init(&ev->cib, queue_size);
+    ev->queue = queue;
+    gnrc_netreg_entry_init_cb(entry, GNRC_NETREG_DEMUX_CTX_ALL, &ev->cbd);
+    gnrc_netreg_register(type, entry);
+}
+
+int gnrc_event_netapi_post(gnrc_event_netapi_t *ev, uint16_t type, void *ptr)
+{
+    unsigned state = irq_disable();
+    int idx = cib_put(&ev->cib);
+
+    if (idx < 0) {
+        irq_restore(state);
+        return 0;
+    }
+    ev->queue[idx].type = type;
+    ev->queue[idx].content.ptr = ptr;
+    irq_restore(state);
+    event_post(&gnrc_event_queue, &ev->super);
+    return 1;
+}
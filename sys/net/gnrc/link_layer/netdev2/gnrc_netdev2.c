@@ -20,6 +20,7 @@
 
 #include <errno.h>
 
+#include "irq.h"
 #include "msg.h"
 #include "thread.h"
 
@@ -29,6 +30,13 @@
 
 #include "net/gnrc/netdev2.h"
 #include "net/ethernet/hdr.h"
+#ifdef MODULE_GNRC_NETIF_ATTR
+#include "net/gnrc/netif/attr.h"
+#endif
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -41,6 +49,304 @@
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt);
 
+#ifdef MODULE_GNRC_NETIF_ATTR
+static int _attr_get(void *ctx, netopt_t opt, void *value, size_t max_len)
+{
+    netdev2_t *dev = ctx;
+
+    return dev->driver->get(dev, opt, value, max_len);
+}
+
+/* updates the cached options after they might have changed */
+static inline void _attr_publish(gnrc_netdev2_t *gnrc_netdev2)
+{
+    gnrc_netif_attr_publish(gnrc_netdev2->pid, _attr_get, gnrc_netdev2->dev);
+}
+#else
+static inline void _attr_publish(gnrc_netdev2_t *gnrc_netdev2)
+{
+    (void)gnrc_netdev2;
+}
+#endif
+
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+/* classifies by the DSCP of the IPv6 header and the ICMPv6 message type */
+static gnrc_netdev2_txq_class_t _txq_classify(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netdev2_txq_class_t cls = GNRC_NETDEV2_TXQ_BULK;
+
+    for (; pkt != NULL; pkt = pkt->next) {
+#ifdef MODULE_GNRC_IPV6
+        if ((pkt->type == GNRC_NETTYPE_IPV6) &&
+            (pkt->size >= sizeof(ipv6_hdr_t))) {
+            uint8_t dscp = ipv6_hdr_get_tc_dscp(pkt->data);
+
+            if (dscp >= 48) {       /* CS6, CS7 */
+                return GNRC_NETDEV2_TXQ_CTRL;
+            }
+            if (dscp >= 32) {       /* CS4 and above */
+                cls = GNRC_NETDEV2_TXQ_PRIO;
+            }
+        }
+#endif
+#ifdef MODULE_GNRC_ICMPV6
+        if ((pkt->type == GNRC_NETTYPE_ICMPV6) &&
+            (pkt->size >= sizeof(icmpv6_hdr_t))) {
+            uint8_t type = ((icmpv6_hdr_t *)pkt->data)->type;
+
+            if (((type >= ICMPV6_RTR_SOL) && (type <= ICMPV6_REDIRECT)) ||
+                (type == ICMPV6_RPL_CTRL)) {
+                return GNRC_NETDEV2_TXQ_CTRL;
+            }
+        }
+#endif
+    }
+    return cls;
+}
+
+void gnrc_netdev2_txq_mark(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->data;
+
+    switch (_txq_classify(pkt)) {
+        case GNRC_NETDEV2_TXQ_CTRL:
+            hdr->flags |= GNRC_NETIF_HDR_FLAGS_TXQ_CTRL;
+            break;
+        case GNRC_NETDEV2_TXQ_PRIO:
+            hdr->flags |= GNRC_NETIF_HDR_FLAGS_TXQ_PRIO;
+            break;
+        default:
+            break;
+    }
+}
+
+/* the class kept in the netif header wins over the packet's content */
+static gnrc_netdev2_txq_class_t _txq_class(gnrc_pktsnip_t *pkt)
+{
+    if (pkt->type == GNRC_NETTYPE_NETIF) {
+        gnrc_netif_hdr_t *hdr = pkt->data;
+
+        if (hdr->flags & GNRC_NETIF_HDR_FLAGS_TXQ_CTRL) {
+            return GNRC_NETDEV2_TXQ_CTRL;
+        }
+        if (hdr->flags & GNRC_NETIF_HDR_FLAGS_TXQ_PRIO) {
+            return GNRC_NETDEV2_TXQ_PRIO;
+        }
+    }
+    return _txq_classify(pkt);
+}
+
+static void _txq_init(gnrc_netdev2_t *gnrc_netdev2)
+{
+    for (unsigned i = 0; i < GNRC_NETDEV2_TXQ_NUMOF; i++) {
+        cib_init(&gnrc_netdev2->txq_cib[i], GNRC_NETDEV2_TXQ_LEN);
+        gnrc_netdev2->txq_bytes[i] = 0;
+    }
+}
+
+static inline int _txq_empty(gnrc_netdev2_t *gnrc_netdev2)
+{
+    for (unsigned i = 0; i < GNRC_NETDEV2_TXQ_NUMOF; i++) {
+        if (cib_avail(&gnrc_netdev2->txq_cib[i])) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* returns the number of queued bytes of class cls and all classes below */
+static size_t _txq_bytes(gnrc_netdev2_t *gnrc_netdev2, unsigned cls)
+{
+    size_t bytes = 0;
+
+    for (; cls < GNRC_NETDEV2_TXQ_NUMOF; cls++) {
+        bytes += gnrc_netdev2->txq_bytes[cls];
+    }
+    return bytes;
+}
+
+/* removes the oldest packet of class cls, returns NULL if there is none */
+static gnrc_pktsnip_t *_txq_get(gnrc_netdev2_t *gnrc_netdev2, unsigned cls)
+{
+    int idx = cib_get(&gnrc_netdev2->txq_cib[cls]);
+
+    if (idx < 0) {
+        return NULL;
+    }
+    gnrc_pktsnip_t *pkt = gnrc_netdev2->txq[cls][idx];
+    gnrc_netdev2->txq_bytes[cls] -= gnrc_pkt_len(pkt);
+    return pkt;
+}
+
+static void _txq_drop(gnrc_netdev2_t *gnrc_netdev2, gnrc_pktsnip_t *pkt,
+                      unsigned cls)
+{
+    DEBUG("gnrc_netdev2: TX queue full, dropping packet of class %u\n", cls);
+#ifdef MODULE_NETSTATS_L2
+    gnrc_netdev2->dev->stats.tx_class_dropped[cls]++;
+#else
+    (void)gnrc_netdev2;
+    (void)cls;
+#endif
+    gnrc_pktbuf_release_error(pkt, ENOBUFS);
+}
+
+static void _txq_put(gnrc_netdev2_t *gnrc_netdev2, gnrc_pktsnip_t *pkt)
+{
+    unsigned cls = _txq_class(pkt);
+    size_t len = gnrc_pkt_len(pkt);
+
+    /* dropping packets of lower classes only helps if the packet then fits,
+     * a full class of its own can not be helped */
+    if (cib_full(&gnrc_netdev2->txq_cib[cls]) ||
+        ((_txq_bytes(gnrc_netdev2, 0) - _txq_bytes(gnrc_netdev2, cls + 1) + len) >
+         GNRC_NETDEV2_TXQ_BYTES)) {
+        _txq_drop(gnrc_netdev2, pkt, cls);
+        return;
+    }
+
+    /* make room by dropping the oldest packets of the lowest classes */
+    unsigned lower = GNRC_NETDEV2_TXQ_NUMOF - 1;
+    while (_txq_bytes(gnrc_netdev2, 0) + len > GNRC_NETDEV2_TXQ_BYTES) {
+        gnrc_pktsnip_t *victim = _txq_get(gnrc_netdev2, lower);
+
+        if (victim != NULL) {
+            _txq_drop(gnrc_netdev2, victim, lower);
+        }
+        else {
+            lower--;
+        }
+    }
+
+    gnrc_netdev2->txq[cls][cib_put(&gnrc_netdev2->txq_cib[cls])] = pkt;
+    gnrc_netdev2->txq_bytes[cls] += len;
+}
+
+/* sends the oldest packet of the highest non-empty class */
+static int _txq_send_next(gnrc_netdev2_t *gnrc_netdev2)
+{
+    for (unsigned cls = 0; cls < GNRC_NETDEV2_TXQ_NUMOF; cls++) {
+        gnrc_pktsnip_t *pkt = _txq_get(gnrc_netdev2, cls);
+
+        if (pkt != NULL) {
+#ifdef MODULE_NETSTATS_L2
+            gnrc_netdev2->dev->stats.tx_class_count[cls]++;
+#endif
+            gnrc_netdev2->send(gnrc_netdev2, pkt);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#ifdef TEST_SUITES
+void gnrc_netdev2_txq_test_init(gnrc_netdev2_t *gnrc_netdev2)
+{
+    _txq_init(gnrc_netdev2);
+}
+
+void gnrc_netdev2_txq_test_put(gnrc_netdev2_t *gnrc_netdev2, gnrc_pktsnip_t *pkt)
+{
+    _txq_put(gnrc_netdev2, pkt);
+}
+
+int gnrc_netdev2_txq_test_send_next(gnrc_netdev2_t *gnrc_netdev2)
+{
+    return _txq_send_next(gnrc_netdev2);
+}
+#endif
+#else
+static inline void _txq_init(gnrc_netdev2_t *gnrc_netdev2)
+{
+    (void)gnrc_netdev2;
+}
+
+static inline int _txq_empty(gnrc_netdev2_t *gnrc_netdev2)
+{
+    (void)gnrc_netdev2;
+    return 1;
+}
+
+static inline int _txq_send_next(gnrc_netdev2_t *gnrc_netdev2)
+{
+    (void)gnrc_netdev2;
+    return 0;
+}
+#endif
+
+#ifdef MODULE_GNRC_NETDEV2_COALESCE
+static inline void _irq_wake(gnrc_netdev2_t *gnrc_netdev2)
+{
+    thread_flags_set((thread_t *)thread_get(gnrc_netdev2->pid),
+                     GNRC_NETDEV2_FLAG_IRQ);
+}
+
+#if GNRC_NETDEV2_COALESCE_US
+static void _coalesce_cb(void *arg)
+{
+    _irq_wake(arg);
+}
+#endif
+
+/**
+ * @brief   Records a device interrupt and wakes the thread if needed
+ *
+ * Called in interrupt context.
+ */
+static void _irq_post(gnrc_netdev2_t *gnrc_netdev2)
+{
+    unsigned pending = gnrc_netdev2->irq_pending;
+
+    if (pending == UINT16_MAX) {
+#ifdef MODULE_NETSTATS_L2
+        gnrc_netdev2->dev->stats.isr_lost++;
+#endif
+        return;
+    }
+    gnrc_netdev2->irq_pending = ++pending;
+
+#if GNRC_NETDEV2_COALESCE_US
+    if (pending == 1) {
+        gnrc_netdev2->coalesce_timer.callback = _coalesce_cb;
+        gnrc_netdev2->coalesce_timer.arg = gnrc_netdev2;
+        xtimer_set(&gnrc_netdev2->coalesce_timer, GNRC_NETDEV2_COALESCE_US);
+    }
+    else if (pending == GNRC_NETDEV2_RX_BUDGET) {
+        xtimer_remove(&gnrc_netdev2->coalesce_timer);
+        _irq_wake(gnrc_netdev2);
+    }
+#else
+    _irq_wake(gnrc_netdev2);
+#endif
+}
+
+/**
+ * @brief   Handles up to GNRC_NETDEV2_RX_BUDGET pending device interrupts
+ */
+static void _irq_poll(gnrc_netdev2_t *gnrc_netdev2)
+{
+    netdev2_t *dev = gnrc_netdev2->dev;
+
+    for (unsigned budget = GNRC_NETDEV2_RX_BUDGET; budget; budget--) {
+        unsigned state = irq_disable();
+        if (gnrc_netdev2->irq_pending == 0) {
+            irq_restore(state);
+            return;
+        }
+        gnrc_netdev2->irq_pending--;
+        irq_restore(state);
+
+        DEBUG("gnrc_netdev2: handling device interrupt\n");
+        dev->driver->isr(dev);
+    }
+
+    /* budget exhausted, serve pending messages before polling on */
+    if (gnrc_netdev2->irq_pending) {
+        thread_flags_set((thread_t *)sched_active_thread, GNRC_NETDEV2_FLAG_IRQ);
+    }
+}
+#endif
+
 /**
  * @brief   Function called by the device driver on device events
  *
@@ -51,14 +357,22 @@ static void _event_cb(netdev2_t *dev, netdev2_event_t event)
     gnrc_netdev2_t *gnrc_netdev2 = (gnrc_netdev2_t*) dev->context;
 
     if (event == NETDEV2_EVENT_ISR) {
+#ifdef MODULE_GNRC_NETDEV2_COALESCE
+        _irq_post(gnrc_netdev2);
+#else
         msg_t msg;
 
         msg.type = NETDEV2_MSG_TYPE_EVENT;
         msg.content.ptr = gnrc_netdev2;
 
         if (msg_send(&msg, gnrc_netdev2->pid) <= 0) {
+#ifdef MODULE_NETSTATS_L2
+            dev->stats.isr_lost++;
+#else
             puts("gnrc_netdev2: possibly lost interrupt.");
+#endif
         }
+#endif
     }
     else {
         DEBUG("gnrc_netdev2: event triggered -> %i\n", event);
@@ -97,6 +411,69 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+/**
+ * @brief   Handles a message to the gnrc_netdev2 thread
+ *
+ * @param[in] gnrc_netdev2  the gnrc_netdev2 of the thread
+ * @param[in] msg           the message
+ */
+static void _handle_msg(gnrc_netdev2_t *gnrc_netdev2, msg_t *msg)
+{
+    netdev2_t *dev = gnrc_netdev2->dev;
+    gnrc_netapi_opt_t *opt;
+    int res;
+    msg_t reply;
+
+    /* dispatch NETDEV and NETAPI messages */
+    switch (msg->type) {
+        case NETDEV2_MSG_TYPE_EVENT:
+            DEBUG("gnrc_netdev2: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
+            dev->driver->isr(dev);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            gnrc_pktsnip_t *pkt = msg->content.ptr;
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+            _txq_put(gnrc_netdev2, pkt);
+#else
+            gnrc_netdev2->send(gnrc_netdev2, pkt);
+#endif
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            /* read incoming options */
+            opt = msg->content.ptr;
+            DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
+                    netopt2str(opt->opt));
+            /* set option for device driver */
+            res = dev->driver->set(dev, opt->opt, opt->data, opt->data_len);
+            DEBUG("gnrc_netdev2: response of netdev->set: %i\n", res);
+            if (res >= 0) {
+                _attr_publish(gnrc_netdev2);
+            }
+            /* send reply to calling thread */
+            reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+            reply.content.value = (uint32_t)res;
+            msg_reply(msg, &reply);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_GET:
+            /* read incoming options */
+            opt = msg->content.ptr;
+            DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
+                    netopt2str(opt->opt));
+            /* get option from device driver */
+            res = dev->driver->get(dev, opt->opt, opt->data, opt->data_len);
+            DEBUG("gnrc_netdev2: response of netdev->get: %i\n", res);
+            /* send reply to calling thread */
+            reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+            reply.content.value = (uint32_t)res;
+            msg_reply(msg, &reply);
+            break;
+        default:
+            DEBUG("gnrc_netdev2: Unknown command %" PRIu16 "\n", msg->type);
+            break;
+    }
+}
+
 /**
  * @brief   Startup code and event loop of the gnrc_netdev2 layer
  *
@@ -113,12 +490,11 @@ static void *_gnrc_netdev2_thread(void *args)
 
     gnrc_netdev2->pid = thread_getpid();
 
-    gnrc_netapi_opt_t *opt;
-    int res;
-    msg_t msg, reply, msg_queue[NETDEV2_NETAPI_MSG_QUEUE_SIZE];
+    msg_t msg, msg_queue[NETDEV2_NETAPI_MSG_QUEUE_SIZE];
 
     /* setup the MAC layers message queue */
     msg_init_queue(msg_queue, NETDEV2_NETAPI_MSG_QUEUE_SIZE);
+    _txq_init(gnrc_netdev2);
 
     /* register the event callback with the device driver */
     dev->event_callback = _event_cb;
@@ -129,52 +505,42 @@ static void *_gnrc_netdev2_thread(void *args)
 
     /* initialize low-level driver */
     dev->driver->init(dev);
+    _attr_publish(gnrc_netdev2);
 
     /* start the event loop */
     while (1) {
-        DEBUG("gnrc_netdev2: waiting for incoming messages\n");
-        msg_receive(&msg);
-        /* dispatch NETDEV and NETAPI messages */
-        switch (msg.type) {
-            case NETDEV2_MSG_TYPE_EVENT:
-                DEBUG("gnrc_netdev2: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
-                dev->driver->isr(dev);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                gnrc_pktsnip_t *pkt = msg.content.ptr;
-                gnrc_netdev2->send(gnrc_netdev2, pkt);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                /* read incoming options */
-                opt = msg.content.ptr;
-                DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
-                        netopt2str(opt->opt));
-                /* set option for device driver */
-                res = dev->driver->set(dev, opt->opt, opt->data, opt->data_len);
-                DEBUG("gnrc_netdev2: response of netdev->set: %i\n", res);
-                /* send reply to calling thread */
-                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                /* read incoming options */
-                opt = msg.content.ptr;
-                DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
-                        netopt2str(opt->opt));
-                /* get option from device driver */
-                res = dev->driver->get(dev, opt->opt, opt->data, opt->data_len);
-                DEBUG("gnrc_netdev2: response of netdev->get: %i\n", res);
-                /* send reply to calling thread */
-                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                DEBUG("gnrc_netdev2: Unknown command %" PRIu16 "\n", msg.type);
-                break;
+#ifdef MODULE_GNRC_NETDEV2_COALESCE
+        thread_flags_t mask = GNRC_NETDEV2_FLAG_IRQ | THREAD_FLAG_MSG_WAITING;
+        thread_flags_t flags;
+
+        if (_txq_empty(gnrc_netdev2)) {
+            DEBUG("gnrc_netdev2: waiting for interrupts and messages\n");
+            flags = thread_flags_wait_any(mask);
+        }
+        else {
+            flags = thread_flags_clear(mask);
         }
+        if (flags & GNRC_NETDEV2_FLAG_IRQ) {
+            _irq_poll(gnrc_netdev2);
+        }
+        if (flags & THREAD_FLAG_MSG_WAITING) {
+            while (msg_try_receive(&msg) > 0) {
+                _handle_msg(gnrc_netdev2, &msg);
+            }
+        }
+        _txq_send_next(gnrc_netdev2);
+#else
+        if (_txq_empty(gnrc_netdev2)) {
+            DEBUG("gnrc_netdev2: waiting for incoming messages\n");
+            msg_receive(&msg);
+        }
+        else if (msg_try_receive(&msg) < 0) {
+            /* all pending messages are handled, send the most urgent packet */
+            _txq_send_next(gnrc_netdev2);
+            continue;
+        }
+        _handle_msg(gnrc_netdev2, &msg);
+#endif
     }
     /* never reached */
     return NULL;
@@ -18,10 +18,15 @@
  * @}
  */
 
+#include <errno.h>
+
 #include "msg.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#ifdef MODULE_GNRC_NETIF_ATTR
+#include "net/gnrc/netif/attr.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -74,6 +79,21 @@ static inline int _snd_rcv(kernel_pid_t pid, uint16_t type, gnrc_pktsnip_t *pkt)
     return ret;
 }
 
+static void _snd_rcv_bulk(const kernel_pid_t *pids, unsigned num,
+                          uint16_t type, gnrc_pktsnip_t *pkt)
+{
+    msg_t msg;
+    /* set the outgoing message's fields */
+    msg.type = type;
+    msg.content.ptr = (void *)pkt;
+    /* send message to all threads at once */
+    for (unsigned i = msg_send_bulk(&msg, pids, num); i < num; i++) {
+        DEBUG("gnrc_netapi: dropped message (receiver queue is full)\n");
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, ENOBUFS);
+    }
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -81,16 +101,31 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     if (numof != 0) {
         gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+        kernel_pid_t pids[GNRC_NETAPI_MSG_BULK];
+        unsigned num = 0;
 
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-            if (_snd_rcv(sendto->pid, cmd, pkt) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release(pkt);
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+            if (sendto->cbd != NULL) {
+                /* the callback takes over the packet */
+                sendto->cbd->cb(cmd, pkt, sendto->cbd->ctx);
+            }
+            else
+#endif
+            {
+                pids[num++] = sendto->pid;
+                if (num == GNRC_NETAPI_MSG_BULK) {
+                    _snd_rcv_bulk(pids, num, cmd, pkt);
+                    num = 0;
+                }
             }
             sendto = gnrc_netreg_getnext(sendto);
         }
+        if (num > 0) {
+            _snd_rcv_bulk(pids, num, cmd, pkt);
+        }
     }
 
     return numof;
@@ -109,6 +144,14 @@ int gnrc_netapi_receive(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
 int gnrc_netapi_get(kernel_pid_t pid, netopt_t opt, uint16_t context,
                     void *data, size_t data_len)
 {
+#ifdef MODULE_GNRC_NETIF_ATTR
+    int res;
+
+    if ((context == 0) &&
+        gnrc_netif_attr_get(pid, opt, data, data_len, &res)) {
+        return res;
+    }
+#endif
     return _get_set(pid, GNRC_NETAPI_MSG_TYPE_GET, opt, context,
                     data, data_len);
 }
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "seqlock.h"
+#include "net/eui64.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/attr.h"
+#include "net/gnrc/nettype.h"
+
+/* marks an option whose value did not fit into the cache */
+#define UNCACHED    (INT16_MIN)
+
+/* the cached options, each queried with the size drivers expect for it */
+static const struct {
+    netopt_t opt;
+    uint8_t len;
+} _opts[] = {
+    { NETOPT_ADDRESS, GNRC_NETIF_ATTR_MAXLEN },
+    { NETOPT_ADDRESS_LONG, GNRC_NETIF_ATTR_MAXLEN },
+    { NETOPT_SRC_LEN, sizeof(uint16_t) },
+    { NETOPT_MAX_PACKET_SIZE, sizeof(uint16_t) },
+    { NETOPT_IPV6_IID, sizeof(eui64_t) },
+    { NETOPT_PROTO, sizeof(gnrc_nettype_t) },
+    { NETOPT_IS_WIRED, 0 },
+};
+
+#define OPTS_NUMOF  (sizeof(_opts) / sizeof(_opts[0]))
+
+typedef struct {
+    seqlock_t lock;
+    kernel_pid_t pid;
+    int16_t res[OPTS_NUMOF];
+    uint8_t value[OPTS_NUMOF][GNRC_NETIF_ATTR_MAXLEN];
+} _attr_t;
+
+static _attr_t _attrs[GNRC_NETIF_NUMOF];
+/* serializes writers of _attrs, the seqlocks only protect readers */
+static mutex_t _write_lock = MUTEX_INIT;
+
+static _attr_t *_find(kernel_pid_t pid)
+{
+    for (unsigned i = 0; i < GNRC_NETIF_NUMOF; i++) {
+        if (_attrs[i].pid == pid) {
+            return &_attrs[i];
+        }
+    }
+    return NULL;
+}
+
+int gnrc_netif_attr_publish(kernel_pid_t pid, gnrc_netif_attr_get_t get,
+                            void *ctx)
+{
+    _attr_t *attr;
+
+    mutex_lock(&_write_lock);
+    attr = _find(pid);
+    if (attr == NULL) {
+        attr = _find(KERNEL_PID_UNDEF);
+        if (attr == NULL) {
+            mutex_unlock(&_write_lock);
+            return -ENOMEM;
+        }
+    }
+    seqlock_write_begin(&attr->lock);
+    attr->pid = pid;
+    for (unsigned i = 0; i < OPTS_NUMOF; i++) {
+        int res = UNCACHED;
+
+        if (_opts[i].len <= GNRC_NETIF_ATTR_MAXLEN) {
+            res = get(ctx, _opts[i].opt, (_opts[i].len > 0) ? attr->value[i] : NULL,
+                      _opts[i].len);
+            /* options like NETOPT_IS_WIRED return a value but write no data */
+            if ((res == -EOVERFLOW) ||
+                ((_opts[i].len > 0) && (res > (int)_opts[i].len))) {
+                res = UNCACHED;
+            }
+        }
+        attr->res[i] = res;
+    }
+    seqlock_write_end(&attr->lock);
+    mutex_unlock(&_write_lock);
+    return 0;
+}
+
+void gnrc_netif_attr_remove(kernel_pid_t pid)
+{
+    _attr_t *attr;
+
+    mutex_lock(&_write_lock);
+    attr = _find(pid);
+    if (attr != NULL) {
+        seqlock_write_begin(&attr->lock);
+        attr->pid = KERNEL_PID_UNDEF;
+        seqlock_write_end(&attr->lock);
+    }
+    mutex_unlock(&_write_lock);
+}
+
+int gnrc_netif_attr_get(kernel_pid_t pid, netopt_t opt, void *value,
+                        size_t max_len, int *res)
+{
+    _attr_t *attr;
+    unsigned i = 0;
+
+    while (_opts[i].opt != opt) {
+        if (++i == OPTS_NUMOF) {
+            return 0;
+        }
+    }
+    if ((pid == KERNEL_PID_UNDEF) || ((attr = _find(pid)) == NULL)) {
+        return 0;
+    }
+
+    unsigned seq = seqlock_read_begin(&attr->lock);
+    int tmp = attr->res[i];
+
+    if (tmp == UNCACHED) {
+        return 0;
+    }
+    if ((tmp > 0) && (_opts[i].len > 0) && (value != NULL)) {
+        if ((size_t)tmp > max_len) {
+            /* let the device report the error */
+            return 0;
+        }
+        memcpy(value, attr->value[i], tmp);
+    }
+    /* don't wait for an update in progress, the writer may be preempted by
+     * us; the caller asks the interface thread instead */
+    if (!seqlock_read_valid(&attr->lock, seq) || (attr->pid != pid)) {
+        return 0;
+    }
+    *res = tmp;
+    return 1;
+}
+
+/** @} */
@@ -16,6 +16,9 @@
 #include <errno.h>
 #include "kernel_types.h"
 #include "net/gnrc/netif.h"
+#ifdef MODULE_GNRC_NETIF_ATTR
+#include "net/gnrc/netif/attr.h"
+#endif
 
 #ifdef MODULE_GNRC_IPV6_NETIF
 #include "net/gnrc/ipv6/netif.h"
@@ -74,6 +77,9 @@ void gnrc_netif_remove(kernel_pid_t pid)
     for (i = 0; i < GNRC_NETIF_NUMOF; i++) {
         if (ifs[i] == pid) {
             ifs[i] = KERNEL_PID_UNDEF;
+#ifdef MODULE_GNRC_NETIF_ATTR
+            gnrc_netif_attr_remove(pid);
+#endif
 
             for (int j = 0; if_handler[j].remove != NULL; j++) {
                 if_handler[j].remove(pid);
@@ -22,6 +22,7 @@
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/tcp.h"
 #include "net/gnrc/udp.h"
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
@@ -37,8 +38,13 @@ void gnrc_netreg_init(void)
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+    /* only threads with a message queue are allowed to register at gnrc */
+    assert((entry->cbd != NULL) || sched_threads[entry->pid]->msg_array);
+#else
     /* only threads with a message queue are allowed to register at gnrc */
     assert(sched_threads[entry->pid]->msg_array);
+#endif
 
     if (_INVALID_TYPE(type)) {
         return -EINVAL;
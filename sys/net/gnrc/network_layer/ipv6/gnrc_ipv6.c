@@ -30,6 +30,7 @@
 #include "utlist.h"
 
 #include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/mcast.h"
 #include "net/gnrc/ipv6/netif.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
@@ -50,10 +51,12 @@ static char _stack[GNRC_IPV6_STACK_SIZE];
 #ifdef MODULE_FIB
 #include "net/fib.h"
 #include "net/fib/table.h"
+#ifndef MODULE_FIB_DYNAMIC
 /**
  * @brief buffer to store the entries in the IPv6 forwarding table
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
+#endif
 
 /**
  * @brief the IPv6 forwarding table
@@ -88,7 +91,13 @@ kernel_pid_t gnrc_ipv6_init(void)
     }
 
 #ifdef MODULE_FIB
+#ifdef MODULE_FIB_DYNAMIC
+    /* allocated by fib_init() */
+    gnrc_ipv6_fib_table.data.entries = NULL;
+    gnrc_ipv6_fib_table.max_size = GNRC_IPV6_FIB_TABLE_MAX_SIZE;
+#else
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
+#endif
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
     fib_init(&gnrc_ipv6_fib_table);
@@ -240,14 +249,15 @@ static void _dispatch_next_header(gnrc_pktsnip_t *current, gnrc_pktsnip_t *pkt,
 
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    msg_t msgs[GNRC_NETAPI_MSG_BULK], reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    int num;
     gnrc_netreg_entry_t me_reg;
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
 
-    me_reg.demux_ctx = GNRC_NETREG_DEMUX_CTX_ALL;
-    me_reg.pid = thread_getpid();
+    gnrc_netreg_entry_init_pid(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
 
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
@@ -258,103 +268,108 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
+        num = msg_receive_bulk(msgs, GNRC_NETAPI_MSG_BULK);
+
+        for (int i = 0; i < num; i++) {
+            msg_t *msg = &msgs[i];
+
+            switch (msg->type) {
+                case GNRC_NETAPI_MSG_TYPE_RCV:
+                    DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+                    _receive(msg->content.ptr);
+                    break;
+
+                case GNRC_NETAPI_MSG_TYPE_SND:
+                    DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+                    _send(msg->content.ptr, true);
+                    break;
+
+                case GNRC_NETAPI_MSG_TYPE_GET:
+                case GNRC_NETAPI_MSG_TYPE_SET:
+                    DEBUG("ipv6: reply to unsupported get/set\n");
+                    reply.content.value = -ENOTSUP;
+                    msg_reply(msg, &reply);
+                    break;
 
 #ifdef MODULE_GNRC_NDP
-            case GNRC_NDP_MSG_RTR_TIMEOUT:
-                DEBUG("ipv6: Router timeout received\n");
-                ((gnrc_ipv6_nc_t *)msg.content.ptr)->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
-                break;
-
-            /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
-             * solved properly */
-            /* case GNRC_NDP_MSG_ADDR_TIMEOUT: */
-            /*     DEBUG("ipv6: Router advertisement timer event received\n"); */
-            /*     gnrc_ipv6_netif_remove_addr(KERNEL_PID_UNDEF, */
-            /*                                 msg.content.ptr); */
-            /*     break; */
-
-            case GNRC_NDP_MSG_NBR_SOL_RETRANS:
-                DEBUG("ipv6: Neigbor solicitation retransmission timer event received\n");
-                gnrc_ndp_retrans_nbr_sol(msg.content.ptr);
-                break;
-
-            case GNRC_NDP_MSG_NC_STATE_TIMEOUT:
-                DEBUG("ipv6: Neigbor cache state timeout received\n");
-                gnrc_ndp_state_timeout(msg.content.ptr);
-                break;
+                case GNRC_NDP_MSG_RTR_TIMEOUT:
+                    DEBUG("ipv6: Router timeout received\n");
+                    ((gnrc_ipv6_nc_t *)msg->content.ptr)->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+                    break;
+
+                /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
+                 * solved properly */
+                /* case GNRC_NDP_MSG_ADDR_TIMEOUT: */
+                /*     DEBUG("ipv6: Router advertisement timer event received\n"); */
+                /*     gnrc_ipv6_netif_remove_addr(KERNEL_PID_UNDEF, */
+                /*                                 msg->content.ptr); */
+                /*     break; */
+
+                case GNRC_NDP_MSG_NBR_SOL_RETRANS:
+                    DEBUG("ipv6: Neigbor solicitation retransmission timer event received\n");
+                    gnrc_ndp_retrans_nbr_sol(msg->content.ptr);
+                    break;
+
+                case GNRC_NDP_MSG_NC_STATE_TIMEOUT:
+                    DEBUG("ipv6: Neigbor cache state timeout received\n");
+                    gnrc_ndp_state_timeout(msg->content.ptr);
+                    break;
 #endif
 #ifdef MODULE_GNRC_NDP_ROUTER
-            case GNRC_NDP_MSG_RTR_ADV_RETRANS:
-                DEBUG("ipv6: Router advertisement retransmission event received\n");
-                gnrc_ndp_router_retrans_rtr_adv(msg.content.ptr);
-                break;
-            case GNRC_NDP_MSG_RTR_ADV_DELAY:
-                DEBUG("ipv6: Delayed router advertisement event received\n");
-                gnrc_ndp_router_send_rtr_adv(msg.content.ptr);
-                break;
+                case GNRC_NDP_MSG_RTR_ADV_RETRANS:
+                    DEBUG("ipv6: Router advertisement retransmission event received\n");
+                    gnrc_ndp_router_retrans_rtr_adv(msg->content.ptr);
+                    break;
+                case GNRC_NDP_MSG_RTR_ADV_DELAY:
+                    DEBUG("ipv6: Delayed router advertisement event received\n");
+                    gnrc_ndp_router_send_rtr_adv(msg->content.ptr);
+                    break;
 #endif
 #ifdef MODULE_GNRC_NDP_HOST
-            case GNRC_NDP_MSG_RTR_SOL_RETRANS:
-                DEBUG("ipv6: Router solicitation retransmission event received\n");
-                gnrc_ndp_host_retrans_rtr_sol(msg.content.ptr);
-                break;
+                case GNRC_NDP_MSG_RTR_SOL_RETRANS:
+                    DEBUG("ipv6: Router solicitation retransmission event received\n");
+                    gnrc_ndp_host_retrans_rtr_sol(msg->content.ptr);
+                    break;
 #endif
 #ifdef MODULE_GNRC_SIXLOWPAN_ND
-            case GNRC_SIXLOWPAN_ND_MSG_MC_RTR_SOL:
-                DEBUG("ipv6: Multicast router solicitation event received\n");
-                gnrc_sixlowpan_nd_mc_rtr_sol(msg.content.ptr);
-                break;
-            case GNRC_SIXLOWPAN_ND_MSG_UC_RTR_SOL:
-                DEBUG("ipv6: Unicast router solicitation event received\n");
-                gnrc_sixlowpan_nd_uc_rtr_sol(msg.content.ptr);
-                break;
+                case GNRC_SIXLOWPAN_ND_MSG_MC_RTR_SOL:
+                    DEBUG("ipv6: Multicast router solicitation event received\n");
+                    gnrc_sixlowpan_nd_mc_rtr_sol(msg->content.ptr);
+                    break;
+                case GNRC_SIXLOWPAN_ND_MSG_UC_RTR_SOL:
+                    DEBUG("ipv6: Unicast router solicitation event received\n");
+                    gnrc_sixlowpan_nd_uc_rtr_sol(msg->content.ptr);
+                    break;
 #   ifdef MODULE_GNRC_SIXLOWPAN_CTX
-            case GNRC_SIXLOWPAN_ND_MSG_DELETE_CTX:
-                DEBUG("ipv6: Delete 6LoWPAN context event received\n");
-                gnrc_sixlowpan_ctx_remove(((((gnrc_sixlowpan_ctx_t *)msg.content.ptr)->flags_id) &
-                                           GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK));
-                break;
+                case GNRC_SIXLOWPAN_ND_MSG_DELETE_CTX:
+                    DEBUG("ipv6: Delete 6LoWPAN context event received\n");
+                    gnrc_sixlowpan_ctx_remove(
+                        (((gnrc_sixlowpan_ctx_t *)msg->content.ptr)->flags_id) &
+                        GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                    break;
 #   endif
 #endif
 #ifdef MODULE_GNRC_SIXLOWPAN_ND_ROUTER
-            case GNRC_SIXLOWPAN_ND_MSG_ABR_TIMEOUT:
-                DEBUG("ipv6: border router timeout event received\n");
-                gnrc_sixlowpan_nd_router_abr_remove(msg.content.ptr);
-                break;
-            /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
-             * solved properly */
-            /* case GNRC_SIXLOWPAN_ND_MSG_AR_TIMEOUT: */
-            /*     DEBUG("ipv6: address registration timeout received\n"); */
-            /*     gnrc_sixlowpan_nd_router_gc_nc(msg.content.ptr); */
-            /*     break; */
-            case GNRC_NDP_MSG_RTR_ADV_SIXLOWPAN_DELAY:
-                DEBUG("ipv6: Delayed router advertisement event received\n");
-                gnrc_ipv6_nc_t *nc_entry = msg.content.ptr;
-                gnrc_ndp_internal_send_rtr_adv(nc_entry->iface, NULL,
-                                               &(nc_entry->ipv6_addr), false);
-                break;
+                case GNRC_SIXLOWPAN_ND_MSG_ABR_TIMEOUT:
+                    DEBUG("ipv6: border router timeout event received\n");
+                    gnrc_sixlowpan_nd_router_abr_remove(msg->content.ptr);
+                    break;
+                /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
+                 * solved properly */
+                /* case GNRC_SIXLOWPAN_ND_MSG_AR_TIMEOUT: */
+                /*     DEBUG("ipv6: address registration timeout received\n"); */
+                /*     gnrc_sixlowpan_nd_router_gc_nc(msg->content.ptr); */
+                /*     break; */
+                case GNRC_NDP_MSG_RTR_ADV_SIXLOWPAN_DELAY:
+                    DEBUG("ipv6: Delayed router advertisement event received\n");
+                    gnrc_ipv6_nc_t *nc_entry = msg->content.ptr;
+                    gnrc_ndp_internal_send_rtr_adv(nc_entry->iface, NULL,
+                                                   &(nc_entry->ipv6_addr), false);
+                    break;
 #endif
-            default:
-                break;
+                default:
+                    break;
+            }
         }
     }
 
@@ -389,7 +404,7 @@ static void _send_to_iface(kernel_pid_t iface, gnrc_pktsnip_t *pkt)
 #endif
     if (gnrc_netapi_send(iface, pkt) < 1) {
         DEBUG("ipv6: unable to send packet\n");
-        gnrc_pktbuf_release(pkt);
+        gnrc_pktbuf_release_error(pkt, ENOBUFS);
     }
 }
 
@@ -410,7 +425,9 @@ static void _send_unicast(kernel_pid_t iface, uint8_t *dst_l2addr,
     }
 
     DEBUG("ipv6: add interface header to packet\n");
-    netif = gnrc_netif_hdr_build(NULL, 0, dst_l2addr, dst_l2addr_len);
+    /* prepend directly so the header can be taken from pkt's headroom */
+    netif = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_netif_hdr_t) + dst_l2addr_len,
+                            GNRC_NETTYPE_NETIF);
 
     if (netif == NULL) {
         DEBUG("ipv6: error on interface header allocation, dropping packet\n");
@@ -418,8 +435,9 @@ static void _send_unicast(kernel_pid_t iface, uint8_t *dst_l2addr,
         return;
     }
 
-    /* add netif to front of the pkt list */
-    LL_PREPEND(pkt, netif);
+    gnrc_netif_hdr_init(netif->data, 0, dst_l2addr_len);
+    gnrc_netif_hdr_set_dst_addr(netif->data, dst_l2addr, dst_l2addr_len);
+    pkt = netif;
 
     DEBUG("ipv6: send unicast over interface %" PRIkernel_pid "\n", iface);
     /* and send to interface */
@@ -500,6 +518,44 @@ static inline void _send_multicast_over_iface(kernel_pid_t iface, gnrc_pktsnip_t
     _send_to_iface(iface, pkt);
 }
 
+#if GNRC_NETIF_NUMOF > 1
+/* checks if the IPv6 header of a multicast packet is filled the same for all
+ * interfaces by _fill_ipv6_hdr(), i.e. with the same hop limit and source
+ * address */
+static bool _mcast_hdr_shareable(kernel_pid_t *ifs, size_t ifnum, ipv6_hdr_t *hdr)
+{
+    ipv6_addr_t *src = NULL;
+    uint8_t hl = 0;
+
+    for (size_t i = 0; i < ifnum; i++) {
+        gnrc_ipv6_netif_t *if_entry = gnrc_ipv6_netif_get(ifs[i]);
+
+        if (if_entry == NULL) {
+            return false;
+        }
+        if (hdr->hl == 0) {
+            if ((i > 0) && (if_entry->cur_hl != hl)) {
+                return false;
+            }
+            hl = if_entry->cur_hl;
+        }
+        if (ipv6_addr_is_unspecified(&hdr->src)) {
+            ipv6_addr_t *tmp = gnrc_ipv6_netif_find_best_src_addr(ifs[i], &hdr->dst, false);
+
+            if ((i > 0) && ((tmp == NULL) != (src == NULL))) {
+                return false;
+            }
+            if ((i > 0) && (tmp != NULL) && !ipv6_addr_equal(tmp, src)) {
+                return false;
+            }
+            src = tmp;
+        }
+    }
+
+    return true;
+}
+#endif
+
 static void _send_multicast(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
                             gnrc_pktsnip_t *ipv6, gnrc_pktsnip_t *payload,
                             bool prep_hdr)
@@ -523,13 +579,27 @@ static void _send_multicast(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
 #if GNRC_NETIF_NUMOF > 1
     /* netif header not present: send over all interfaces */
     if (iface == KERNEL_PID_UNDEF) {
+        /* if the header is filled the same for all interfaces, it is filled
+         * once and all interfaces share the packet */
+        bool share = !prep_hdr || _mcast_hdr_shareable(ifs, ifnum, ipv6->data);
+
         assert(pkt == ipv6);
+        if (prep_hdr && share) {
+            if (_fill_ipv6_hdr(ifs[0], ipv6, payload) < 0) {
+                /* error on filling up header */
+                gnrc_pktbuf_release(pkt);
+                return;
+            }
+        }
+
         /* send packet to link layer */
         gnrc_pktbuf_hold(pkt, ifnum - 1);
 
         for (size_t i = 0; i < ifnum; i++) {
             gnrc_pktsnip_t *netif;
-            if (prep_hdr) {
+
+            ipv6 = pkt;
+            if (!share) {
                 /* need to get second write access (duplication) to fill IPv6
                  * header interface-local */
                 gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt);
@@ -698,6 +768,9 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     payload = ipv6->next;
 
     if (ipv6_addr_is_multicast(&hdr->dst)) {
+#ifdef MODULE_GNRC_IPV6_MCAST
+        gnrc_ipv6_mcast_sent(&hdr->dst);
+#endif
         _send_multicast(iface, pkt, ipv6, payload, prep_hdr);
     }
     else if ((ipv6_addr_is_loopback(&hdr->dst)) ||      /* dst is loopback address */
@@ -772,6 +845,18 @@ static inline bool _pkt_not_for_me(kernel_pid_t *iface, ipv6_hdr_t *hdr)
     if (ipv6_addr_is_loopback(&hdr->dst)) {
         return false;
     }
+#ifdef MODULE_GNRC_IPV6_MCAST
+    else if (ipv6_addr_is_multicast(&hdr->dst)) {
+        /* link-local groups must be joined on the receiving interface */
+        kernel_pid_t if_pid = gnrc_ipv6_mcast_rcv(ipv6_addr_is_link_local(&hdr->dst) ?
+                                                  *iface : KERNEL_PID_UNDEF,
+                                                  &hdr->dst);
+        if (*iface == KERNEL_PID_UNDEF) {
+            *iface = if_pid;
+        }
+        return (if_pid == KERNEL_PID_UNDEF);
+    }
+#endif
     else if ((!ipv6_addr_is_link_local(&hdr->dst)) ||
              (*iface == KERNEL_PID_UNDEF)) {
         kernel_pid_t if_pid = gnrc_ipv6_netif_find_by_addr(NULL, &hdr->dst);
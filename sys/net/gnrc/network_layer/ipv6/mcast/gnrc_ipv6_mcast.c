@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "mutex.h"
+
+#include "net/gnrc/ipv6/mcast.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+typedef struct {
+    /**
+     * @brief   The group. Unspecified if the entry was never used, an entry
+     *          without interfaces is a deleted group.
+     */
+    ipv6_addr_t addr;
+    BITFIELD(ifs, GNRC_NETIF_NUMOF);    /**< interfaces (see _ifs) */
+    gnrc_ipv6_mcast_stats_t stats;      /**< packet counters */
+} _group_t;
+
+static _group_t _groups[GNRC_IPV6_MCAST_GROUP_NUMOF];
+/* interfaces represented by the bits of _group_t::ifs */
+static kernel_pid_t _ifs[GNRC_NETIF_NUMOF];
+static mutex_t _mutex = MUTEX_INIT;
+
+#if ENABLE_DEBUG
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+#endif
+
+static inline unsigned _hash(const ipv6_addr_t *group)
+{
+    /* groups mostly differ in the lower bytes (e.g. solicited-nodes groups),
+     * so fold all of them */
+    uint32_t h = group->u32[0].u32 ^ group->u32[1].u32 ^
+                 group->u32[2].u32 ^ group->u32[3].u32;
+
+    h *= 2654435761U;   /* Knuth's multiplicative hash */
+    return (h ^ (h >> 16)) % GNRC_IPV6_MCAST_GROUP_NUMOF;
+}
+
+static inline bool _has_ifs(const _group_t *g)
+{
+    for (unsigned i = 0; i < sizeof(g->ifs); i++) {
+        if (g->ifs[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* finds a joined group, linear probing from the group's hash */
+static _group_t *_find(const ipv6_addr_t *group)
+{
+    unsigned pos = _hash(group);
+
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group_t *g = &_groups[pos];
+
+        if (ipv6_addr_is_unspecified(&g->addr)) {
+            /* end of the probe sequence */
+            return NULL;
+        }
+        if (ipv6_addr_equal(&g->addr, group) && _has_ifs(g)) {
+            return g;
+        }
+        pos = (pos + 1) % GNRC_IPV6_MCAST_GROUP_NUMOF;
+    }
+    return NULL;
+}
+
+/* finds a free or deleted entry for a group */
+static _group_t *_alloc(const ipv6_addr_t *group)
+{
+    unsigned pos = _hash(group);
+
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group_t *g = &_groups[pos];
+
+        if (!_has_ifs(g)) {
+            memcpy(&g->addr, group, sizeof(g->addr));
+            memset(&g->stats, 0, sizeof(g->stats));
+            return g;
+        }
+        pos = (pos + 1) % GNRC_IPV6_MCAST_GROUP_NUMOF;
+    }
+    return NULL;
+}
+
+static int _if_idx(kernel_pid_t iface)
+{
+    for (int i = 0; i < GNRC_NETIF_NUMOF; i++) {
+        if (_ifs[i] == iface) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* frees the bit of an interface if it left all groups */
+static void _release_if(int idx)
+{
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        if (bf_isset(_groups[i].ifs, idx)) {
+            return;
+        }
+    }
+    _ifs[idx] = KERNEL_PID_UNDEF;
+}
+
+int gnrc_ipv6_mcast_join(kernel_pid_t iface, const ipv6_addr_t *group)
+{
+    if ((iface == KERNEL_PID_UNDEF) || !ipv6_addr_is_multicast(group)) {
+        return -EINVAL;
+    }
+
+    mutex_lock(&_mutex);
+
+    int idx = _if_idx(iface);
+
+    if ((idx < 0) && ((idx = _if_idx(KERNEL_PID_UNDEF)) >= 0)) {
+        _ifs[idx] = iface;
+    }
+
+    _group_t *g = _find(group);
+
+    if (g == NULL) {
+        g = _alloc(group);
+    }
+
+    if ((idx < 0) || (g == NULL)) {
+        DEBUG("ipv6 mcast: no space left to join %s on interface %" PRIkernel_pid "\n",
+              ipv6_addr_to_str(addr_str, group, sizeof(addr_str)), iface);
+        if (idx >= 0) {
+            _release_if(idx);
+        }
+        mutex_unlock(&_mutex);
+        return -ENOMEM;
+    }
+
+    DEBUG("ipv6 mcast: joined %s on interface %" PRIkernel_pid "\n",
+          ipv6_addr_to_str(addr_str, group, sizeof(addr_str)), iface);
+    bf_set(g->ifs, idx);
+
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_ipv6_mcast_leave(kernel_pid_t iface, const ipv6_addr_t *group)
+{
+    mutex_lock(&_mutex);
+
+    int idx = _if_idx(iface);
+    _group_t *g = _find(group);
+
+    if ((iface != KERNEL_PID_UNDEF) && (idx >= 0) && (g != NULL)) {
+        DEBUG("ipv6 mcast: left %s on interface %" PRIkernel_pid "\n",
+              ipv6_addr_to_str(addr_str, group, sizeof(addr_str)), iface);
+        bf_unset(g->ifs, idx);
+        _release_if(idx);
+    }
+
+    mutex_unlock(&_mutex);
+}
+
+void gnrc_ipv6_mcast_leave_all(kernel_pid_t iface)
+{
+    mutex_lock(&_mutex);
+
+    int idx = _if_idx(iface);
+
+    if ((iface != KERNEL_PID_UNDEF) && (idx >= 0)) {
+        DEBUG("ipv6 mcast: interface %" PRIkernel_pid " left all groups\n", iface);
+        for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+            bf_unset(_groups[i].ifs, idx);
+        }
+        _ifs[idx] = KERNEL_PID_UNDEF;
+    }
+
+    mutex_unlock(&_mutex);
+}
+
+kernel_pid_t gnrc_ipv6_mcast_rcv(kernel_pid_t iface, const ipv6_addr_t *group)
+{
+    kernel_pid_t res = KERNEL_PID_UNDEF;
+
+    mutex_lock(&_mutex);
+
+    _group_t *g = _find(group);
+
+    if (g != NULL) {
+        if (iface == KERNEL_PID_UNDEF) {
+            for (int i = 0; i < GNRC_NETIF_NUMOF; i++) {
+                if (bf_isset(g->ifs, i)) {
+                    res = _ifs[i];
+                    break;
+                }
+            }
+        }
+        else {
+            int idx = _if_idx(iface);
+
+            if ((idx >= 0) && bf_isset(g->ifs, idx)) {
+                res = iface;
+            }
+        }
+        if (res != KERNEL_PID_UNDEF) {
+            g->stats.rx_count++;
+        }
+    }
+
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+void gnrc_ipv6_mcast_sent(const ipv6_addr_t *group)
+{
+    mutex_lock(&_mutex);
+
+    _group_t *g = _find(group);
+
+    if (g != NULL) {
+        g->stats.tx_count++;
+    }
+
+    mutex_unlock(&_mutex);
+}
+
+int gnrc_ipv6_mcast_get_stats(const ipv6_addr_t *group, gnrc_ipv6_mcast_stats_t *stats)
+{
+    int res = -ENOENT;
+
+    mutex_lock(&_mutex);
+
+    _group_t *g = _find(group);
+
+    if (g != NULL) {
+        memcpy(stats, &g->stats, sizeof(*stats));
+        res = 0;
+    }
+
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+void gnrc_ipv6_mcast_print(void)
+{
+    char addr[IPV6_ADDR_MAX_STR_LEN];
+
+    mutex_lock(&_mutex);
+
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group_t *g = &_groups[i];
+
+        if (!_has_ifs(g)) {
+            continue;
+        }
+        printf("%s ifs:", ipv6_addr_to_str(addr, &g->addr, sizeof(addr)));
+        for (int j = 0; j < GNRC_NETIF_NUMOF; j++) {
+            if (bf_isset(g->ifs, j)) {
+                printf(" %" PRIkernel_pid, _ifs[j]);
+            }
+        }
+        printf(" rx: %" PRIu32 " tx: %" PRIu32 "\n", g->stats.rx_count,
+               g->stats.tx_count);
+    }
+
+    mutex_unlock(&_mutex);
+}
+
+/** @} */
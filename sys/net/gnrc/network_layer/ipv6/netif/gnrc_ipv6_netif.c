@@ -33,6 +33,9 @@
 #include "net/gnrc/sixlowpan/netif.h"
 
 #include "net/gnrc/ipv6/netif.h"
+#ifdef MODULE_GNRC_IPV6_MCAST
+#include "net/gnrc/ipv6/mcast.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -57,6 +60,17 @@ static gnrc_ipv6_netif_t ipv6_ifs[GNRC_NETIF_NUMOF];
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #endif
 
+static inline void _src_cache_flush(gnrc_ipv6_netif_t *entry)
+{
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+    for (unsigned i = 0; i < GNRC_IPV6_NETIF_SRC_CACHE_SIZE; i++) {
+        entry->src_cache[i].src = NULL;
+    }
+#else
+    (void)entry;
+#endif
+}
+
 static ipv6_addr_t *_add_addr_to_entry(gnrc_ipv6_netif_t *entry, const ipv6_addr_t *addr,
                                        uint8_t prefix_len, uint8_t flags)
 {
@@ -79,6 +93,14 @@ static ipv6_addr_t *_add_addr_to_entry(gnrc_ipv6_netif_t *entry, const ipv6_addr
         return NULL;
     }
 
+#ifdef MODULE_GNRC_IPV6_MCAST
+    if (ipv6_addr_is_multicast(addr) && (gnrc_ipv6_mcast_join(entry->pid, addr) < 0)) {
+        DEBUG("ipv6 netif: couldn't join %s on interface %" PRIkernel_pid "\n",
+              ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), entry->pid);
+        return NULL;
+    }
+#endif
+
     memcpy(&(tmp_addr->addr), addr, sizeof(ipv6_addr_t));
     DEBUG("ipv6 netif: Added %s/%" PRIu8 " to interface %" PRIkernel_pid "\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)),
@@ -86,6 +108,7 @@ static ipv6_addr_t *_add_addr_to_entry(gnrc_ipv6_netif_t *entry, const ipv6_addr
 
     tmp_addr->prefix_len = prefix_len;
     tmp_addr->flags = flags;
+    _src_cache_flush(entry);
 
 #ifdef MODULE_GNRC_SIXLOWPAN_ND
     if (!ipv6_addr_is_multicast(&(tmp_addr->addr)) &&
@@ -165,6 +188,10 @@ static void _reset_addr_from_entry(gnrc_ipv6_netif_t *entry)
 {
     DEBUG("ipv6 netif: Reset IPv6 addresses on interface %" PRIkernel_pid "\n", entry->pid);
     memset(entry->addrs, 0, sizeof(entry->addrs));
+    _src_cache_flush(entry);
+#ifdef MODULE_GNRC_IPV6_MCAST
+    gnrc_ipv6_mcast_leave_all(entry->pid);
+#endif
 }
 
 static void _ipv6_netif_remove(gnrc_ipv6_netif_t *entry)
@@ -229,6 +256,10 @@ void gnrc_ipv6_netif_add(kernel_pid_t pid)
     free_entry->mtu = GNRC_IPV6_NETIF_DEFAULT_MTU;
     free_entry->cur_hl = GNRC_IPV6_NETIF_DEFAULT_HL;
     free_entry->flags = 0;
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+    free_entry->src_cache_hits = 0;
+    free_entry->src_cache_misses = 0;
+#endif
 
     _add_addr_to_entry(free_entry, &ipv6_addr_all_nodes_link_local,
                        IPV6_ADDR_BIT_LEN, 0);
@@ -320,8 +351,14 @@ static void _remove_addr_from_entry(gnrc_ipv6_netif_t *entry, ipv6_addr_t *addr)
         if (ipv6_addr_equal(&(entry->addrs[i].addr), addr)) {
             DEBUG("ipv6 netif: Remove %s to interface %" PRIkernel_pid "\n",
                   ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), entry->pid);
+#ifdef MODULE_GNRC_IPV6_MCAST
+            if (ipv6_addr_is_multicast(addr)) {
+                gnrc_ipv6_mcast_leave(entry->pid, addr);
+            }
+#endif
             ipv6_addr_set_unspecified(&(entry->addrs[i].addr));
             entry->addrs[i].flags = 0;
+            _src_cache_flush(entry);
 #ifdef MODULE_GNRC_NDP_ROUTER
             /* Removal of prefixes MAY allow the router to retransmit up to
              * GNRC_NDP_MAX_INIT_RTR_ADV_NUMOF unsolicited RA
@@ -382,6 +419,21 @@ void gnrc_ipv6_netif_reset_addr(kernel_pid_t pid)
     mutex_unlock(&entry->mutex);
 }
 
+void gnrc_ipv6_netif_src_cache_flush(kernel_pid_t pid)
+{
+    gnrc_ipv6_netif_t *entry = gnrc_ipv6_netif_get(pid);
+
+    if (entry == NULL) {
+        return;
+    }
+
+    mutex_lock(&entry->mutex);
+
+    _src_cache_flush(entry);
+
+    mutex_unlock(&entry->mutex);
+}
+
 kernel_pid_t gnrc_ipv6_netif_find_by_addr(ipv6_addr_t **out, const ipv6_addr_t *addr)
 {
     for (int i = 0; i < GNRC_NETIF_NUMOF; i++) {
@@ -767,11 +819,51 @@ static ipv6_addr_t *_source_address_selection(gnrc_ipv6_netif_t *iface, const ip
     return res;
 }
 
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+static ipv6_addr_t *_src_cache_get(gnrc_ipv6_netif_t *iface, const ipv6_addr_t *dst,
+                                   bool ll_only)
+{
+    for (unsigned i = 0; i < GNRC_IPV6_NETIF_SRC_CACHE_SIZE; i++) {
+        gnrc_ipv6_netif_src_cache_t *entry = &iface->src_cache[i];
+
+        if ((entry->src != NULL) && (entry->ll_only == ll_only) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            iface->src_cache_hits++;
+            return entry->src;
+        }
+    }
+    iface->src_cache_misses++;
+    return NULL;
+}
+
+static void _src_cache_add(gnrc_ipv6_netif_t *iface, const ipv6_addr_t *dst,
+                           bool ll_only, ipv6_addr_t *src)
+{
+    gnrc_ipv6_netif_src_cache_t *entry = &iface->src_cache[iface->src_cache_next];
+
+    memcpy(&entry->dst, dst, sizeof(ipv6_addr_t));
+    entry->ll_only = ll_only;
+    entry->src = src;
+    iface->src_cache_next = (iface->src_cache_next + 1) % GNRC_IPV6_NETIF_SRC_CACHE_SIZE;
+}
+#endif
+
 ipv6_addr_t *gnrc_ipv6_netif_find_best_src_addr(kernel_pid_t pid, const ipv6_addr_t *dst, bool ll_only)
 {
     gnrc_ipv6_netif_t *iface = gnrc_ipv6_netif_get(pid);
     ipv6_addr_t *best_src = NULL;
+
+    if (iface == NULL) {
+        return NULL;
+    }
+
     mutex_lock(&(iface->mutex));
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+    if ((best_src = _src_cache_get(iface, dst, ll_only)) != NULL) {
+        mutex_unlock(&(iface->mutex));
+        return best_src;
+    }
+#endif
     BITFIELD(candidate_set, GNRC_IPV6_NETIF_ADDR_NUMOF);
     memset(candidate_set, 0, sizeof(candidate_set));
 
@@ -781,6 +873,9 @@ ipv6_addr_t *gnrc_ipv6_netif_find_best_src_addr(kernel_pid_t pid, const ipv6_add
         if (best_src == NULL) {
             best_src = &(iface->addrs[first_candidate].addr);
         }
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+        _src_cache_add(iface, dst, ll_only, best_src);
+#endif
     }
     mutex_unlock(&(iface->mutex));
 
@@ -799,6 +799,8 @@ bool gnrc_ndp_internal_pi_opt_handle(kernel_pid_t iface, uint8_t icmpv6_type,
     /* on-link flag MUST stay set if it was */
     netif_addr->flags &= NDP_OPT_PI_FLAGS_L;
     netif_addr->flags |= (pi_opt->flags & NDP_OPT_PI_FLAGS_MASK);
+    /* preferred lifetime may have changed the outcome of source address selection */
+    gnrc_ipv6_netif_src_cache_flush(iface);
     return true;
 }
 
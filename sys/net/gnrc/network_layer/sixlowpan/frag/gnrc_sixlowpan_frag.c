@@ -24,6 +24,9 @@
 #include "net/gnrc/sixlowpan/netif.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
+#ifdef MODULE_GNRC_EVENT
+#include "net/gnrc/event_thread.h"
+#endif
 
 #include "rbuf.h"
 
@@ -37,6 +40,37 @@
 
 static uint16_t _tag;
 
+#ifdef MODULE_GNRC_EVENT
+static gnrc_sixlowpan_msg_frag_t *_cont_msg;
+
+static void _cont_handler(event_t *event)
+{
+    (void)event;
+    gnrc_sixlowpan_frag_send(_cont_msg);
+}
+
+static event_t _cont_event = EVENT_INIT(_cont_handler);
+#endif
+
+/* schedules sending of the next fragment, so other packets are not blocked
+ * by a large datagram */
+static void _continue(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+#ifdef MODULE_GNRC_EVENT
+    /* only one datagram is fragmented at a time, so one event suffices */
+    _cont_msg = fragment_msg;
+    event_post(&gnrc_event_queue, &_cont_event);
+#else
+    msg_t msg;
+
+    /* send message to self*/
+    msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    msg.content.ptr = (void *)fragment_msg;
+    msg_send_to_self(&msg);
+    thread_yield();
+#endif
+}
+
 static inline uint16_t _floor8(uint16_t length)
 {
     return length & 0xf8U;
@@ -47,8 +81,7 @@ static inline size_t _min(size_t a, size_t b)
     return (a < b) ? a : b;
 }
 
-static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
-                                       size_t size)
+static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t hdr_size)
 {
     gnrc_netif_hdr_t *hdr = pkt->data, *new_hdr;
     gnrc_pktsnip_t *netif, *frag;
@@ -67,11 +100,10 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
     new_hdr->rssi = hdr->rssi;
     new_hdr->lqi = hdr->lqi;
 
-    frag = gnrc_pktbuf_add(NULL, NULL, _min(size, payload_len),
-                           GNRC_NETTYPE_SIXLOWPAN);
+    frag = gnrc_pktbuf_add(NULL, NULL, hdr_size, GNRC_NETTYPE_SIXLOWPAN);
 
     if (frag == NULL) {
-        DEBUG("6lo frag: error allocating first fragment\n");
+        DEBUG("6lo frag: error allocating fragment header\n");
         gnrc_pktbuf_release(netif);
         return NULL;
     }
@@ -81,11 +113,47 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
     return frag;
 }
 
+/* appends the datagram in pkt from offset on to frag, up to max_frag_size
+ * bytes. The fragment refers to the data of the datagram instead of copying
+ * it, the device gathers it from there when sending. */
+static uint16_t _add_frag_payload(gnrc_pktsnip_t *frag, gnrc_pktsnip_t *pkt,
+                                  uint16_t offset, uint16_t max_frag_size)
+{
+    gnrc_pktsnip_t *last = frag->next;     /* fragment header */
+    uint16_t local_offset = 0;
+
+    pkt = pkt->next;    /* skip netif header */
+
+    while ((pkt != NULL) && (local_offset < max_frag_size)) {
+        if (offset >= pkt->size) {      /* snip was sent in previous fragments */
+            offset -= (uint16_t)pkt->size;
+        }
+        else {
+            size_t clen = _min(max_frag_size - local_offset, pkt->size - offset);
+            gnrc_pktsnip_t *slice = gnrc_pktbuf_add_slice(NULL, pkt, offset, clen,
+                                                          GNRC_NETTYPE_UNDEF);
+
+            if (slice == NULL) {
+                DEBUG("6lo frag: error allocating fragment payload\n");
+                return 0;
+            }
+            last->next = slice;
+            last = slice;
+            local_offset += clen;
+            offset = 0;
+        }
+
+        pkt = pkt->next;
+    }
+
+    return local_offset;
+}
+
 static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t *pkt,
                                    size_t payload_len, size_t datagram_size)
 {
     gnrc_pktsnip_t *frag;
-    uint16_t local_offset = 0;
+    uint16_t local_offset;
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     int payload_diff = (datagram_size - payload_len);
@@ -94,37 +162,24 @@ static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     uint16_t max_frag_size = _floor8(iface->max_frag_size + payload_diff -
                                      sizeof(sixlowpan_frag_t)) - payload_diff;
     sixlowpan_frag_t *hdr;
-    uint8_t *data;
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt, payload_len,
-                           max_frag_size + sizeof(sixlowpan_frag_t));
+    frag = _build_frag_pkt(pkt, sizeof(sixlowpan_frag_t));
 
     if (frag == NULL) {
         return 0;
     }
 
     hdr = frag->next->data;
-    data = (uint8_t *)(hdr + 1);
 
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
     hdr->tag = byteorder_htons(_tag);
 
-    pkt = pkt->next;    /* don't copy netif header */
-
-    while (pkt != NULL) {
-        size_t clen = _min(max_frag_size - local_offset, pkt->size);
-
-        memcpy(data + local_offset, pkt->data, clen);
-        local_offset += clen;
-
-        if (local_offset >= max_frag_size) {
-            break;
-        }
-
-        pkt = pkt->next;
+    if ((local_offset = _add_frag_payload(frag, pkt, 0, max_frag_size)) == 0) {
+        gnrc_pktbuf_release(frag);
+        return 0;
     }
 
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
@@ -146,22 +201,18 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     /* since dispatches aren't supposed to go into subsequent fragments, we need not account
      * for payload difference as for the first fragment */
     uint16_t max_frag_size = _floor8(iface->max_frag_size - sizeof(sixlowpan_frag_n_t));
-    uint16_t local_offset = 0, offset_count = 0;
+    uint16_t local_offset;
     sixlowpan_frag_n_t *hdr;
-    uint8_t *data;
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt,
-                           payload_len - offset + sizeof(sixlowpan_frag_n_t),
-                           max_frag_size + sizeof(sixlowpan_frag_n_t));
+    frag = _build_frag_pkt(pkt, sizeof(sixlowpan_frag_n_t));
 
     if (frag == NULL) {
         return 0;
     }
 
     hdr = frag->next->data;
-    data = (uint8_t *)(hdr + 1);
 
     /* XXX: truncation of datagram_size > 4095 may happen here */
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
@@ -169,38 +220,10 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     hdr->tag = byteorder_htons(_tag);
     /* don't mention payload diff in offset */
     hdr->offset = (uint8_t)((offset + (datagram_size - payload_len)) >> 3);
-    pkt = pkt->next;    /* don't copy netif header */
-
-    while ((pkt != NULL) && (offset_count != offset)) {   /* go to offset */
-        offset_count += (uint16_t)pkt->size;
-
-        if (offset_count > offset) {    /* we overshot */
-            /* => copy rest of partly send packet snip */
-            uint16_t pkt_offset = offset - (offset_count - ((uint16_t)pkt->size));
-            size_t clen = _min(max_frag_size, pkt->size - pkt_offset);
-
-            memcpy(data, ((uint8_t *)pkt->data) + pkt_offset, clen);
-            local_offset = clen;
-            pkt = pkt->next;
-            break;
-        }
 
-        pkt = pkt->next;
-    }
-
-    if (local_offset < max_frag_size) { /* copy other packet snips */
-        while (pkt != NULL) {
-            size_t clen = _min(max_frag_size - local_offset, pkt->size);
-
-            memcpy(data + local_offset, pkt->data, clen);
-            local_offset += clen;
-
-            if (local_offset == max_frag_size) {
-                break;
-            }
-
-            pkt = pkt->next;
-        }
+    if ((local_offset = _add_frag_payload(frag, pkt, offset, max_frag_size)) == 0) {
+        gnrc_pktbuf_release(frag);
+        return 0;
     }
 
     DEBUG("6lo frag: send subsequent fragment (datagram size: %u, "
@@ -223,7 +246,6 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     size_t payload_len = gnrc_pkt_len(fragment_msg->pkt->next);
-    msg_t msg;
 
 #if defined(DEVELHELP) && defined(ENABLE_DEBUG)
     if (iface == NULL) {
@@ -248,12 +270,7 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
             return;
         }
         fragment_msg->offset += res;
-
-        /* send message to self*/
-        msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-        msg.content.ptr = (void *)fragment_msg;
-        msg_send_to_self(&msg);
-        thread_yield();
+        _continue(fragment_msg);
     }
     else {
         /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
@@ -268,12 +285,7 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
                 return;
                 }
             fragment_msg->offset += res;
-
-            /* send message to self*/
-            msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
-            msg.content.ptr = (void *)fragment_msg;
-            msg_send_to_self(&msg);
-            thread_yield();
+            _continue(fragment_msg);
         }
         else {
             gnrc_pktbuf_release(fragment_msg->pkt);
@@ -12,6 +12,8 @@
  * @file
  */
 
+#include <errno.h>
+
 #include "kernel_types.h"
 #include "net/gnrc.h"
 #include "thread.h"
@@ -22,7 +24,13 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/sixlowpan/netif.h"
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+#include "net/gnrc/netdev2/txq.h"
+#endif
 #include "net/sixlowpan.h"
+#ifdef MODULE_GNRC_EVENT
+#include "net/gnrc/event_thread.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -38,19 +46,30 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static gnrc_sixlowpan_msg_frag_t fragment_msg = {KERNEL_PID_UNDEF, NULL, 0, 0};
 #endif
 
+#ifdef MODULE_GNRC_EVENT
+static gnrc_event_netapi_t _ev;
+static msg_t _ev_queue[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _me_reg;
+#else
 #if ENABLE_DEBUG
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE];
 #endif
+#endif
 
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
+#ifdef MODULE_GNRC_EVENT
+/* Handler for 6LoWPAN on the shared event thread */
+static void _event_handler(uint16_t type, void *ptr);
+#else
 /* Main event loop for 6LoWPAN */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_sixlowpan_init(void)
 {
@@ -58,8 +77,17 @@ kernel_pid_t gnrc_sixlowpan_init(void)
         return _pid;
     }
 
+#ifdef MODULE_GNRC_EVENT
+    _pid = gnrc_event_init();
+    if (_pid > KERNEL_PID_UNDEF) {
+        gnrc_event_netapi_init(&_ev, &_me_reg, GNRC_NETTYPE_SIXLOWPAN,
+                               _event_handler, _ev_queue,
+                               GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
+    }
+#else
     _pid = thread_create(_stack, sizeof(_stack), GNRC_SIXLOWPAN_PRIO,
                          THREAD_CREATE_STACKTEST, _event_loop, NULL, "6lo");
+#endif
 
     return _pid;
 }
@@ -226,6 +254,11 @@ static void _send(gnrc_pktsnip_t *pkt)
         return;
     }
 
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+    /* the transmit queue can not look into the compressed headers */
+    gnrc_netdev2_txq_mark(pkt2);
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
     if (iface->iphc_enabled) {
         if (!gnrc_sixlowpan_iphc_encode(pkt2)) {
@@ -266,7 +299,7 @@ static void _send(gnrc_pktsnip_t *pkt)
               (void *)pkt2, hdr->if_pid);
         if (gnrc_netapi_send(hdr->if_pid, pkt2) < 1) {
             DEBUG("6lo: unable to send %p over %" PRIu16 "\n", (void *)pkt, hdr->if_pid);
-            gnrc_pktbuf_release(pkt2);
+            gnrc_pktbuf_release_error(pkt2, ENOBUFS);
         }
 
         return;
@@ -307,16 +340,37 @@ static void _send(gnrc_pktsnip_t *pkt)
 #endif
 }
 
+#ifdef MODULE_GNRC_EVENT
+static void _event_handler(uint16_t type, void *ptr)
+{
+    switch (type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+            _receive(ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(ptr);
+            break;
+
+        default:
+            DEBUG("6lo: operation not supported\n");
+            break;
+    }
+}
+#else
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+    msg_t msgs[GNRC_NETAPI_MSG_BULK], reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+    int num;
     gnrc_netreg_entry_t me_reg;
 
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
 
-    me_reg.demux_ctx = GNRC_NETREG_DEMUX_CTX_ALL;
-    me_reg.pid = thread_getpid();
+    gnrc_netreg_entry_init_pid(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
 
     /* register interest in all 6LoWPAN packets */
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
@@ -327,39 +381,44 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("6lo: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
+        num = msg_receive_bulk(msgs, GNRC_NETAPI_MSG_BULK);
+
+        for (int i = 0; i < num; i++) {
+            msg_t *msg = &msgs[i];
+
+            switch (msg->type) {
+                case GNRC_NETAPI_MSG_TYPE_RCV:
+                    DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+                    _receive(msg->content.ptr);
+                    break;
+
+                case GNRC_NETAPI_MSG_TYPE_SND:
+                    DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+                    _send(msg->content.ptr);
+                    break;
+
+                case GNRC_NETAPI_MSG_TYPE_GET:
+                case GNRC_NETAPI_MSG_TYPE_SET:
+                    DEBUG("6lo: reply to unsupported get/set\n");
+                    reply.content.value = -ENOTSUP;
+                    msg_reply(msg, &reply);
+                    break;
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-            case GNRC_SIXLOWPAN_MSG_FRAG_SND:
-                DEBUG("6lo: send fragmented event received\n");
-                gnrc_sixlowpan_frag_send(msg.content.ptr);
-                break;
+                case GNRC_SIXLOWPAN_MSG_FRAG_SND:
+                    DEBUG("6lo: send fragmented event received\n");
+                    gnrc_sixlowpan_frag_send(msg->content.ptr);
+                    break;
 #endif
 
-            default:
-                DEBUG("6lo: operation not supported\n");
-                break;
+                default:
+                    DEBUG("6lo: operation not supported\n");
+                    break;
+            }
         }
     }
 
     return NULL;
 }
+#endif
 
 /** @} */
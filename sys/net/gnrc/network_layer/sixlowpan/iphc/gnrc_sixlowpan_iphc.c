@@ -458,25 +458,24 @@ size_t gnrc_sixlowpan_iphc_decode(gnrc_pktsnip_t **dec_hdr, gnrc_pktsnip_t *pkt,
 
         case IPHC_M_DAC_DAM_M_UC_PREFIX:
             do {
-                uint8_t orig_ctx_len = ctx->prefix_len;
+                ipv6_addr_t prefix = IPV6_ADDR_UNSPECIFIED;
+                uint8_t prefix_len = (ctx->prefix_len > 64) ? 64 : ctx->prefix_len;
 
                 ipv6_addr_set_unspecified(&ipv6_hdr->dst);
 
-                if (ctx->prefix_len > 64) {
-                    ctx->prefix_len = 64;
-                }
+                /* the prefix is embedded at byte 4 (RFC 3306, section 4),
+                 * so it is built in place of a whole address first */
+                ipv6_addr_init_prefix(&prefix, &ctx->prefix, prefix_len);
 
                 ipv6_hdr->dst.u8[0] = 0xff;
                 ipv6_hdr->dst.u8[1] = iphc_hdr[payload_offset++];
                 ipv6_hdr->dst.u8[2] = iphc_hdr[payload_offset++];
-                ipv6_hdr->dst.u8[3] = ctx->prefix_len;
-                ipv6_addr_init_prefix((ipv6_addr_t *)ipv6_hdr->dst.u8 + 4,
-                                      &ctx->prefix, ctx->prefix_len);
+                ipv6_hdr->dst.u8[3] = prefix_len;
+                memcpy(ipv6_hdr->dst.u8 + 4, &prefix, sizeof(prefix.u64[0]));
                 memcpy(ipv6_hdr->dst.u8 + 12, iphc_hdr + payload_offset + 2, 4);
 
                 payload_offset += 4;
-                ctx->prefix_len = orig_ctx_len;
-            } while (0);    /* ANSI-C compatible block creation for orig_ctx_len allocation */
+            } while (0);    /* ANSI-C compatible block creation for prefix allocation */
             break;
 
         default:
@@ -591,20 +590,24 @@ bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_hdr_t *netif_hdr = pkt->data;
     ipv6_hdr_t *ipv6_hdr = pkt->next->data;
-    uint8_t *iphc_hdr;
+    /* the compressed header is never longer than the uncompressed one */
+    uint8_t iphc_hdr[sizeof(ipv6_hdr_t)];
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
     bool addr_comp = false, nhc_comp = false;
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    gnrc_pktsnip_t *dispatch = gnrc_pktbuf_add(NULL, NULL, pkt->next->size,
-                                               GNRC_NETTYPE_SIXLOWPAN);
-
-    if (dispatch == NULL) {
-        DEBUG("6lo iphc: error allocating dispatch space\n");
-        return false;
+    gnrc_pktsnip_t *dispatch = NULL;
+
+    /* an unshared IPv6 header is replaced in place, so only allocate if
+     * someone else still uses it */
+    if (pkt->next->users > 1) {
+        dispatch = gnrc_pktbuf_add(NULL, NULL, sizeof(iphc_hdr),
+                                   GNRC_NETTYPE_SIXLOWPAN);
+        if (dispatch == NULL) {
+            DEBUG("6lo iphc: error allocating dispatch space\n");
+            return false;
+        }
     }
 
-    iphc_hdr = dispatch->data;
-
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -879,6 +882,18 @@ bool gnrc_sixlowpan_iphc_encode(gnrc_pktsnip_t *pkt)
         iphc_hdr[inline_pos++] = ipv6_hdr->nh;
     }
 
+    if (dispatch == NULL) {
+        /* IPv6 header was read completely, overwrite it with the dispatch */
+        memcpy(ipv6_hdr, iphc_hdr, inline_pos);
+        if (gnrc_pktbuf_realloc_data(pkt->next, (size_t)inline_pos) != 0) {
+            DEBUG("6lo iphc: error shrinking IPv6 header to dispatch\n");
+            return false;
+        }
+        pkt->next->type = GNRC_NETTYPE_SIXLOWPAN;
+        return true;
+    }
+
+    memcpy(dispatch->data, iphc_hdr, inline_pos);
     /* shrink dispatch allocation to final size */
     /* NOTE: Since this only shrinks the data nothing bad SHOULD happen ;-) */
     gnrc_pktbuf_realloc_data(dispatch, (size_t)inline_pos);
@@ -256,13 +256,15 @@ gnrc_pktsnip_t *gnrc_sixlowpan_nd_opt_6ctx_build(uint8_t prefix_len, uint8_t fla
 
     if (pkt != NULL) {
         sixlowpan_nd_opt_6ctx_t *ctx_opt = pkt->data;
+        /* Bits beyond prefix_len MUST be 0 */
+        ipv6_addr_t ctx_prefix = IPV6_ADDR_UNSPECIFIED;
         ctx_opt->ctx_len = prefix_len;
         ctx_opt->resv_c_cid = flags;
         ctx_opt->resv.u16 = 0;
         ctx_opt->ltime = byteorder_htons(ltime);
-        /* Bits beyond prefix_len MUST be 0 */
-        memset(ctx_opt + 1, 0, pkt->size - sizeof(sixlowpan_nd_opt_6ctx_t));
-        ipv6_addr_init_prefix((ipv6_addr_t *)(ctx_opt + 1), prefix, prefix_len);
+        /* the option may be shorter than a whole address */
+        ipv6_addr_init_prefix(&ctx_prefix, prefix, prefix_len);
+        memcpy(ctx_opt + 1, &ctx_prefix, pkt->size - sizeof(sixlowpan_nd_opt_6ctx_t));
     }
 
     return pkt;
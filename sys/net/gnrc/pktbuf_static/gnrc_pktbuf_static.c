@@ -35,6 +35,9 @@
 #include "debug.h"
 
 #define _ALIGNMENT_MASK    (sizeof(void *) - 1)
+#define _SNIP_SIZE         (_align(sizeof(gnrc_pktsnip_t)))
+/* gnrc_pktsnip_t::headroom of slices, never a valid (aligned) headroom */
+#define _SLICE             (UINT16_MAX)
 
 typedef struct _unused {
     struct _unused *next;
@@ -48,11 +51,18 @@ static _unused_t *_first_unused;
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
+/* usage statistics in allocated bytes, see gnrc_pktbuf_get_usage() */
+static size_t _used = 0;
+static size_t _max_used = 0;
+static uint32_t _alloc_fails = 0;
 #endif
 
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
-                                    gnrc_nettype_t type);
+                                    size_t headroom, gnrc_nettype_t type);
+static gnrc_pktsnip_t *_create_snip_in_headroom(gnrc_pktsnip_t *next, void *data,
+                                                size_t size, gnrc_nettype_t type);
+static void _free_snip(gnrc_pktsnip_t *pkt);
 static void *_pktbuf_alloc(size_t size);
 static void _pktbuf_free(void *data, size_t size);
 
@@ -67,6 +77,23 @@ static inline size_t _align(size_t size)
     return (size + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK);
 }
 
+/* size of a chunk of the given size in the packet buffer */
+static inline size_t _chunk_size(size_t size)
+{
+    return (size < sizeof(_unused_t)) ? _align(sizeof(_unused_t)) : _align(size);
+}
+
+/* slices store the owner of their data behind their gnrc_pktsnip_t */
+static inline bool _is_slice(gnrc_pktsnip_t *pkt)
+{
+    return (pkt->headroom == _SLICE);
+}
+
+static inline gnrc_pktsnip_t **_slice_src(gnrc_pktsnip_t *pkt)
+{
+    return (gnrc_pktsnip_t **)(((uint8_t *)pkt) + _SNIP_SIZE);
+}
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -78,6 +105,7 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+    pkt->headroom = 0;
 }
 
 void gnrc_pktbuf_init(void)
@@ -86,21 +114,69 @@ void gnrc_pktbuf_init(void)
     _first_unused = (_unused_t *)_pktbuf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf);
+#ifdef DEVELHELP
+    _used = 0;
+    _max_used = 0;
+    _alloc_fails = 0;
+#endif
     mutex_unlock(&_mutex);
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
                                 gnrc_nettype_t type)
+{
+    return gnrc_pktbuf_add_headroom(next, data, size, 0, type);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, void *data, size_t size,
+                                         size_t headroom, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *pkt;
 
-    if ((size == 0) || (size > GNRC_PKTBUF_SIZE)) {
-        DEBUG("pktbuf: size (%u) == 0 || size == GNRC_PKTBUF_SIZE (%u)\n",
-              (unsigned)size, GNRC_PKTBUF_SIZE);
+    if ((size == 0) || (size > GNRC_PKTBUF_SIZE) || (headroom > GNRC_PKTBUF_SIZE)) {
+        DEBUG("pktbuf: size (%u) == 0 || size or headroom (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, (unsigned)headroom, GNRC_PKTBUF_SIZE);
         return NULL;
     }
+    if ((headroom == 0) &&
+        ((pkt = _create_snip_in_headroom(next, data, size, type)) != NULL)) {
+        return pkt;
+    }
     mutex_lock(&_mutex);
-    pkt = _create_snip(next, data, size, type);
+    pkt = _create_snip(next, data, size, headroom, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_slice(gnrc_pktsnip_t *next, gnrc_pktsnip_t *src,
+                                      size_t offset, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+    uint8_t *data;
+
+    mutex_lock(&_mutex);
+    if ((src == NULL) || (size == 0) || ((offset + size) > src->size) ||
+        !_pktbuf_contains(src) || !_pktbuf_contains(src->data)) {
+        DEBUG("pktbuf: src == NULL (was %p) or size == 0 (was %u) or "
+              "slice exceeds src\n", (void *)src, (unsigned)size);
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    data = ((uint8_t *)src->data) + offset;
+    if (_is_slice(src)) {
+        /* refer to the owner of the data directly */
+        src = *_slice_src(src);
+    }
+    pkt = _pktbuf_alloc(_SNIP_SIZE + _chunk_size(sizeof(gnrc_pktsnip_t *)));
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(pkt, next, data, size, type);
+    pkt->headroom = _SLICE;
+    *_slice_src(pkt) = src;
+    src->users++;
     mutex_unlock(&_mutex);
     return pkt;
 }
@@ -122,7 +198,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&_mutex);
         return NULL;
     }
-    else if (size == pkt->size) {
+    /* received data is not shared */
+    assert(!_is_slice(pkt));
+    if (size == pkt->size) {
         pkt->type = type;
         mutex_unlock(&_mutex);
         return pkt;
@@ -175,6 +253,7 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 
     mutex_lock(&_mutex);
     assert((pkt != NULL) && (pkt->data != NULL) && _pktbuf_contains(pkt->data));
+    assert(!_is_slice(pkt));
     if (size == 0) {
         DEBUG("pktbuf: size == 0\n");
         mutex_unlock(&_mutex);
@@ -225,8 +304,7 @@ static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
         tmp = pkt->next;
         if (pkt->users == 1) {
             pkt->users = 0; /* not necessary but to be on the safe side */
-            _pktbuf_free(pkt->data, pkt->size);
-            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            _free_snip(pkt);
         }
         else {
             pkt->users--;
@@ -251,11 +329,18 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
         mutex_unlock(&_mutex);
         return NULL;
     }
-    if (pkt->users > 1) {
+    if ((pkt->users > 1) || _is_slice(pkt)) {
         gnrc_pktsnip_t *new;
-        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        new = _create_snip(pkt->next, pkt->data, pkt->size, 0, pkt->type);
         if (new != NULL) {
-            pkt->users--;
+            if (pkt->users > 1) {
+                pkt->users--;
+            }
+            else {
+                /* data of the slice was copied, it is not needed anymore */
+                pkt->users = 0;
+                _free_snip(pkt);
+            }
         }
         mutex_unlock(&_mutex);
         return new;
@@ -322,6 +407,8 @@ void gnrc_pktbuf_stats(void)
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
            (void *)&_pktbuf[0], (void *)&_pktbuf[GNRC_PKTBUF_SIZE], GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    printf("  bytes used: %u (max: %u), failed allocations: %" PRIu32 "\n",
+           (unsigned)_used, (unsigned)_max_used, _alloc_fails);
     if (ptr == NULL) {  /* packet buffer is completely full */
         _print_chunk(chunk, GNRC_PKTBUF_SIZE, count++);
     }
@@ -352,6 +439,19 @@ void gnrc_pktbuf_stats(void)
     DEBUG("pktbuf: needs od module\n");
 #endif
 }
+
+void gnrc_pktbuf_get_usage(gnrc_pktbuf_usage_t *usage, bool reset)
+{
+    mutex_lock(&_mutex);
+    usage->used = _used;
+    usage->max_used = _max_used;
+    usage->alloc_fails = _alloc_fails;
+    if (reset) {
+        _max_used = _used;
+        _alloc_fails = 0;
+    }
+    mutex_unlock(&_mutex);
+}
 #endif
 
 #ifdef TEST_SUITES
@@ -393,29 +493,90 @@ bool gnrc_pktbuf_is_sane(void)
 }
 #endif
 
+/*
+ * A snip is allocated as one chunk: [headroom][gnrc_pktsnip_t][data]. Snip
+ * and data are freed separately if the data was moved since.
+ */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
-                                    gnrc_nettype_t type)
+                                    size_t headroom, gnrc_nettype_t type)
 {
-    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
-    void *_data;
+    uint8_t *chunk;
+    gnrc_pktsnip_t *pkt;
 
-    if (pkt == NULL) {
+    if (headroom > 0) {
+        headroom = _chunk_size(headroom);
+        if (headroom > UINT16_MAX) {
+            return NULL;
+        }
+    }
+    chunk = _pktbuf_alloc(headroom + _SNIP_SIZE + _chunk_size(size));
+    if (chunk == NULL) {
         DEBUG("pktbuf: error allocating new packet snip\n");
         return NULL;
     }
-    _data = _pktbuf_alloc(size);
-    if (_data == NULL) {
-        DEBUG("pktbuf: error allocating data for new packet snip\n");
-        _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+    pkt = (gnrc_pktsnip_t *)(chunk + headroom);
+    _set_pktsnip(pkt, next, ((uint8_t *)pkt) + _SNIP_SIZE, size, type);
+    pkt->headroom = (uint16_t)headroom;
+    if (data != NULL) {
+        memcpy(pkt->data, data, size);
+    }
+    return pkt;
+}
+
+/* takes the end of next's headroom; next is not shared, so no lock needed */
+static gnrc_pktsnip_t *_create_snip_in_headroom(gnrc_pktsnip_t *next, void *data,
+                                                size_t size, gnrc_nettype_t type)
+{
+    size_t required = _SNIP_SIZE + _chunk_size(size);
+    size_t remaining;
+    gnrc_pktsnip_t *pkt;
+
+    if ((next == NULL) || !_pktbuf_contains(next) || (next->users != 1) ||
+        _is_slice(next) || (next->headroom < required)) {
+        return NULL;
+    }
+    remaining = next->headroom - required;
+    if ((remaining > 0) && (remaining < sizeof(_unused_t))) {
+        /* rest could not be freed on its own */
         return NULL;
     }
-    _set_pktsnip(pkt, next, _data, size, type);
+    pkt = (gnrc_pktsnip_t *)(((uint8_t *)next) - required);
+    _set_pktsnip(pkt, next, ((uint8_t *)pkt) + _SNIP_SIZE, size, type);
+    pkt->headroom = (uint16_t)remaining;
+    next->headroom = 0;
     if (data != NULL) {
-        memcpy(_data, data, size);
+        memcpy(pkt->data, data, size);
     }
     return pkt;
 }
 
+static void _free_snip(gnrc_pktsnip_t *pkt)
+{
+    uint8_t *start = ((uint8_t *)pkt) - pkt->headroom;
+
+    if (_is_slice(pkt)) {
+        gnrc_pktsnip_t *src = *_slice_src(pkt);
+
+        _pktbuf_free(pkt, _SNIP_SIZE + _chunk_size(sizeof(gnrc_pktsnip_t *)));
+        /* only src was held by the slice, not the snips following it */
+        if (src->users == 1) {
+            src->users = 0;
+            _free_snip(src);
+        }
+        else {
+            src->users--;
+        }
+        return;
+    }
+    if (pkt->data == (((uint8_t *)pkt) + _SNIP_SIZE)) {
+        _pktbuf_free(start, pkt->headroom + _SNIP_SIZE + _chunk_size(pkt->size));
+    }
+    else {
+        _pktbuf_free(pkt->data, pkt->size);
+        _pktbuf_free(start, pkt->headroom + _SNIP_SIZE);
+    }
+}
+
 static void *_pktbuf_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
@@ -427,6 +588,9 @@ static void *_pktbuf_alloc(size_t size)
     }
     if (ptr == NULL) {
         DEBUG("pktbuf: no space left in packet buffer\n");
+#ifdef DEVELHELP
+        _alloc_fails++;
+#endif
         return NULL;
     }
     if (sizeof(_unused_t) > (ptr->size - size)) {
@@ -453,6 +617,10 @@ static void *_pktbuf_alloc(size_t size)
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
     }
+    _used += size;
+    if (_used > _max_used) {
+        _max_used = _used;
+    }
 #endif
     return (void *)ptr;
 }
@@ -484,6 +652,9 @@ static void _pktbuf_free(void *data, size_t size)
     }
     new->next = ptr;
     new->size = (size < sizeof(_unused_t)) ? _align(sizeof(_unused_t)) : _align(size);
+#ifdef DEVELHELP
+    _used -= new->size;
+#endif
     if (prev == NULL) { /* ptr was _first_unused or data before _first_unused */
         _first_unused = new;
     }
@@ -543,7 +714,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t t
     gnrc_pktsnip_t *tmp;
     gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
     gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
-    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, 0, type);
 
     if (new == NULL) {
         mutex_unlock(&_mutex);
@@ -32,9 +32,11 @@
 static char _stack[GNRC_RPL_STACK_SIZE];
 kernel_pid_t gnrc_rpl_pid = KERNEL_PID_UNDEF;
 const ipv6_addr_t ipv6_addr_all_rpl_nodes = GNRC_RPL_ALL_NODES_ADDR;
+#ifdef MODULE_GNRC_RPL_P2P
 static uint32_t _lt_time = GNRC_RPL_LIFETIME_UPDATE_STEP * SEC_IN_USEC;
 static xtimer_t _lt_timer;
 static msg_t _lt_msg = { .type = GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE };
+#endif
 static msg_t _msg_q[GNRC_RPL_MSG_QUEUE_SIZE];
 static gnrc_netreg_entry_t _me_reg;
 static mutex_t _inst_id_mutex = MUTEX_INIT;
@@ -43,7 +45,9 @@ static uint8_t _instance_id;
 gnrc_rpl_instance_t gnrc_rpl_instances[GNRC_RPL_INSTANCES_NUMOF];
 gnrc_rpl_parent_t gnrc_rpl_parents[GNRC_RPL_PARENTS_NUMOF];
 
+#ifdef MODULE_GNRC_RPL_P2P
 static void _update_lifetime(void);
+#endif
 static void _dao_handle_send(gnrc_rpl_dodag_t *dodag);
 static void _receive(gnrc_pktsnip_t *pkt);
 static void *_event_loop(void *args);
@@ -69,7 +73,9 @@ kernel_pid_t gnrc_rpl_init(kernel_pid_t if_pid)
         gnrc_netreg_register(GNRC_NETTYPE_ICMPV6, &_me_reg);
 
         gnrc_rpl_of_manager_init();
+#ifdef MODULE_GNRC_RPL_P2P
         xtimer_set_msg(&_lt_timer, _lt_time, &_lt_msg, gnrc_rpl_pid);
+#endif
     }
 
     /* register all_RPL_nodes multicast address */
@@ -204,10 +210,24 @@ static void *_event_loop(void *args)
         msg_receive(&msg);
 
         switch (msg.type) {
+#ifdef MODULE_GNRC_RPL_P2P
             case GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE:
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_LIFETIME_UPDATE received\n");
                 _update_lifetime();
                 break;
+#endif
+            case GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT:
+                DEBUG("RPL: GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT received\n");
+                gnrc_rpl_parent_timeout(msg.content.ptr);
+                break;
+            case GNRC_RPL_MSG_TYPE_DAO_HANDLE:
+                DEBUG("RPL: GNRC_RPL_MSG_TYPE_DAO_HANDLE received\n");
+                _dao_handle_send(msg.content.ptr);
+                break;
+            case GNRC_RPL_MSG_TYPE_INSTANCE_CLEANUP:
+                DEBUG("RPL: GNRC_RPL_MSG_TYPE_INSTANCE_CLEANUP received\n");
+                gnrc_rpl_instance_cleanup(msg.content.ptr);
+                break;
             case GNRC_RPL_MSG_TYPE_TRICKLE_INTERVAL:
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_TRICKLE_INTERVAL received\n");
                 trickle = msg.content.ptr;
@@ -242,83 +262,71 @@ static void *_event_loop(void *args)
     return NULL;
 }
 
+#ifdef MODULE_GNRC_RPL_P2P
 void _update_lifetime(void)
 {
-    uint32_t now = xtimer_now();
-    uint16_t now_sec = now / SEC_IN_USEC;
-
-    gnrc_rpl_parent_t *parent;
-    gnrc_rpl_instance_t *inst;
-
-    for (uint8_t i = 0; i < GNRC_RPL_PARENTS_NUMOF; ++i) {
-        parent = &gnrc_rpl_parents[i];
-        if (parent->state != 0) {
-            if ((int32_t)(parent->lifetime - now_sec) <= GNRC_RPL_LIFETIME_UPDATE_STEP) {
-                gnrc_rpl_dodag_t *dodag = parent->dodag;
-                gnrc_rpl_parent_remove(parent);
-                gnrc_rpl_parent_update(dodag, NULL);
-                continue;
-            }
-            else if ((int32_t)(parent->lifetime - now_sec) <= (GNRC_RPL_LIFETIME_UPDATE_STEP * 2)) {
-                gnrc_rpl_send_DIS(parent->dodag->instance, &parent->addr);
-            }
-        }
-    }
-
-    for (int i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
-        inst = &gnrc_rpl_instances[i];
-        if (inst->state != 0) {
-            if ((inst->cleanup > 0) && (inst->dodag.parents == NULL) &&
-                (inst->dodag.my_rank == GNRC_RPL_INFINITE_RANK)) {
-                inst->cleanup -= GNRC_RPL_LIFETIME_UPDATE_STEP;
-                if (inst->cleanup <= 0) {
-                    /* no parents - delete this instance and DODAG */
-                    gnrc_rpl_instance_remove(inst);
-                    continue;
-                }
-            }
-
-            if (inst->dodag.dao_time > GNRC_RPL_LIFETIME_UPDATE_STEP) {
-                inst->dodag.dao_time -= GNRC_RPL_LIFETIME_UPDATE_STEP;
-            }
-            else {
-                _dao_handle_send(&inst->dodag);
-            }
-        }
-    }
-
-#ifdef MODULE_GNRC_RPL_P2P
     gnrc_rpl_p2p_update();
-#endif
 
     xtimer_set_msg(&_lt_timer, _lt_time, &_lt_msg, gnrc_rpl_pid);
 }
+#endif
+
+static void _dao_schedule(gnrc_rpl_dodag_t *dodag, uint32_t delay)
+{
+    dodag->dao_msg.type = GNRC_RPL_MSG_TYPE_DAO_HANDLE;
+    dodag->dao_msg.content.ptr = dodag;
+    xtimer_set_msg(&dodag->dao_timer, delay * SEC_IN_USEC, &dodag->dao_msg, gnrc_rpl_pid);
+}
 
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
-    dodag->dao_time = GNRC_RPL_DEFAULT_DAO_DELAY;
+    _dao_schedule(dodag, GNRC_RPL_DEFAULT_DAO_DELAY);
+    dodag->dao_pending = true;
     dodag->dao_counter = 0;
     dodag->dao_ack_received = false;
 }
 
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
-    dodag->dao_time = GNRC_RPL_REGULAR_DAO_INTERVAL;
+    _dao_schedule(dodag, GNRC_RPL_REGULAR_DAO_INTERVAL);
+    dodag->dao_pending = false;
     dodag->dao_counter = 0;
     dodag->dao_ack_received = false;
 }
 
+void gnrc_rpl_aggregate_dao(gnrc_rpl_dodag_t *dodag)
+{
+    /* a root does not send DAOs */
+    if (dodag->node_status == GNRC_RPL_ROOT_NODE) {
+        return;
+    }
+
+    /* do not postpone a pending DAO, it will carry the new targets as well.
+     * Waiting for a DAO-ACK or the regular refresh does not count: the DAO
+     * sent before did not contain the new targets */
+    if (dodag->dao_pending) {
+        return;
+    }
+
+    gnrc_rpl_delay_dao(dodag);
+}
+
 void _dao_handle_send(gnrc_rpl_dodag_t *dodag)
 {
+    /* the instance was removed in the meantime */
+    if (dodag->instance == NULL) {
+        return;
+    }
 #ifdef MODULE_GNRC_RPL_P2P
     if (dodag->instance->mop == GNRC_RPL_P2P_MOP) {
         return;
     }
 #endif
+    dodag->dao_pending = false;
     if ((dodag->dao_ack_received == false) && (dodag->dao_counter < GNRC_RPL_DAO_SEND_RETRIES)) {
         dodag->dao_counter++;
         gnrc_rpl_send_DAO(dodag->instance, NULL, dodag->default_lifetime);
-        dodag->dao_time = GNRC_RPL_DEFAULT_WAIT_FOR_DAO_ACK;
+        _dao_schedule(dodag, GNRC_RPL_DEFAULT_WAIT_FOR_DAO_ACK);
     }
     else if (dodag->dao_ack_received == false) {
         gnrc_rpl_long_delay_dao(dodag);
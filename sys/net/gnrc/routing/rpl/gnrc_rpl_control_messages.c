@@ -289,12 +289,48 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
     }
 }
 
+/**
+ * @brief   Add (or remove, for a no-path DAO) the routes to @p targets_numof
+ *          consecutive target options via @p src to the FIB.
+ */
+static void _dao_targets_to_fib(gnrc_rpl_dodag_t *dodag, gnrc_rpl_opt_target_t *target,
+                                unsigned targets_numof, ipv6_addr_t *src,
+                                uint32_t next_hop_flags, uint32_t lifetime)
+{
+    for (unsigned i = 0; i < targets_numof; i++) {
+        uint32_t fib_dst_flags = 0;
+
+        if (target->prefix_length < IPV6_ADDR_BIT_LEN) {
+            fib_dst_flags = ((uint32_t)(target->prefix_length) << FIB_FLAG_NET_PREFIX_SHIFT);
+        }
+
+        if (lifetime == 0) {
+            DEBUG("RPL: removing fib entry %s/%d\n",
+                  ipv6_addr_to_str(addr_str, &(target->target), sizeof(addr_str)),
+                  target->prefix_length);
+            fib_remove_entry(&gnrc_ipv6_fib_table, target->target.u8, sizeof(ipv6_addr_t));
+        }
+        else {
+            DEBUG("RPL: adding fib entry %s/%d 0x%" PRIx32 "\n",
+                  ipv6_addr_to_str(addr_str, &(target->target), sizeof(addr_str)),
+                  target->prefix_length, fib_dst_flags);
+            fib_add_entry(&gnrc_ipv6_fib_table, dodag->iface, target->target.u8,
+                          sizeof(ipv6_addr_t), fib_dst_flags, src->u8,
+                          sizeof(ipv6_addr_t), next_hop_flags, lifetime);
+        }
+
+        target = (gnrc_rpl_opt_target_t *) (((uint8_t *) target) + sizeof(gnrc_rpl_opt_t) +
+                                            target->length);
+    }
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt, uint16_t len,
                     ipv6_addr_t *src, uint32_t *included_opts)
 {
     uint16_t l = 0;
     gnrc_rpl_opt_target_t *first_target = NULL;
+    unsigned targets_numof = 0;
     gnrc_rpl_dodag_t *dodag = &inst->dodag;
     eui64_t iid;
     *included_opts = 0;
@@ -371,27 +407,12 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                 DEBUG("RPL: RPL TARGET DAO option parsed\n");
                 *included_opts |= ((uint32_t) 1) << GNRC_RPL_OPT_TARGET;
 
-                gnrc_rpl_opt_target_t *target = (gnrc_rpl_opt_target_t *) opt;
+                /* targets are added to the FIB together with the following transit */
                 if (first_target == NULL) {
-                    first_target = target;
+                    first_target = (gnrc_rpl_opt_target_t *) opt;
+                    targets_numof = 0;
                 }
-
-                uint32_t fib_dst_flags = 0;
-
-                if (target->prefix_length < IPV6_ADDR_BIT_LEN) {
-                    fib_dst_flags = ((uint32_t)(target->prefix_length) << FIB_FLAG_NET_PREFIX_SHIFT);
-                }
-
-                DEBUG("RPL: adding fib entry %s/%d 0x%" PRIx32 "\n",
-                      ipv6_addr_to_str(addr_str, &(target->target), sizeof(addr_str)),
-                      target->prefix_length,
-                      fib_dst_flags);
-
-                fib_add_entry(&gnrc_ipv6_fib_table, dodag->iface, target->target.u8,
-                              sizeof(ipv6_addr_t), fib_dst_flags, src->u8,
-                              sizeof(ipv6_addr_t), FIB_FLAG_RPL_ROUTE,
-                              (dodag->default_lifetime * dodag->lifetime_unit) *
-                              SEC_IN_MS);
+                targets_numof++;
                 break;
 
             case (GNRC_RPL_OPT_TRANSIT):
@@ -404,23 +425,10 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                     break;
                 }
 
-                do {
-                    DEBUG("RPL: updating fib entry %s/%d\n",
-                          ipv6_addr_to_str(addr_str, &(first_target->target), sizeof(addr_str)),
-                          first_target->prefix_length);
-
-                    fib_update_entry(&gnrc_ipv6_fib_table,
-                                     first_target->target.u8,
-                                     sizeof(ipv6_addr_t), src->u8,
-                                     sizeof(ipv6_addr_t),
-                                     ((transit->e_flags & GNRC_RPL_OPT_TRANSIT_E_FLAG) ?
-                                      0x0 : FIB_FLAG_RPL_ROUTE),
-                                     (transit->path_lifetime *
-                                      dodag->lifetime_unit * SEC_IN_MS));
-                    first_target = (gnrc_rpl_opt_target_t *) (((uint8_t *) (first_target)) +
-                                   sizeof(gnrc_rpl_opt_t) + first_target->length);
-                }
-                while (first_target->type == GNRC_RPL_OPT_TARGET);
+                _dao_targets_to_fib(dodag, first_target, targets_numof, src,
+                                    ((transit->e_flags & GNRC_RPL_OPT_TRANSIT_E_FLAG) ?
+                                     0x0 : FIB_FLAG_RPL_ROUTE),
+                                    (transit->path_lifetime * dodag->lifetime_unit * SEC_IN_MS));
 
                 first_target = NULL;
                 break;
@@ -434,6 +442,12 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
         l += opt->length + sizeof(gnrc_rpl_opt_t);
         opt = (gnrc_rpl_opt_t *) (((uint8_t *) (opt + 1)) + opt->length);
     }
+
+    /* targets without a transit information get the default lifetime */
+    if (first_target != NULL) {
+        _dao_targets_to_fib(dodag, first_target, targets_numof, src, FIB_FLAG_RPL_ROUTE,
+                            (dodag->default_lifetime * dodag->lifetime_unit) * SEC_IN_MS);
+    }
     return true;
 }
 
@@ -634,22 +648,59 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
     }
 }
 
-gnrc_pktsnip_t *_dao_target_build(gnrc_pktsnip_t *pkt, ipv6_addr_t *addr, uint8_t prefix_length)
+static inline bool _dao_fib_entry_is_target(fib_entry_t *fentry, bool external)
+{
+    return (fentry->lifetime != 0) &&
+           (!(fentry->next_hop_flags & FIB_FLAG_RPL_ROUTE) == external) &&
+           ipv6_addr_is_global((ipv6_addr_t *) fentry->global->address);
+}
+
+static void _dao_target_fill(gnrc_rpl_opt_target_t *target, ipv6_addr_t *addr,
+                             uint8_t prefix_length)
+{
+    DEBUG("RPL: Send DAO - building target %s/%d\n",
+          ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), (int) prefix_length);
+    target->type = GNRC_RPL_OPT_TARGET;
+    target->length = sizeof(target->flags) + sizeof(target->prefix_length) + sizeof(target->target);
+    target->flags = 0;
+    target->prefix_length = prefix_length;
+    target->target = *addr;
+}
+
+/**
+ * @brief   Builds the target options of all (@p external or internal) FIB
+ *          entries and, if given, of @p me in one snip.
+ *
+ * @pre     gnrc_ipv6_fib_table.mtx_access is locked
+ */
+static gnrc_pktsnip_t *_dao_targets_build(gnrc_pktsnip_t *pkt, ipv6_addr_t *me, bool external,
+                                          size_t targets_numof)
 {
     gnrc_rpl_opt_target_t *target;
     gnrc_pktsnip_t *opt_snip;
-    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_opt_target_t),
-                               GNRC_NETTYPE_UNDEF)) == NULL) {
+
+    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, targets_numof * sizeof(gnrc_rpl_opt_target_t),
+                                    GNRC_NETTYPE_UNDEF)) == NULL) {
         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
         gnrc_pktbuf_release(pkt);
         return NULL;
     }
     target = opt_snip->data;
-    target->type = GNRC_RPL_OPT_TARGET;
-    target->length = sizeof(target->flags) + sizeof(target->prefix_length) + sizeof(target->target);
-    target->flags = 0;
-    target->prefix_length = prefix_length;
-    target->target = *addr;
+
+    if (me != NULL) {
+        _dao_target_fill(target++, me, IPV6_ADDR_BIT_LEN);
+        targets_numof--;
+    }
+
+    for (size_t i = 0; (i < gnrc_ipv6_fib_table.size) && (targets_numof > 0); ++i) {
+        fib_entry_t *fentry = &gnrc_ipv6_fib_table.data.entries[i];
+        if (_dao_fib_entry_is_target(fentry, external)) {
+            _dao_target_fill(target++, (ipv6_addr_t *) fentry->global->address,
+                             (uint8_t) (fentry->global_flags >> FIB_FLAG_NET_PREFIX_SHIFT));
+            targets_numof--;
+        }
+    }
+
     return opt_snip;
 }
 
@@ -704,9 +755,9 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         destination = &(dodag->parents->addr);
     }
 
-    gnrc_pktsnip_t *pkt = NULL, **ptr = NULL,  *tmp = NULL, *tr_int = NULL;
+    gnrc_pktsnip_t *pkt = NULL, *tmp = NULL;
     gnrc_rpl_dao_t *dao;
-    bool ext_processed = false, int_processed = false;
+    size_t int_numof = 1, ext_numof = 0;
 
     /* find my address */
     ipv6_addr_t *me = NULL;
@@ -718,69 +769,39 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
 
     mutex_lock(&(gnrc_ipv6_fib_table.mtx_access));
 
-    /* add external and RPL FIB entries */
+    /* count external and RPL FIB entries, so that all targets of a transit
+     * can be built with a single allocation */
     for (size_t i = 0; i < gnrc_ipv6_fib_table.size; ++i) {
-        ipv6_addr_t *addr;
         fib_entry_t *fentry = &gnrc_ipv6_fib_table.data.entries[i];
-        if (fentry->lifetime != 0) {
-            if (!(fentry->next_hop_flags & FIB_FLAG_RPL_ROUTE)) {
-                ptr = &tmp;
-                if (!ext_processed) {
-                    DEBUG("RPL: Send DAO - building external transit\n");
-                    if ((tmp = _dao_transit_build(NULL, lifetime, true)) == NULL) {
-                        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-                        mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
-                        return;
-                    }
-                    ext_processed = true;
-                }
-            }
-            else {
-                ptr = &pkt;
-                if (!int_processed) {
-                    DEBUG("RPL: Send DAO - building internal transit\n");
-                    if ((tr_int = pkt = _dao_transit_build(NULL, lifetime, false)) == NULL) {
-                        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-                        mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
-                        return;
-                    }
-                    int_processed = true;
-                }
-            }
-            addr = (ipv6_addr_t *) fentry->global->address;
-            if (ipv6_addr_is_global(addr)) {
-                size_t prefix_length = (fentry->global_flags >> FIB_FLAG_NET_PREFIX_SHIFT);
-
-                DEBUG("RPL: Send DAO - building target %s/%d\n",
-                      ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)),
-                      (int) prefix_length);
-
-                if ((*ptr = _dao_target_build(*ptr, addr, (uint8_t) prefix_length)) == NULL) {
-                    DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-                    mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
-                    return;
-                }
-            }
+        if (_dao_fib_entry_is_target(fentry, true)) {
+            ext_numof++;
+        }
+        else if (_dao_fib_entry_is_target(fentry, false)) {
+            int_numof++;
         }
     }
 
-    mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
-
-    if (tr_int) {
-        tr_int->next = tmp;
-    }
-    else {
-        pkt = tmp;
+    if (ext_numof > 0) {
+        DEBUG("RPL: Send DAO - building external transit\n");
+        if (((pkt = _dao_transit_build(NULL, lifetime, true)) == NULL) ||
+            ((pkt = _dao_targets_build(pkt, NULL, true, ext_numof)) == NULL)) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
+            return;
+        }
     }
 
-    /* add own address */
-    DEBUG("RPL: Send DAO - building target %s/128\n",
-          ipv6_addr_to_str(addr_str, me, sizeof(addr_str)));
-    if ((pkt = _dao_target_build(pkt, me, IPV6_ADDR_BIT_LEN)) == NULL) {
+    /* add internal transit and own address */
+    DEBUG("RPL: Send DAO - building internal transit\n");
+    if (((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) ||
+        ((pkt = _dao_targets_build(pkt, me, false, int_numof)) == NULL)) {
         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
         return;
     }
 
+    mutex_unlock(&(gnrc_ipv6_fib_table.mtx_access));
+
     bool local_instance = (inst->id & GNRC_RPL_INSTANCE_ID_MSB) ? true : false;
 
     if (local_instance) {
@@ -929,7 +950,7 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
         gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
     }
 
-    gnrc_rpl_delay_dao(dodag);
+    gnrc_rpl_aggregate_dao(dodag);
 }
 
 void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, uint16_t len)
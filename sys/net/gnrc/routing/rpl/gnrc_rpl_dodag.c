@@ -116,10 +116,37 @@ bool gnrc_rpl_instance_remove(gnrc_rpl_instance_t *inst)
 #endif
     gnrc_rpl_dodag_remove_all_parents(dodag);
     trickle_stop(&dodag->trickle);
+    xtimer_remove(&dodag->dao_timer);
+    xtimer_remove(&inst->cleanup_timer);
     memset(inst, 0, sizeof(gnrc_rpl_instance_t));
     return true;
 }
 
+void gnrc_rpl_instance_cleanup_start(gnrc_rpl_instance_t *inst)
+{
+    /* restart a pending cleanup instead of adding a second timeout */
+    xtimer_remove(&inst->cleanup_timer);
+    inst->cleanup = GNRC_RPL_CLEANUP_TIME;
+    inst->cleanup_msg.type = GNRC_RPL_MSG_TYPE_INSTANCE_CLEANUP;
+    inst->cleanup_msg.content.ptr = inst;
+    xtimer_set_msg(&inst->cleanup_timer, GNRC_RPL_CLEANUP_TIME * SEC_IN_USEC,
+                   &inst->cleanup_msg, gnrc_rpl_pid);
+}
+
+void gnrc_rpl_instance_cleanup(gnrc_rpl_instance_t *inst)
+{
+    /* the instance was removed or rejoined a DODAG in the meantime */
+    if ((inst->state == 0) || (inst->cleanup == 0)) {
+        return;
+    }
+
+    inst->cleanup = 0;
+    if ((inst->dodag.parents == NULL) && (inst->dodag.my_rank == GNRC_RPL_INFINITE_RANK)) {
+        /* no parents - delete this instance and DODAG */
+        gnrc_rpl_instance_remove(inst);
+    }
+}
+
 gnrc_rpl_instance_t *gnrc_rpl_instance_get(uint8_t instance_id)
 {
     for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
@@ -238,10 +265,50 @@ bool gnrc_rpl_parent_remove(gnrc_rpl_parent_t *parent)
         }
     }
     LL_DELETE(dodag->parents, parent);
+    xtimer_remove(&parent->timer);
     memset(parent, 0, sizeof(gnrc_rpl_parent_t));
     return true;
 }
 
+static void _parent_timer_set(gnrc_rpl_parent_t *parent, uint32_t now_sec)
+{
+    int32_t remaining = parent->lifetime - now_sec;
+    uint32_t offset = 0;
+
+    /* fire once before the lifetime expires to probe the parent with a DIS */
+    if (remaining > GNRC_RPL_PARENT_PROBE_TIME) {
+        offset = remaining - GNRC_RPL_PARENT_PROBE_TIME;
+    }
+    else if (remaining > GNRC_RPL_LIFETIME_UPDATE_STEP) {
+        offset = remaining - GNRC_RPL_LIFETIME_UPDATE_STEP;
+    }
+
+    parent->timeout_msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
+    parent->timeout_msg.content.ptr = parent;
+    xtimer_set_msg64(&parent->timer, ((uint64_t) offset) * SEC_IN_USEC,
+                     &parent->timeout_msg, gnrc_rpl_pid);
+}
+
+void gnrc_rpl_parent_timeout(gnrc_rpl_parent_t *parent)
+{
+    uint32_t now_sec = xtimer_now() / SEC_IN_USEC;
+
+    /* the parent was removed in the meantime */
+    if (parent->state == 0) {
+        return;
+    }
+
+    if ((int32_t)(parent->lifetime - now_sec) <= GNRC_RPL_LIFETIME_UPDATE_STEP) {
+        gnrc_rpl_dodag_t *dodag = parent->dodag;
+        gnrc_rpl_parent_remove(parent);
+        gnrc_rpl_parent_update(dodag, NULL);
+        return;
+    }
+
+    gnrc_rpl_send_DIS(parent->dodag->instance, &parent->addr);
+    _parent_timer_set(parent, now_sec);
+}
+
 void gnrc_rpl_local_repair(gnrc_rpl_dodag_t *dodag)
 {
     DEBUG("RPL: [INFO] Local Repair started\n");
@@ -258,37 +325,54 @@ void gnrc_rpl_local_repair(gnrc_rpl_dodag_t *dodag)
     if (dodag->my_rank != GNRC_RPL_INFINITE_RANK) {
         dodag->my_rank = GNRC_RPL_INFINITE_RANK;
         trickle_reset_timer(&dodag->trickle);
-        dodag->instance->cleanup = GNRC_RPL_CLEANUP_TIME;
+        gnrc_rpl_instance_cleanup_start(dodag->instance);
     }
 }
 
+/* sets the default route to the preferred parent */
+static void _default_route_set(gnrc_rpl_dodag_t *dodag)
+{
+#ifdef MODULE_GNRC_RPL_P2P
+    if (dodag->instance->mop == GNRC_RPL_P2P_MOP) {
+        return;
+    }
+#endif
+    fib_add_entry(&gnrc_ipv6_fib_table,
+                  dodag->iface,
+                  (uint8_t *) ipv6_addr_unspecified.u8,
+                  sizeof(ipv6_addr_t),
+                  0x00,
+                  dodag->parents->addr.u8,
+                  sizeof(ipv6_addr_t),
+                  FIB_FLAG_RPL_ROUTE,
+                  (dodag->default_lifetime * dodag->lifetime_unit) * SEC_IN_MS);
+}
+
 void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 {
+    gnrc_rpl_parent_t *old_pref = dodag->parents;
+
     /* update Parent lifetime */
     if (parent != NULL) {
-        uint32_t now = xtimer_now();
-        parent->lifetime = (now / SEC_IN_USEC) + (dodag->default_lifetime * dodag->lifetime_unit);
-#ifdef MODULE_GNRC_RPL_P2P
-        if (dodag->instance->mop != GNRC_RPL_P2P_MOP) {
-#endif
-        if (parent == dodag->parents) {
-            fib_add_entry(&gnrc_ipv6_fib_table,
-                          dodag->iface,
-                          (uint8_t *) ipv6_addr_unspecified.u8,
-                          sizeof(ipv6_addr_t),
-                          0x00,
-                          parent->addr.u8,
-                          sizeof(ipv6_addr_t),
-                          FIB_FLAG_RPL_ROUTE,
-                          (dodag->default_lifetime * dodag->lifetime_unit) * SEC_IN_MS);
-        }
-#ifdef MODULE_GNRC_RPL_P2P
-        }
-#endif
+        uint32_t now_sec = xtimer_now() / SEC_IN_USEC;
+        parent->lifetime = now_sec + (dodag->default_lifetime * dodag->lifetime_unit);
+        _parent_timer_set(parent, now_sec);
     }
 
     if (_gnrc_rpl_find_preferred_parent(dodag) == NULL) {
         gnrc_rpl_local_repair(dodag);
+        return;
+    }
+
+    /* (re)joined the DODAG, a pending cleanup must not remove it */
+    if (dodag->instance->cleanup != 0) {
+        xtimer_remove(&dodag->instance->cleanup_timer);
+        dodag->instance->cleanup = 0;
+    }
+
+    /* one FIB update for a new preferred parent or a refreshed lifetime */
+    if ((dodag->parents != old_pref) || (parent == dodag->parents)) {
+        _default_route_set(dodag);
     }
 }
 
@@ -328,23 +412,6 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
             gnrc_rpl_send_DAO(dodag->instance, &old_best->addr, 0);
             gnrc_rpl_delay_dao(dodag);
         }
-
-#ifdef MODULE_GNRC_RPL_P2P
-    if (dodag->instance->mop != GNRC_RPL_P2P_MOP) {
-#endif
-        fib_add_entry(&gnrc_ipv6_fib_table,
-                      dodag->iface,
-                      (uint8_t *) ipv6_addr_unspecified.u8,
-                      sizeof(ipv6_addr_t),
-                      0x00,
-                      dodag->parents->addr.u8,
-                      sizeof(ipv6_addr_t),
-                      FIB_FLAG_RPL_ROUTE,
-                      (dodag->default_lifetime * dodag->lifetime_unit) * SEC_IN_MS);
-#ifdef MODULE_GNRC_RPL_P2P
-    }
-#endif
-
     }
 
     dodag->my_rank = dodag->instance->of->calc_rank(dodag->parents, 0);
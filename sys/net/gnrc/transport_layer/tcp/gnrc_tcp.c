@@ -0,0 +1,1846 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ * @{
+ *
+ * @file
+ * @brief       TCP implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "assert.h"
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "msg.h"
+#include "random.h"
+#include "thread.h"
+#include "utlist.h"
+#include "xtimer.h"
+#include "net/ipv6/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/tcp.h"
+#include "net/inet_csum.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @name    Messages to the TCP thread
+ * @{
+ */
+#define MSG_TYPE_TICK       (0x0230)
+#define MSG_TYPE_OPEN       (0x0231)
+#define MSG_TYPE_CONNECT    (0x0232)
+#define MSG_TYPE_LISTEN     (0x0233)
+#define MSG_TYPE_ACCEPT     (0x0234)
+#define MSG_TYPE_SEND       (0x0235)
+#define MSG_TYPE_RECV       (0x0236)
+#define MSG_TYPE_CLOSE      (0x0237)
+/** @} */
+
+/**
+ * @name    Flags of gnrc_tcp_tcb_t::flags
+ * @{
+ */
+#define FLAG_USED           (0x0001)    /**< TCB is allocated */
+#define FLAG_ORPHAN         (0x0002)    /**< application closed the TCB */
+#define FLAG_ACK_NOW        (0x0004)    /**< send an ACK immediately */
+#define FLAG_ACK_DELAYED    (0x0008)    /**< an ACK is delayed */
+#define FLAG_FIN_PENDING    (0x0010)    /**< send FIN after the queued data */
+#define FLAG_FIN_SENT       (0x0020)    /**< FIN was sent, snd_max covers it */
+#define FLAG_FIN_RCVD       (0x0040)    /**< peer's FIN was received */
+#define FLAG_RECOVERY       (0x0080)    /**< in fast recovery */
+#define FLAG_RTT_TIMING     (0x0100)    /**< a segment is timed */
+/** @} */
+
+/**
+ * @name    Types of gnrc_tcp_timer_t::type
+ * @{
+ */
+#define TIMER_RTX           (0)         /**< gnrc_tcp_tcb_t::rtx_timer */
+#define TIMER_ACK           (1)         /**< gnrc_tcp_tcb_t::ack_timer */
+/** @} */
+
+/**
+ * @brief   Returned by request handlers that reply later
+ */
+#define DEFERRED            (INT_MIN)
+
+/**
+ * @brief   Default MSS if the peer does not announce one (RFC 2460, 8.3)
+ */
+#define DEFAULT_MSS         (1220U)
+
+/**
+ * @brief   Lowest ephemeral port (RFC 6335)
+ */
+#define EPHEMERAL_PORT_MIN  (49152U)
+
+#define MS_TO_TICKS(ms)     ((((ms) * 1000U) + GNRC_TCP_TICK_US - 1) / \
+                             GNRC_TCP_TICK_US)
+
+#define SEQ_LT(a, b)        ((int32_t)((a) - (b)) < 0)
+#define SEQ_LEQ(a, b)       ((int32_t)((a) - (b)) <= 0)
+#define SEQ_GT(a, b)        ((int32_t)((a) - (b)) > 0)
+#define SEQ_GEQ(a, b)       ((int32_t)((a) - (b)) >= 0)
+
+/**
+ * @brief   Request of an application thread, passed by pointer
+ */
+typedef struct {
+    gnrc_tcp_tcb_t *tcb;        /**< the connection, result of open and
+                                 *   accept */
+    const ipv6_addr_t *addr;    /**< address for open and connect */
+    void *data;                 /**< buffer for send and receive */
+    size_t len;                 /**< length of data, backlog for listen */
+    uint16_t port;              /**< port for open and connect */
+} _req_t;
+
+/**
+ * @brief   Fields of a received segment
+ */
+typedef struct {
+    uint32_t seq;               /**< sequence number */
+    uint32_t ack;               /**< acknowledgement number */
+    uint16_t flags;             /**< control flags */
+    uint16_t wnd;               /**< window */
+    uint16_t mss;               /**< MSS option, 0 if not present */
+} _seg_t;
+
+/**
+ * @brief   Save the TCP's thread PID for later reference
+ */
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+/**
+ * @brief   Allocate memory for the TCP thread's stack
+ */
+#if ENABLE_DEBUG
+static char _stack[GNRC_TCP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
+#else
+static char _stack[GNRC_TCP_STACK_SIZE];
+#endif
+
+static gnrc_tcp_tcb_t _tcbs[GNRC_TCP_TCB_NUMOF];
+static uint16_t _next_port;
+
+/**
+ * @brief   Timer wheel, slot i holds the timers expiring at ticks i modulo
+ *          GNRC_TCP_WHEEL_SIZE
+ */
+static gnrc_tcp_timer_t *_wheel[GNRC_TCP_WHEEL_SIZE];
+static uint32_t _ticks;
+static unsigned _timers_armed;
+static xtimer_t _tick_timer;
+static msg_t _tick_msg;
+static uint32_t _tick_due;
+static bool _ticking;
+
+static void _output(gnrc_tcp_tcb_t *tcb);
+
+/* timer wheel */
+static void _tick_schedule(void)
+{
+#ifdef TEST_SUITES
+    if (_pid == KERNEL_PID_UNDEF) {
+        /* the tests advance the ticks themselves */
+        return;
+    }
+#endif
+    _ticking = true;
+    _tick_due = xtimer_now() + GNRC_TCP_TICK_US;
+    xtimer_set_msg(&_tick_timer, GNRC_TCP_TICK_US, &_tick_msg, _pid);
+}
+
+static void _timer_stop(gnrc_tcp_timer_t *timer)
+{
+    if (timer->armed) {
+        LL_DELETE(_wheel[timer->expiry & (GNRC_TCP_WHEEL_SIZE - 1)], timer);
+        timer->armed = 0;
+        _timers_armed--;
+    }
+}
+
+static void _timer_set(gnrc_tcp_timer_t *timer, uint32_t ticks)
+{
+    _timer_stop(timer);
+    timer->expiry = _ticks + ((ticks > 0) ? ticks : 1);
+    LL_PREPEND(_wheel[timer->expiry & (GNRC_TCP_WHEEL_SIZE - 1)], timer);
+    timer->armed = 1;
+    if ((_timers_armed++ == 0) && !_ticking) {
+        _tick_schedule();
+    }
+}
+
+/* sequence and window helpers */
+static inline uint32_t _min(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+static inline uint32_t _max(uint32_t a, uint32_t b)
+{
+    return (a > b) ? a : b;
+}
+
+static inline uint32_t _flight(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_max - tcb->snd_una;
+}
+
+static inline gnrc_tcp_seg_t *_seg(gnrc_tcp_tcb_t *tcb, unsigned count)
+{
+    return &tcb->snd_segs[count & tcb->snd_cib.mask];
+}
+
+static uint32_t _rcv_space(const gnrc_tcp_tcb_t *tcb)
+{
+    if (cib_full(&tcb->rcv_cib)) {
+        return 0;
+    }
+    return GNRC_TCP_RCV_BUFSIZE - tcb->rcv_queued;
+}
+
+static uint16_t _rcv_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = _rcv_space(tcb);
+
+    /* avoid the silly window syndrome (RFC 1122, 4.2.3.3) */
+    if (wnd < _min(GNRC_TCP_RCV_BUFSIZE / 2, tcb->mss)) {
+        wnd = 0;
+    }
+    /* never shrink the window */
+    if (SEQ_GT(tcb->rcv_adv, tcb->rcv_nxt + wnd)) {
+        wnd = tcb->rcv_adv - tcb->rcv_nxt;
+    }
+    return (uint16_t)_min(wnd, UINT16_MAX);
+}
+
+static uint16_t _local_mss(const gnrc_tcp_tcb_t *tcb)
+{
+    ipv6_addr_t *addr;
+    kernel_pid_t iface = tcb->iface;
+    uint16_t mss = GNRC_TCP_MSS;
+
+    if (iface == KERNEL_PID_UNDEF) {
+        iface = gnrc_ipv6_netif_find_by_addr(&addr, &tcb->local_addr);
+    }
+    if (iface != KERNEL_PID_UNDEF) {
+        gnrc_ipv6_netif_t *netif = gnrc_ipv6_netif_get(iface);
+        size_t hdrs = sizeof(ipv6_hdr_t) + TCP_HDR_MIN_SIZE;
+
+        if ((netif != NULL) && (netif->mtu > hdrs) && ((netif->mtu - hdrs) < mss)) {
+            mss = netif->mtu - hdrs;
+        }
+    }
+    return mss;
+}
+
+/* checksum */
+static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
+                           gnrc_pktsnip_t *payload)
+{
+    uint16_t csum = 0;
+    uint16_t len = (uint16_t)hdr->size;
+
+    /* process the payload */
+    while (payload && payload != hdr && payload != pseudo_hdr) {
+        csum = inet_csum_slice(csum, (uint8_t *)(payload->data), payload->size, len);
+        len += (uint16_t)payload->size;
+        payload = payload->next;
+    }
+    /* process TCP header and options */
+    csum = inet_csum(csum, (uint8_t *)hdr->data, hdr->size);
+
+    switch (pseudo_hdr->type) {
+#ifdef MODULE_GNRC_IPV6
+        case GNRC_NETTYPE_IPV6:
+            csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_TCP, len);
+            break;
+#endif
+        default:
+            (void)len;
+            return 0;
+    }
+    return ~csum;
+}
+
+/* output */
+static int _send_pkt(gnrc_pktsnip_t *pkt, const ipv6_addr_t *src,
+                     const ipv6_addr_t *dst, kernel_pid_t iface)
+{
+    gnrc_pktsnip_t *hdr;
+
+    hdr = gnrc_ipv6_hdr_build(pkt, ipv6_addr_is_unspecified(src) ? NULL : src, dst);
+    if (hdr == NULL) {
+        DEBUG("tcp: unable to allocate IPv6 header\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt = hdr;
+    if (iface != KERNEL_PID_UNDEF) {
+        hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (hdr == NULL) {
+            DEBUG("tcp: unable to allocate netif header\n");
+            gnrc_pktbuf_release(pkt);
+            return -ENOMEM;
+        }
+        ((gnrc_netif_hdr_t *)hdr->data)->if_pid = iface;
+        LL_PREPEND(pkt, hdr);
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        DEBUG("tcp: cannot send packet: network layer not found\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENETUNREACH;
+    }
+    return 0;
+}
+
+/* sends a segment, data is only held and stays in the send queue */
+static int _xmit(gnrc_tcp_tcb_t *tcb, uint32_t seq, uint16_t flags,
+                 gnrc_pktsnip_t *data)
+{
+    gnrc_pktsnip_t *pkt;
+    tcp_hdr_t *hdr;
+    size_t hdr_len = TCP_HDR_MIN_SIZE;
+    uint16_t wnd;
+
+    if (flags & TCP_FLAG_SYN) {
+        hdr_len += TCP_OPTION_LENGTH_MSS;
+    }
+    if (data != NULL) {
+        gnrc_pktbuf_hold(data, 1);
+    }
+    pkt = gnrc_pktbuf_add(data, NULL, hdr_len, GNRC_NETTYPE_TCP);
+    if (pkt == NULL) {
+        DEBUG("tcp: unable to allocate TCP header\n");
+        if (data != NULL) {
+            gnrc_pktbuf_release(data);
+        }
+        return -ENOMEM;
+    }
+    hdr = pkt->data;
+    memset(hdr, 0, hdr_len);
+    hdr->src_port = byteorder_htons(tcb->local_port);
+    hdr->dst_port = byteorder_htons(tcb->peer_port);
+    hdr->seq_num = byteorder_htonl(seq);
+    if (tcb->state != GNRC_TCP_STATE_SYN_SENT) {
+        flags |= TCP_FLAG_ACK;
+        hdr->ack_num = byteorder_htonl(tcb->rcv_nxt);
+    }
+    wnd = _rcv_wnd(tcb);
+    hdr->window = byteorder_htons(wnd);
+    tcb->rcv_adv = tcb->rcv_nxt + wnd;
+    if (flags & TCP_FLAG_SYN) {
+        uint8_t *opt = (uint8_t *)(hdr + 1);
+        uint16_t mss = _local_mss(tcb);
+
+        opt[0] = TCP_OPTION_KIND_MSS;
+        opt[1] = TCP_OPTION_LENGTH_MSS;
+        opt[2] = mss >> 8;
+        opt[3] = mss & 0xff;
+    }
+    tcp_hdr_set_off_ctl(hdr, hdr_len, flags);
+
+    /* every segment acknowledges everything received */
+    tcb->flags &= ~(FLAG_ACK_NOW | FLAG_ACK_DELAYED);
+    _timer_stop(&tcb->ack_timer);
+
+    return _send_pkt(pkt, &tcb->local_addr, &tcb->peer_addr, tcb->iface);
+}
+
+static void _send_rst(const ipv6_hdr_t *ip, const tcp_hdr_t *seg, size_t seg_len,
+                      kernel_pid_t iface)
+{
+    gnrc_pktsnip_t *pkt;
+    tcp_hdr_t *hdr;
+    uint16_t flags = tcp_hdr_get_flags(seg);
+
+    if ((flags & TCP_FLAG_RST) || ipv6_addr_is_multicast(&ip->dst)) {
+        return;
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, TCP_HDR_MIN_SIZE, GNRC_NETTYPE_TCP);
+    if (pkt == NULL) {
+        return;
+    }
+    hdr = pkt->data;
+    memset(hdr, 0, TCP_HDR_MIN_SIZE);
+    hdr->src_port = seg->dst_port;
+    hdr->dst_port = seg->src_port;
+    if (flags & TCP_FLAG_ACK) {
+        hdr->seq_num = seg->ack_num;
+        tcp_hdr_set_off_ctl(hdr, TCP_HDR_MIN_SIZE, TCP_FLAG_RST);
+    }
+    else {
+        hdr->ack_num = byteorder_htonl(byteorder_ntohl(seg->seq_num) + seg_len);
+        tcp_hdr_set_off_ctl(hdr, TCP_HDR_MIN_SIZE, TCP_FLAG_RST | TCP_FLAG_ACK);
+    }
+    _send_pkt(pkt, &ip->dst, &ip->src, iface);
+}
+
+static void _rtx_arm(gnrc_tcp_tcb_t *tcb)
+{
+    _timer_set(&tcb->rtx_timer, tcb->rto);
+}
+
+static void _rtt_start(gnrc_tcp_tcb_t *tcb, uint32_t seq)
+{
+    if (!(tcb->flags & FLAG_RTT_TIMING)) {
+        tcb->flags |= FLAG_RTT_TIMING;
+        tcb->rtt_seq = seq;
+        tcb->rtt_start = _ticks;
+    }
+}
+
+/* RFC 6298, 2. */
+static void _rtt_update(gnrc_tcp_tcb_t *tcb, uint32_t rtt)
+{
+    if (rtt == 0) {
+        rtt = 1;
+    }
+    if (tcb->srtt == 0) {
+        tcb->srtt = rtt << 3;
+        tcb->rttvar = rtt << 1;
+    }
+    else {
+        int32_t delta = (int32_t)rtt - (int32_t)(tcb->srtt >> 3);
+
+        tcb->srtt += delta;
+        if (delta < 0) {
+            delta = -delta;
+        }
+        tcb->rttvar += delta - (int32_t)(tcb->rttvar >> 2);
+    }
+    tcb->rto = (tcb->srtt >> 3) + tcb->rttvar;
+    tcb->rto = _max(tcb->rto, MS_TO_TICKS(GNRC_TCP_RTO_MIN_MS));
+    tcb->rto = _min(tcb->rto, MS_TO_TICKS(GNRC_TCP_RTO_MAX_MS));
+}
+
+/* sends as much queued data as the windows allow, a FIN after the data and
+ * a pending ACK if nothing else was sent */
+static void _output(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = _min(tcb->snd_wnd, tcb->cwnd);
+
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_ESTABLISHED:
+        case GNRC_TCP_STATE_CLOSE_WAIT:
+        case GNRC_TCP_STATE_FIN_WAIT_1:
+        case GNRC_TCP_STATE_CLOSING:
+        case GNRC_TCP_STATE_LAST_ACK:
+            break;
+        case GNRC_TCP_STATE_SYN_RCVD:
+        case GNRC_TCP_STATE_FIN_WAIT_2:
+        case GNRC_TCP_STATE_TIME_WAIT:
+            if (tcb->flags & FLAG_ACK_NOW) {
+                _xmit(tcb, tcb->snd_nxt, 0, NULL);
+            }
+            return;
+        default:
+            return;
+    }
+
+    while (tcb->snd_next != tcb->snd_cib.write_count) {
+        gnrc_tcp_seg_t *seg = _seg(tcb, tcb->snd_next);
+        uint32_t end = seg->seq + seg->data->size;
+
+        if (SEQ_GT(end, tcb->snd_una + wnd)) {
+            if ((_flight(tcb) == 0) && !tcb->rtx_timer.armed) {
+                /* window is closed: probe it after a timeout */
+                _rtx_arm(tcb);
+            }
+            break;
+        }
+        if (_xmit(tcb, seg->seq, TCP_FLAG_PSH, seg->data) < 0) {
+            break;
+        }
+        if (SEQ_GEQ(seg->seq, tcb->snd_max)) {
+            /* only time new segments (Karn) */
+            _rtt_start(tcb, end);
+        }
+        tcb->snd_next++;
+        tcb->snd_nxt = end;
+        if (SEQ_GT(end, tcb->snd_max)) {
+            tcb->snd_max = end;
+        }
+        if (!tcb->rtx_timer.armed) {
+            _rtx_arm(tcb);
+        }
+    }
+
+    if ((tcb->flags & FLAG_FIN_PENDING) &&
+        (tcb->snd_next == tcb->snd_cib.write_count) &&
+        (!(tcb->flags & FLAG_FIN_SENT) || (tcb->snd_nxt == tcb->snd_max - 1))) {
+        if (_xmit(tcb, tcb->snd_nxt, TCP_FLAG_FIN, NULL) == 0) {
+            tcb->flags |= FLAG_FIN_SENT;
+            tcb->snd_nxt++;
+            if (SEQ_GT(tcb->snd_nxt, tcb->snd_max)) {
+                tcb->snd_max = tcb->snd_nxt;
+            }
+            if (!tcb->rtx_timer.armed) {
+                _rtx_arm(tcb);
+            }
+        }
+    }
+
+    if (tcb->flags & FLAG_ACK_NOW) {
+        _xmit(tcb, tcb->snd_nxt, 0, NULL);
+    }
+}
+
+/* connection management */
+static bool _valid(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb >= _tcbs) && (tcb < (_tcbs + GNRC_TCP_TCB_NUMOF)) &&
+           ((tcb->flags & (FLAG_USED | FLAG_ORPHAN)) == FLAG_USED);
+}
+
+static void _reply(msg_t *req, int res)
+{
+    msg_t reply;
+
+    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+    reply.content.value = (uint32_t)res;
+    msg_reply(req, &reply);
+}
+
+static void _wake(msg_t *waiter, int res)
+{
+    if (waiter->sender_pid != KERNEL_PID_UNDEF) {
+        _reply(waiter, res);
+        waiter->sender_pid = KERNEL_PID_UNDEF;
+    }
+}
+
+static void _flush(gnrc_tcp_tcb_t *tcb)
+{
+    int idx;
+
+    _timer_stop(&tcb->rtx_timer);
+    _timer_stop(&tcb->ack_timer);
+    while ((idx = cib_get(&tcb->snd_cib)) >= 0) {
+        gnrc_pktbuf_release(tcb->snd_segs[idx].data);
+    }
+    while ((idx = cib_get(&tcb->rcv_cib)) >= 0) {
+        gnrc_pktbuf_release(tcb->rcv_segs[idx]);
+    }
+    tcb->snd_queued = 0;
+    tcb->rcv_queued = 0;
+    tcb->rcv_offset = 0;
+}
+
+static void _free(gnrc_tcp_tcb_t *tcb)
+{
+    DEBUG("tcp: free TCB %p\n", (void *)tcb);
+    _flush(tcb);
+    _wake(&tcb->rcv_waiter, -EBADF);
+    _wake(&tcb->snd_waiter, -EBADF);
+    memset(tcb, 0, sizeof(*tcb));
+}
+
+static void _abort(gnrc_tcp_tcb_t *tcb, int err)
+{
+    DEBUG("tcp: abort TCB %p (%d)\n", (void *)tcb, err);
+    _flush(tcb);
+    tcb->state = GNRC_TCP_STATE_CLOSED;
+    tcb->error = (int8_t)err;
+    _wake(&tcb->rcv_waiter, err);
+    _wake(&tcb->snd_waiter, err);
+    if ((tcb->flags & FLAG_ORPHAN) || (tcb->parent != NULL)) {
+        _free(tcb);
+    }
+}
+
+static gnrc_tcp_tcb_t *_alloc(void)
+{
+    for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+        if (!(_tcbs[i].flags & FLAG_USED)) {
+            gnrc_tcp_tcb_t *tcb = &_tcbs[i];
+
+            memset(tcb, 0, sizeof(*tcb));
+            tcb->flags = FLAG_USED;
+            cib_init(&tcb->snd_cib, GNRC_TCP_SND_SEGS);
+            cib_init(&tcb->rcv_cib, GNRC_TCP_RCV_SEGS);
+            tcb->rtx_timer.type = TIMER_RTX;
+            tcb->ack_timer.type = TIMER_ACK;
+            return tcb;
+        }
+    }
+    return NULL;
+}
+
+/* initializes the sequence spaces for a new connection */
+static void _init_conn(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->iss = random_uint32();
+    tcb->snd_una = tcb->iss;
+    tcb->snd_nxt = tcb->iss + 1;
+    tcb->snd_max = tcb->iss + 1;
+    tcb->mss = _min(DEFAULT_MSS, _local_mss(tcb));
+    tcb->rto = MS_TO_TICKS(GNRC_TCP_RTO_INIT_MS);
+    tcb->ssthresh = UINT16_MAX;
+    _rtt_start(tcb, tcb->snd_nxt);
+}
+
+/* takes the peer's parameters from its SYN */
+static void _syn_rcvd(gnrc_tcp_tcb_t *tcb, const _seg_t *seg)
+{
+    tcb->irs = seg->seq;
+    tcb->rcv_nxt = seg->seq + 1;
+    tcb->rcv_adv = tcb->rcv_nxt;
+    tcb->snd_wnd = seg->wnd;
+    tcb->snd_wl1 = seg->seq;
+    tcb->snd_wl2 = seg->ack;
+    tcb->mss = _min((seg->mss != 0) ? seg->mss : DEFAULT_MSS, _local_mss(tcb));
+    /* RFC 5681, 3.1 */
+    tcb->cwnd = (tcb->mss > 2190) ? (2 * tcb->mss) :
+                (tcb->mss > 1095) ? (3 * tcb->mss) : (4 * tcb->mss);
+}
+
+static void _established(gnrc_tcp_tcb_t *tcb, const _seg_t *seg)
+{
+    DEBUG("tcp: TCB %p established\n", (void *)tcb);
+    tcb->state = GNRC_TCP_STATE_ESTABLISHED;
+    tcb->snd_una = seg->ack;
+    tcb->snd_wnd = seg->wnd;
+    tcb->snd_wl1 = seg->seq;
+    tcb->snd_wl2 = seg->ack;
+    tcb->retries = 0;
+    if (tcb->flags & FLAG_RTT_TIMING) {
+        _rtt_update(tcb, _ticks - tcb->rtt_start);
+        tcb->flags &= ~FLAG_RTT_TIMING;
+    }
+    _timer_stop(&tcb->rtx_timer);
+}
+
+static gnrc_tcp_tcb_t *_find_accepted(gnrc_tcp_tcb_t *listener, unsigned *pending)
+{
+    gnrc_tcp_tcb_t *res = NULL;
+
+    *pending = 0;
+    for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+        gnrc_tcp_tcb_t *tcb = &_tcbs[i];
+
+        if ((tcb->flags & FLAG_USED) && (tcb->parent == listener)) {
+            (*pending)++;
+            if ((res == NULL) && (tcb->state != GNRC_TCP_STATE_SYN_RCVD)) {
+                res = tcb;
+            }
+        }
+    }
+    return res;
+}
+
+/* hands the oldest established connection over to the application */
+static gnrc_tcp_tcb_t *_accept_next(gnrc_tcp_tcb_t *listener)
+{
+    unsigned pending;
+    gnrc_tcp_tcb_t *tcb = _find_accepted(listener, &pending);
+
+    if (tcb != NULL) {
+        tcb->parent = NULL;
+    }
+    return tcb;
+}
+
+static void _accept_resume(gnrc_tcp_tcb_t *listener)
+{
+    msg_t *waiter = &listener->rcv_waiter;
+    gnrc_tcp_tcb_t *tcb;
+
+    if ((waiter->sender_pid == KERNEL_PID_UNDEF) ||
+        ((tcb = _accept_next(listener)) == NULL)) {
+        return;
+    }
+    ((_req_t *)waiter->content.ptr)->tcb = tcb;
+    _wake(waiter, 0);
+}
+
+/* copies queued data to buf, returns the number of bytes copied */
+static size_t _read(gnrc_tcp_tcb_t *tcb, uint8_t *buf, size_t max_len)
+{
+    size_t res = 0;
+    uint32_t wnd_before = tcb->rcv_adv - tcb->rcv_nxt;
+    int idx;
+
+    while ((res < max_len) && ((idx = cib_peek(&tcb->rcv_cib)) >= 0)) {
+        gnrc_pktsnip_t *data = tcb->rcv_segs[idx];
+        size_t len = _min(data->size - tcb->rcv_offset, max_len - res);
+
+        memcpy(buf + res, (uint8_t *)data->data + tcb->rcv_offset, len);
+        res += len;
+        tcb->rcv_offset += len;
+        if (tcb->rcv_offset == data->size) {
+            gnrc_pktbuf_release(data);
+            cib_get(&tcb->rcv_cib);
+            tcb->rcv_offset = 0;
+        }
+    }
+    tcb->rcv_queued -= res;
+
+    /* send a window update if the window opened significantly
+     * (RFC 1122, 4.2.3.3) */
+    if ((res > 0) && (_rcv_space(tcb) >= wnd_before +
+                      _min(GNRC_TCP_RCV_BUFSIZE / 2, tcb->mss))) {
+        tcb->flags |= FLAG_ACK_NOW;
+    }
+    return res;
+}
+
+static int _recv_result(gnrc_tcp_tcb_t *tcb, _req_t *req)
+{
+    size_t res = _read(tcb, req->data, req->len);
+
+    if (res > 0) {
+        _output(tcb);
+        return (int)res;
+    }
+    if ((tcb->flags & FLAG_FIN_RCVD) || (req->len == 0)) {
+        return 0;
+    }
+    if (tcb->state == GNRC_TCP_STATE_CLOSED) {
+        return (tcb->error != 0) ? tcb->error : -ENOTCONN;
+    }
+    return DEFERRED;
+}
+
+static void _recv_resume(gnrc_tcp_tcb_t *tcb)
+{
+    msg_t *waiter = &tcb->rcv_waiter;
+    int res;
+
+    if ((waiter->sender_pid == KERNEL_PID_UNDEF) || (waiter->type != MSG_TYPE_RECV)) {
+        return;
+    }
+    res = _recv_result(tcb, waiter->content.ptr);
+    if (res != DEFERRED) {
+        _wake(waiter, res);
+    }
+}
+
+/* appends data to the send queue, returns the number of bytes queued */
+static int _queue(gnrc_tcp_tcb_t *tcb, const uint8_t *data, size_t len)
+{
+    size_t res = 0;
+
+    while ((res < len) && !cib_full(&tcb->snd_cib) &&
+           (tcb->snd_queued < GNRC_TCP_SND_BUFSIZE)) {
+        size_t chunk = _min(_min(len - res, tcb->mss),
+                            GNRC_TCP_SND_BUFSIZE - tcb->snd_queued);
+        uint32_t seq = tcb->snd_max;
+        gnrc_pktsnip_t *snip;
+
+        if (cib_avail(&tcb->snd_cib) > 0) {
+            gnrc_tcp_seg_t *last = _seg(tcb, tcb->snd_cib.write_count - 1);
+
+            seq = last->seq + last->data->size;
+        }
+        snip = gnrc_pktbuf_add(NULL, (void *)(data + res), chunk, GNRC_NETTYPE_UNDEF);
+        if (snip == NULL) {
+            return (res > 0) ? (int)res : -ENOMEM;
+        }
+        tcb->snd_segs[cib_put(&tcb->snd_cib)] = (gnrc_tcp_seg_t){ snip, seq };
+        tcb->snd_queued += chunk;
+        res += chunk;
+    }
+    return (int)res;
+}
+
+static int _send_result(gnrc_tcp_tcb_t *tcb, _req_t *req)
+{
+    int res;
+
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_ESTABLISHED:
+        case GNRC_TCP_STATE_CLOSE_WAIT:
+            break;
+        case GNRC_TCP_STATE_CLOSED:
+            return (tcb->error != 0) ? tcb->error : -ENOTCONN;
+        case GNRC_TCP_STATE_LISTEN:
+        case GNRC_TCP_STATE_SYN_SENT:
+        case GNRC_TCP_STATE_SYN_RCVD:
+            return -ENOTCONN;
+        default:
+            return -EPIPE;
+    }
+    if (req->len == 0) {
+        return 0;
+    }
+    res = _queue(tcb, req->data, req->len);
+    if (res > 0) {
+        _output(tcb);
+        return res;
+    }
+    if ((res == 0) || (cib_avail(&tcb->snd_cib) > 0)) {
+        /* wait until acknowledgements free space */
+        return DEFERRED;
+    }
+    return res;
+}
+
+static void _send_resume(gnrc_tcp_tcb_t *tcb)
+{
+    msg_t *waiter = &tcb->snd_waiter;
+    int res;
+
+    if (waiter->sender_pid == KERNEL_PID_UNDEF) {
+        return;
+    }
+    res = _send_result(tcb, waiter->content.ptr);
+    if (res != DEFERRED) {
+        _wake(waiter, res);
+    }
+}
+
+/* timers */
+static void _rtx_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_FIN_WAIT_2:
+        case GNRC_TCP_STATE_TIME_WAIT:
+            _free(tcb);
+            return;
+        case GNRC_TCP_STATE_CLOSED:
+        case GNRC_TCP_STATE_LISTEN:
+            return;
+        default:
+            break;
+    }
+
+    if ((_flight(tcb) == 0) && (tcb->snd_next == tcb->snd_cib.write_count)) {
+        /* everything was acknowledged meanwhile */
+        return;
+    }
+    if (tcb->retries++ >= GNRC_TCP_MAX_RETRIES) {
+        DEBUG("tcp: TCB %p timed out\n", (void *)tcb);
+        _abort(tcb, -ETIMEDOUT);
+        return;
+    }
+    tcb->rto = _min(tcb->rto * 2, MS_TO_TICKS(GNRC_TCP_RTO_MAX_MS));
+    tcb->flags &= ~FLAG_RTT_TIMING;
+
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_SYN_SENT:
+        case GNRC_TCP_STATE_SYN_RCVD:
+            _xmit(tcb, tcb->iss, TCP_FLAG_SYN, NULL);
+            _rtx_arm(tcb);
+            return;
+        default:
+            break;
+    }
+
+    if ((_flight(tcb) == 0) && (tcb->snd_next != tcb->snd_cib.write_count)) {
+        /* zero window probe: send the next segment regardless of the
+         * window, the peer acknowledges what fits */
+        gnrc_tcp_seg_t *seg = _seg(tcb, tcb->snd_next);
+
+        DEBUG("tcp: TCB %p probes window\n", (void *)tcb);
+        tcb->retries = 0;
+        if (_xmit(tcb, seg->seq, TCP_FLAG_PSH, seg->data) == 0) {
+            tcb->snd_next++;
+            tcb->snd_nxt = seg->seq + seg->data->size;
+            tcb->snd_max = tcb->snd_nxt;
+        }
+        _rtx_arm(tcb);
+        return;
+    }
+
+    /* RFC 5681, 3.1: back to slow start, go back N */
+    DEBUG("tcp: TCB %p retransmits\n", (void *)tcb);
+    tcb->ssthresh = _max(_flight(tcb) / 2, 2 * tcb->mss);
+    tcb->cwnd = tcb->mss;
+    tcb->dupacks = 0;
+    tcb->flags &= ~FLAG_RECOVERY;
+    tcb->snd_next = tcb->snd_cib.read_count;
+    tcb->snd_nxt = tcb->snd_una;
+    _rtx_arm(tcb);
+    _output(tcb);
+}
+
+static void _timer_fire(gnrc_tcp_timer_t *timer)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    if (timer->type == TIMER_RTX) {
+        _rtx_timeout(container_of(timer, gnrc_tcp_tcb_t, rtx_timer));
+        return;
+    }
+    tcb = container_of(timer, gnrc_tcp_tcb_t, ack_timer);
+    if (tcb->flags & FLAG_ACK_DELAYED) {
+        tcb->flags |= FLAG_ACK_NOW;
+        _output(tcb);
+    }
+}
+
+static void _tick(void)
+{
+    unsigned slot;
+    gnrc_tcp_timer_t *timer;
+
+    _ticking = false;
+    _ticks++;
+    slot = _ticks & (GNRC_TCP_WHEEL_SIZE - 1);
+    /* a fired timer may change the slot, so start over after each one */
+    do {
+        LL_FOREACH(_wheel[slot], timer) {
+            if (SEQ_LEQ(timer->expiry, _ticks)) {
+                break;
+            }
+        }
+        if (timer != NULL) {
+            _timer_stop(timer);
+            _timer_fire(timer);
+        }
+    } while (timer != NULL);
+    if ((_timers_armed > 0) && !_ticking) {
+        _tick_schedule();
+    }
+}
+
+/* input */
+static gnrc_tcp_tcb_t *_lookup(const ipv6_hdr_t *ip, const tcp_hdr_t *hdr)
+{
+    uint16_t dst_port = byteorder_ntohs(hdr->dst_port);
+    uint16_t src_port = byteorder_ntohs(hdr->src_port);
+    gnrc_tcp_tcb_t *listener = NULL;
+
+    for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+        gnrc_tcp_tcb_t *tcb = &_tcbs[i];
+
+        if (!(tcb->flags & FLAG_USED) || (tcb->local_port != dst_port) ||
+            (!ipv6_addr_is_unspecified(&tcb->local_addr) &&
+             !ipv6_addr_equal(&tcb->local_addr, &ip->dst))) {
+            continue;
+        }
+        if (tcb->state == GNRC_TCP_STATE_LISTEN) {
+            listener = tcb;
+        }
+        else if ((tcb->state != GNRC_TCP_STATE_CLOSED) &&
+                 (tcb->peer_port == src_port) &&
+                 ipv6_addr_equal(&tcb->peer_addr, &ip->src)) {
+            return tcb;
+        }
+    }
+    return listener;
+}
+
+static void _listen_input(gnrc_tcp_tcb_t *listener, const _seg_t *seg,
+                          const ipv6_hdr_t *ip, const tcp_hdr_t *hdr,
+                          size_t seg_len, kernel_pid_t iface)
+{
+    gnrc_tcp_tcb_t *tcb;
+    unsigned pending;
+
+    if (seg->flags & TCP_FLAG_RST) {
+        return;
+    }
+    if (seg->flags & TCP_FLAG_ACK) {
+        _send_rst(ip, hdr, seg_len, iface);
+        return;
+    }
+    if (!(seg->flags & TCP_FLAG_SYN)) {
+        return;
+    }
+    _find_accepted(listener, &pending);
+    if ((pending >= listener->backlog) || ((tcb = _alloc()) == NULL)) {
+        /* the peer retries */
+        DEBUG("tcp: no room for connection request\n");
+        return;
+    }
+    tcb->parent = listener;
+    tcb->local_addr = ip->dst;
+    tcb->local_port = listener->local_port;
+    tcb->peer_addr = ip->src;
+    tcb->peer_port = byteorder_ntohs(hdr->src_port);
+    tcb->iface = iface;
+    _init_conn(tcb);
+    _syn_rcvd(tcb, seg);
+    tcb->state = GNRC_TCP_STATE_SYN_RCVD;
+    _xmit(tcb, tcb->iss, TCP_FLAG_SYN, NULL);
+    _rtx_arm(tcb);
+}
+
+static void _syn_sent_input(gnrc_tcp_tcb_t *tcb, const _seg_t *seg,
+                            const ipv6_hdr_t *ip, const tcp_hdr_t *hdr,
+                            size_t seg_len, kernel_pid_t iface)
+{
+    if ((seg->flags & TCP_FLAG_ACK) &&
+        (SEQ_LEQ(seg->ack, tcb->iss) || SEQ_GT(seg->ack, tcb->snd_max))) {
+        _send_rst(ip, hdr, seg_len, iface);
+        return;
+    }
+    if (seg->flags & TCP_FLAG_RST) {
+        if (seg->flags & TCP_FLAG_ACK) {
+            _abort(tcb, -ECONNREFUSED);
+        }
+        return;
+    }
+    if (!(seg->flags & TCP_FLAG_SYN)) {
+        return;
+    }
+    _syn_rcvd(tcb, seg);
+    if (seg->flags & TCP_FLAG_ACK) {
+        _established(tcb, seg);
+        tcb->flags |= FLAG_ACK_NOW;
+        _output(tcb);
+        _wake(&tcb->rcv_waiter, 0);
+    }
+    else {
+        /* simultaneous open */
+        tcb->state = GNRC_TCP_STATE_SYN_RCVD;
+        _xmit(tcb, tcb->iss, TCP_FLAG_SYN, NULL);
+    }
+}
+
+/* processes the ACK field, returns false if the segment must be dropped */
+static bool _ack_input(gnrc_tcp_tcb_t *tcb, const _seg_t *seg, size_t seg_len)
+{
+    uint32_t acked;
+
+    if (SEQ_GT(seg->ack, tcb->snd_max)) {
+        /* acknowledges something not sent yet */
+        tcb->flags |= FLAG_ACK_NOW;
+        return false;
+    }
+    if (SEQ_LT(seg->ack, tcb->snd_una)) {
+        /* old duplicate */
+        return true;
+    }
+
+    if (seg->ack == tcb->snd_una) {
+        /* RFC 5681, 2: a duplicate ACK acknowledges nothing new, carries no
+         * data and does not change the window */
+        bool dup = (_flight(tcb) > 0) && (seg_len == 0) && (seg->wnd == tcb->snd_wnd);
+
+        if (SEQ_LT(tcb->snd_wl1, seg->seq) ||
+            ((tcb->snd_wl1 == seg->seq) && SEQ_LEQ(tcb->snd_wl2, seg->ack))) {
+            tcb->snd_wnd = seg->wnd;
+            tcb->snd_wl1 = seg->seq;
+            tcb->snd_wl2 = seg->ack;
+        }
+        if (seg->wnd == 0) {
+            /* the peer answers window probes */
+            tcb->retries = 0;
+        }
+        if (!dup) {
+            tcb->dupacks = 0;
+            return true;
+        }
+        if (++tcb->dupacks == GNRC_TCP_DUPACK_THRESH) {
+            /* RFC 6582: fast retransmit, unless already recovering */
+            if (!(tcb->flags & FLAG_RECOVERY) || SEQ_GT(seg->ack, tcb->recover)) {
+                DEBUG("tcp: TCB %p fast retransmit\n", (void *)tcb);
+                tcb->ssthresh = _max(_flight(tcb) / 2, 2 * tcb->mss);
+                tcb->cwnd = tcb->ssthresh + (GNRC_TCP_DUPACK_THRESH * tcb->mss);
+                tcb->recover = tcb->snd_max;
+                tcb->flags |= FLAG_RECOVERY;
+                tcb->flags &= ~FLAG_RTT_TIMING;
+                if (cib_avail(&tcb->snd_cib) > 0) {
+                    gnrc_tcp_seg_t *first = _seg(tcb, tcb->snd_cib.read_count);
+
+                    _xmit(tcb, first->seq, TCP_FLAG_PSH, first->data);
+                }
+                _rtx_arm(tcb);
+            }
+        }
+        else if ((tcb->dupacks > GNRC_TCP_DUPACK_THRESH) &&
+                 (tcb->flags & FLAG_RECOVERY)) {
+            /* inflate the window for every segment that left the network */
+            tcb->cwnd += tcb->mss;
+        }
+        return true;
+    }
+
+    /* new data acknowledged */
+    acked = seg->ack - tcb->snd_una;
+    if ((tcb->flags & FLAG_RTT_TIMING) && SEQ_GEQ(seg->ack, tcb->rtt_seq)) {
+        _rtt_update(tcb, _ticks - tcb->rtt_start);
+        tcb->flags &= ~FLAG_RTT_TIMING;
+    }
+    while (cib_avail(&tcb->snd_cib) > 0) {
+        gnrc_tcp_seg_t *first = _seg(tcb, tcb->snd_cib.read_count);
+
+        if (SEQ_GT(first->seq + first->data->size, seg->ack)) {
+            break;
+        }
+        tcb->snd_queued -= first->data->size;
+        gnrc_pktbuf_release(first->data);
+        cib_get(&tcb->snd_cib);
+    }
+    if ((int)(tcb->snd_next - tcb->snd_cib.read_count) < 0) {
+        tcb->snd_next = tcb->snd_cib.read_count;
+    }
+    tcb->snd_una = seg->ack;
+    if (SEQ_LT(tcb->snd_nxt, tcb->snd_una)) {
+        tcb->snd_nxt = tcb->snd_una;
+    }
+    tcb->snd_wnd = seg->wnd;
+    tcb->snd_wl1 = seg->seq;
+    tcb->snd_wl2 = seg->ack;
+
+    if (tcb->flags & FLAG_RECOVERY) {
+        if (SEQ_GEQ(seg->ack, tcb->recover)) {
+            /* full acknowledgement: leave fast recovery */
+            tcb->cwnd = _min(tcb->ssthresh, _flight(tcb) + tcb->mss);
+            tcb->flags &= ~FLAG_RECOVERY;
+        }
+        else {
+            /* partial acknowledgement: the next segment was lost, too */
+            if (cib_avail(&tcb->snd_cib) > 0) {
+                gnrc_tcp_seg_t *first = _seg(tcb, tcb->snd_cib.read_count);
+
+                _xmit(tcb, first->seq, TCP_FLAG_PSH, first->data);
+            }
+            tcb->cwnd -= _min(acked, tcb->cwnd);
+            tcb->cwnd += tcb->mss;
+        }
+    }
+    else if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += _min(acked, tcb->mss);
+    }
+    else {
+        tcb->cwnd += _max((tcb->mss * tcb->mss) / tcb->cwnd, 1);
+    }
+    tcb->dupacks = 0;
+    tcb->retries = 0;
+
+    if (_flight(tcb) == 0) {
+        _timer_stop(&tcb->rtx_timer);
+    }
+    else {
+        _rtx_arm(tcb);
+    }
+    _send_resume(tcb);
+    return true;
+}
+
+static bool _fin_acked(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->flags & FLAG_FIN_SENT) && (tcb->snd_una == tcb->snd_max);
+}
+
+static void _time_wait(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->state = GNRC_TCP_STATE_TIME_WAIT;
+    _timer_stop(&tcb->ack_timer);
+    _timer_set(&tcb->rtx_timer, MS_TO_TICKS(GNRC_TCP_TIME_WAIT_MS));
+}
+
+/* queues the payload if it is the next in sequence */
+static void _data_input(gnrc_tcp_tcb_t *tcb, _seg_t *seg, gnrc_pktsnip_t **payload)
+{
+    gnrc_pktsnip_t *data = *payload;
+    uint32_t room;
+
+    if (SEQ_LT(seg->seq, tcb->rcv_nxt)) {
+        /* trim what was already received */
+        uint32_t dup = tcb->rcv_nxt - seg->seq;
+
+        tcb->flags |= FLAG_ACK_NOW;
+        if (dup >= data->size) {
+            return;
+        }
+        gnrc_pktsnip_t *old = gnrc_pktbuf_mark(data, dup, GNRC_NETTYPE_UNDEF);
+        if (old == NULL) {
+            return;
+        }
+        gnrc_pktbuf_remove_snip(data, old);
+        seg->seq += dup;
+    }
+    if (seg->seq != tcb->rcv_nxt) {
+        /* out of order: send a duplicate ACK to trigger fast retransmit */
+        tcb->flags |= FLAG_ACK_NOW;
+        return;
+    }
+    if (tcb->flags & FLAG_ORPHAN) {
+        /* nobody reads anymore */
+        tcb->rcv_nxt += data->size;
+        tcb->flags |= FLAG_ACK_NOW;
+        return;
+    }
+    room = _rcv_space(tcb);
+    if (room == 0) {
+        tcb->flags |= FLAG_ACK_NOW;
+        return;
+    }
+    if ((data->size > room) && (gnrc_pktbuf_realloc_data(data, room) != 0)) {
+        return;
+    }
+    /* keep the payload only */
+    gnrc_pktbuf_release(data->next);
+    data->next = NULL;
+    tcb->rcv_segs[cib_put(&tcb->rcv_cib)] = data;
+    tcb->rcv_queued += data->size;
+    tcb->rcv_nxt += data->size;
+    *payload = NULL;
+
+    /* acknowledge every second segment immediately (RFC 1122, 4.2.3.2) */
+    if (tcb->flags & FLAG_ACK_DELAYED) {
+        tcb->flags |= FLAG_ACK_NOW;
+    }
+    else {
+        tcb->flags |= FLAG_ACK_DELAYED;
+        _timer_set(&tcb->ack_timer, MS_TO_TICKS(GNRC_TCP_DELACK_MS));
+    }
+    _recv_resume(tcb);
+}
+
+static void _fin_input(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->rcv_nxt++;
+    tcb->flags |= FLAG_FIN_RCVD | FLAG_ACK_NOW;
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_SYN_RCVD:
+        case GNRC_TCP_STATE_ESTABLISHED:
+            tcb->state = GNRC_TCP_STATE_CLOSE_WAIT;
+            break;
+        case GNRC_TCP_STATE_FIN_WAIT_1:
+            if (_fin_acked(tcb)) {
+                _time_wait(tcb);
+            }
+            else {
+                tcb->state = GNRC_TCP_STATE_CLOSING;
+            }
+            break;
+        case GNRC_TCP_STATE_FIN_WAIT_2:
+            _time_wait(tcb);
+            break;
+        default:
+            break;
+    }
+    _recv_resume(tcb);
+}
+
+static void _input(gnrc_tcp_tcb_t *tcb, _seg_t *seg, gnrc_pktsnip_t **payload,
+                   size_t seg_len)
+{
+    size_t data_len = (*payload != NULL) ? (*payload)->size : 0;
+    uint32_t fin_seq = seg->seq + data_len;
+    uint32_t wnd = tcb->rcv_adv - tcb->rcv_nxt;
+    bool acceptable;
+
+    /* RFC 793, 3.3: segment acceptability */
+    if (seg_len == 0) {
+        acceptable = (wnd == 0) ? (seg->seq == tcb->rcv_nxt) :
+                     (SEQ_GEQ(seg->seq, tcb->rcv_nxt) &&
+                      SEQ_LT(seg->seq, tcb->rcv_nxt + wnd));
+    }
+    else {
+        acceptable = SEQ_LT(seg->seq, tcb->rcv_nxt + _max(wnd, 1)) &&
+                     SEQ_GT(seg->seq + seg_len, tcb->rcv_nxt);
+    }
+    if (!acceptable) {
+        if (!(seg->flags & TCP_FLAG_RST)) {
+            tcb->flags |= FLAG_ACK_NOW;
+            _output(tcb);
+        }
+        return;
+    }
+    if (seg->flags & TCP_FLAG_RST) {
+        _abort(tcb, -ECONNRESET);
+        return;
+    }
+    if (seg->flags & TCP_FLAG_SYN) {
+        _xmit(tcb, tcb->snd_nxt, TCP_FLAG_RST, NULL);
+        _abort(tcb, -ECONNRESET);
+        return;
+    }
+    if (!(seg->flags & TCP_FLAG_ACK)) {
+        return;
+    }
+
+    if (tcb->state == GNRC_TCP_STATE_SYN_RCVD) {
+        if (SEQ_LEQ(seg->ack, tcb->iss) || SEQ_GT(seg->ack, tcb->snd_max)) {
+            _xmit(tcb, seg->ack, TCP_FLAG_RST, NULL);
+            return;
+        }
+        _established(tcb, seg);
+        if (tcb->parent != NULL) {
+            _accept_resume(tcb->parent);
+        }
+        else {
+            _wake(&tcb->rcv_waiter, 0);
+        }
+    }
+    else if (!_ack_input(tcb, seg, data_len)) {
+        _output(tcb);
+        return;
+    }
+
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_FIN_WAIT_1:
+            if (_fin_acked(tcb)) {
+                tcb->state = GNRC_TCP_STATE_FIN_WAIT_2;
+                if (tcb->flags & FLAG_ORPHAN) {
+                    /* nobody waits for the peer's FIN, don't wait forever */
+                    _timer_set(&tcb->rtx_timer,
+                               MS_TO_TICKS(GNRC_TCP_FIN_WAIT_2_MS));
+                }
+            }
+            break;
+        case GNRC_TCP_STATE_CLOSING:
+            if (_fin_acked(tcb)) {
+                _time_wait(tcb);
+            }
+            break;
+        case GNRC_TCP_STATE_LAST_ACK:
+            if (_fin_acked(tcb)) {
+                _free(tcb);
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_ESTABLISHED:
+        case GNRC_TCP_STATE_FIN_WAIT_1:
+        case GNRC_TCP_STATE_FIN_WAIT_2:
+            if (data_len > 0) {
+                _data_input(tcb, seg, payload);
+            }
+            /* only a FIN following all received data is processed */
+            if ((seg->flags & TCP_FLAG_FIN) && (fin_seq == tcb->rcv_nxt)) {
+                _fin_input(tcb);
+            }
+            break;
+        case GNRC_TCP_STATE_TIME_WAIT:
+            if (seg->flags & TCP_FLAG_FIN) {
+                /* FIN was retransmitted: our ACK got lost */
+                tcb->flags |= FLAG_ACK_NOW;
+                _time_wait(tcb);
+            }
+            break;
+        default:
+            break;
+    }
+    _output(tcb);
+}
+
+static void _parse_options(_seg_t *seg, const tcp_hdr_t *hdr)
+{
+    const uint8_t *opt = (const uint8_t *)(hdr + 1);
+    const uint8_t *end = (const uint8_t *)hdr + tcp_hdr_get_len(hdr);
+
+    while (opt < end) {
+        if (*opt == TCP_OPTION_KIND_EOL) {
+            break;
+        }
+        if (*opt == TCP_OPTION_KIND_NOP) {
+            opt++;
+            continue;
+        }
+        if (((opt + 1) >= end) || (opt[1] < 2) || ((opt + opt[1]) > end)) {
+            break;
+        }
+        if ((opt[0] == TCP_OPTION_KIND_MSS) && (opt[1] == TCP_OPTION_LENGTH_MSS)) {
+            seg->mss = (opt[2] << 8) | opt[3];
+        }
+        opt += opt[1];
+    }
+}
+
+static void _receive(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *tcp, *ipv6, *netif, *payload;
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
+    gnrc_tcp_tcb_t *tcb;
+    tcp_hdr_t *hdr;
+    ipv6_hdr_t *ip;
+    _seg_t seg;
+    size_t hdr_len, seg_len;
+
+    /* mark TCP header */
+    tcp = gnrc_pktbuf_start_write(pkt);
+    if (tcp == NULL) {
+        DEBUG("tcp: unable to get write access to packet\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    pkt = tcp;
+
+    ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    assert(ipv6 != NULL);
+
+    if (netif != NULL) {
+        iface = ((gnrc_netif_hdr_t *)netif->data)->if_pid;
+    }
+    if ((pkt->size < TCP_HDR_MIN_SIZE) ||
+        ((hdr_len = tcp_hdr_get_len(pkt->data)) < TCP_HDR_MIN_SIZE) ||
+        (hdr_len > pkt->size)) {
+        DEBUG("tcp: malformed header, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if (hdr_len < pkt->size) {
+        tcp = gnrc_pktbuf_mark(pkt, hdr_len, GNRC_NETTYPE_TCP);
+        if (tcp == NULL) {
+            DEBUG("tcp: error marking TCP header, dropping packet\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        /* mark payload as Type: UNDEF */
+        pkt->type = GNRC_NETTYPE_UNDEF;
+        payload = pkt;
+    }
+    else {
+        pkt->type = GNRC_NETTYPE_TCP;
+        payload = NULL;
+    }
+    hdr = tcp->data;
+    ip = ipv6->data;
+
+    if (_calc_csum(tcp, ipv6, payload) != 0) {
+        DEBUG("tcp: received packet with invalid checksum, dropping it\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+
+    seg.seq = byteorder_ntohl(hdr->seq_num);
+    seg.ack = byteorder_ntohl(hdr->ack_num);
+    seg.flags = tcp_hdr_get_flags(hdr);
+    seg.wnd = byteorder_ntohs(hdr->window);
+    seg.mss = 0;
+    if (seg.flags & TCP_FLAG_SYN) {
+        _parse_options(&seg, hdr);
+    }
+    seg_len = ((payload != NULL) ? payload->size : 0) +
+              ((seg.flags & TCP_FLAG_SYN) ? 1 : 0) +
+              ((seg.flags & TCP_FLAG_FIN) ? 1 : 0);
+
+    tcb = _lookup(ip, hdr);
+    if (tcb == NULL) {
+        DEBUG("tcp: no connection for segment, sending RST\n");
+        _send_rst(ip, hdr, seg_len, iface);
+    }
+    else if (tcb->state == GNRC_TCP_STATE_LISTEN) {
+        _listen_input(tcb, &seg, ip, hdr, seg_len, iface);
+    }
+    else if (tcb->state == GNRC_TCP_STATE_SYN_SENT) {
+        _syn_sent_input(tcb, &seg, ip, hdr, seg_len, iface);
+    }
+    else {
+        gnrc_pktsnip_t *data = payload;
+
+        _input(tcb, &seg, &payload, seg_len);
+        if ((data != NULL) && (payload == NULL)) {
+            /* _data_input() queued the payload and released the headers
+             * behind it, so pkt is gone */
+            return;
+        }
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+/* requests */
+/* connections of the same port may coexist, but only one may be bound to it
+ * without a peer; ephemeral ports are not shared at all */
+static bool _port_in_use(uint16_t port, bool ephemeral)
+{
+    for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+        const gnrc_tcp_tcb_t *tcb = &_tcbs[i];
+
+        if ((tcb->flags & FLAG_USED) && (tcb->local_port == port) &&
+            (ephemeral || (tcb->state == GNRC_TCP_STATE_CLOSED) ||
+             (tcb->state == GNRC_TCP_STATE_LISTEN))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _open(_req_t *req)
+{
+    uint16_t port = req->port;
+    gnrc_tcp_tcb_t *tcb;
+
+    if (port == 0) {
+        do {
+            port = EPHEMERAL_PORT_MIN + (_next_port++ % (UINT16_MAX - EPHEMERAL_PORT_MIN + 1));
+        } while (_port_in_use(port, true));
+    }
+    else if (_port_in_use(port, false)) {
+        return -EADDRINUSE;
+    }
+    if ((tcb = _alloc()) == NULL) {
+        return -ENOMEM;
+    }
+    tcb->local_addr = *req->addr;
+    tcb->local_port = port;
+    req->tcb = tcb;
+    return 0;
+}
+
+static int _connect(gnrc_tcp_tcb_t *tcb, _req_t *req, msg_t *msg)
+{
+    if (tcb->state != GNRC_TCP_STATE_CLOSED) {
+        return -EISCONN;
+    }
+    if (ipv6_addr_is_unspecified(&tcb->local_addr)) {
+        kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+        size_t ifnum = gnrc_netif_get(ifs);
+        ipv6_addr_t *src = NULL;
+
+        for (size_t i = 0; (i < ifnum) && (src == NULL); i++) {
+            src = gnrc_ipv6_netif_find_best_src_addr(ifs[i], req->addr, false);
+            if ((src != NULL) && ipv6_addr_is_link_local(req->addr)) {
+                tcb->iface = ifs[i];
+            }
+        }
+        if (src == NULL) {
+            return -ENETUNREACH;
+        }
+        tcb->local_addr = *src;
+    }
+    tcb->peer_addr = *req->addr;
+    tcb->peer_port = req->port;
+    tcb->error = 0;
+    _init_conn(tcb);
+    tcb->state = GNRC_TCP_STATE_SYN_SENT;
+    _xmit(tcb, tcb->iss, TCP_FLAG_SYN, NULL);
+    _rtx_arm(tcb);
+    tcb->rcv_waiter = *msg;
+    return DEFERRED;
+}
+
+static int _close(gnrc_tcp_tcb_t *tcb)
+{
+    int idx;
+
+    _wake(&tcb->rcv_waiter, -EBADF);
+    _wake(&tcb->snd_waiter, -EBADF);
+    switch (tcb->state) {
+        case GNRC_TCP_STATE_LISTEN:
+            for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+                if ((_tcbs[i].flags & FLAG_USED) && (_tcbs[i].parent == tcb)) {
+                    _xmit(&_tcbs[i], _tcbs[i].snd_nxt, TCP_FLAG_RST, NULL);
+                    _free(&_tcbs[i]);
+                }
+            }
+            _free(tcb);
+            return 0;
+        case GNRC_TCP_STATE_CLOSED:
+        case GNRC_TCP_STATE_SYN_SENT:
+            _free(tcb);
+            return 0;
+        case GNRC_TCP_STATE_SYN_RCVD:
+        case GNRC_TCP_STATE_ESTABLISHED:
+            tcb->state = GNRC_TCP_STATE_FIN_WAIT_1;
+            break;
+        case GNRC_TCP_STATE_CLOSE_WAIT:
+            tcb->state = GNRC_TCP_STATE_LAST_ACK;
+            break;
+        default:
+            break;
+    }
+    /* nobody reads the received data anymore */
+    while ((idx = cib_get(&tcb->rcv_cib)) >= 0) {
+        gnrc_pktbuf_release(tcb->rcv_segs[idx]);
+    }
+    tcb->rcv_queued = 0;
+    tcb->rcv_offset = 0;
+    /* the connection lives on until the FIN is acknowledged */
+    tcb->flags |= FLAG_ORPHAN | FLAG_FIN_PENDING;
+    _output(tcb);
+    return 0;
+}
+
+/* handles a request, returns DEFERRED if the answer follows later */
+static int _request(msg_t *msg)
+{
+    _req_t *req = msg->content.ptr;
+    gnrc_tcp_tcb_t *tcb = req->tcb;
+    int res;
+
+    if ((msg->type != MSG_TYPE_OPEN) && !_valid(tcb)) {
+        return -EBADF;
+    }
+    switch (msg->type) {
+        case MSG_TYPE_OPEN:
+            res = _open(req);
+            break;
+        case MSG_TYPE_CONNECT:
+            res = _connect(tcb, req, msg);
+            break;
+        case MSG_TYPE_LISTEN:
+            if (tcb->state != GNRC_TCP_STATE_CLOSED) {
+                res = -EISCONN;
+                break;
+            }
+            tcb->state = GNRC_TCP_STATE_LISTEN;
+            tcb->backlog = (uint8_t)_max(_min(req->len, GNRC_TCP_TCB_NUMOF), 1);
+            res = 0;
+            break;
+        case MSG_TYPE_ACCEPT:
+            if (tcb->state != GNRC_TCP_STATE_LISTEN) {
+                res = -EINVAL;
+                break;
+            }
+            if (tcb->rcv_waiter.sender_pid != KERNEL_PID_UNDEF) {
+                res = -EALREADY;
+                break;
+            }
+            if ((req->tcb = _accept_next(tcb)) != NULL) {
+                res = 0;
+                break;
+            }
+            tcb->rcv_waiter = *msg;
+            res = DEFERRED;
+            break;
+        case MSG_TYPE_SEND:
+            if (tcb->snd_waiter.sender_pid != KERNEL_PID_UNDEF) {
+                res = -EALREADY;
+                break;
+            }
+            res = _send_result(tcb, req);
+            if (res == DEFERRED) {
+                tcb->snd_waiter = *msg;
+            }
+            break;
+        case MSG_TYPE_RECV:
+            if ((tcb->state == GNRC_TCP_STATE_LISTEN) ||
+                (tcb->state == GNRC_TCP_STATE_SYN_SENT)) {
+                res = -ENOTCONN;
+                break;
+            }
+            if (tcb->rcv_waiter.sender_pid != KERNEL_PID_UNDEF) {
+                res = -EALREADY;
+                break;
+            }
+            res = _recv_result(tcb, req);
+            if (res == DEFERRED) {
+                tcb->rcv_waiter = *msg;
+            }
+            break;
+        case MSG_TYPE_CLOSE:
+            res = _close(tcb);
+            break;
+        default:
+            res = -ENOTSUP;
+            break;
+    }
+    return res;
+}
+
+static void *_event_loop(void *arg)
+{
+    (void)arg;
+    msg_t msgs[GNRC_NETAPI_MSG_BULK], reply;
+    msg_t msg_queue[GNRC_TCP_MSG_QUEUE_SIZE];
+    int num;
+    gnrc_netreg_entry_t netreg;
+
+    /* preset reply message */
+    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+    reply.content.value = (uint32_t)-ENOTSUP;
+    /* initialize message queue */
+    msg_init_queue(msg_queue, GNRC_TCP_MSG_QUEUE_SIZE);
+    _tick_msg.type = MSG_TYPE_TICK;
+    /* register TCP at netreg */
+    gnrc_netreg_entry_init_pid(&netreg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_TCP, &netreg);
+
+    /* dispatch NETAPI messages and requests */
+    while (1) {
+        num = msg_receive_bulk(msgs, GNRC_NETAPI_MSG_BULK);
+
+        for (int i = 0; i < num; i++) {
+            msg_t *msg = &msgs[i];
+
+            switch (msg->type) {
+                case GNRC_NETAPI_MSG_TYPE_RCV:
+                    DEBUG("tcp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+                    _receive(msg->content.ptr);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_SND:
+                    DEBUG("tcp: segments are only sent by connections\n");
+                    gnrc_pktbuf_release(msg->content.ptr);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_SET:
+                case GNRC_NETAPI_MSG_TYPE_GET:
+                    msg_reply(msg, &reply);
+                    break;
+                case MSG_TYPE_TICK:
+                    _tick();
+                    break;
+                case MSG_TYPE_OPEN:
+                case MSG_TYPE_CONNECT:
+                case MSG_TYPE_LISTEN:
+                case MSG_TYPE_ACCEPT:
+                case MSG_TYPE_SEND:
+                case MSG_TYPE_RECV:
+                case MSG_TYPE_CLOSE: {
+                    int res = _request(msg);
+
+                    if (res != DEFERRED) {
+                        _reply(msg, res);
+                    }
+                    break;
+                }
+                default:
+                    DEBUG("tcp: received unidentified message\n");
+                    break;
+            }
+        }
+        /* xtimer drops the tick if the message queue is full */
+        if (_ticking && ((int32_t)(xtimer_now() - _tick_due) > (int32_t)GNRC_TCP_TICK_US)) {
+            xtimer_remove(&_tick_timer);
+            _tick();
+        }
+    }
+
+    /* never reached */
+    return NULL;
+}
+
+static int _call(uint16_t type, _req_t *req)
+{
+    msg_t msg, reply;
+
+    msg.type = type;
+    msg.content.ptr = req;
+#ifdef TEST_SUITES
+    if (_pid == KERNEL_PID_UNDEF) {
+        /* without the TCP thread the tests drive TCP from their thread */
+        int res;
+
+        msg.sender_pid = KERNEL_PID_UNDEF;
+        res = _request(&msg);
+        return (res == DEFERRED) ? -EINPROGRESS : res;
+    }
+#endif
+    if (_pid == KERNEL_PID_UNDEF) {
+        return -ENOTSUP;
+    }
+    msg_send_receive(&msg, &reply, _pid);
+    return (int)reply.content.value;
+}
+
+int gnrc_tcp_open(gnrc_tcp_tcb_t **tcb, const ipv6_addr_t *addr, uint16_t port)
+{
+    _req_t req = { .addr = addr, .port = port };
+    int res = _call(MSG_TYPE_OPEN, &req);
+
+    if (res == 0) {
+        *tcb = req.tcb;
+    }
+    return res;
+}
+
+int gnrc_tcp_connect(gnrc_tcp_tcb_t *tcb, const ipv6_addr_t *addr, uint16_t port)
+{
+    _req_t req = { .tcb = tcb, .addr = addr, .port = port };
+
+    return _call(MSG_TYPE_CONNECT, &req);
+}
+
+int gnrc_tcp_listen(gnrc_tcp_tcb_t *tcb, unsigned backlog)
+{
+    _req_t req = { .tcb = tcb, .len = backlog };
+
+    return _call(MSG_TYPE_LISTEN, &req);
+}
+
+int gnrc_tcp_accept(gnrc_tcp_tcb_t *tcb, gnrc_tcp_tcb_t **out)
+{
+    _req_t req = { .tcb = tcb };
+    int res = _call(MSG_TYPE_ACCEPT, &req);
+
+    if (res == 0) {
+        *out = req.tcb;
+    }
+    return res;
+}
+
+int gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, size_t len)
+{
+    _req_t req = { .tcb = tcb, .data = (void *)data, .len = len };
+
+    return _call(MSG_TYPE_SEND, &req);
+}
+
+int gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, size_t max_len)
+{
+    _req_t req = { .tcb = tcb, .data = data, .len = max_len };
+
+    return _call(MSG_TYPE_RECV, &req);
+}
+
+void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
+{
+    _req_t req = { .tcb = tcb };
+
+    _call(MSG_TYPE_CLOSE, &req);
+}
+
+int gnrc_tcp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
+{
+    uint16_t csum;
+
+    if ((hdr == NULL) || (pseudo_hdr == NULL)) {
+        return -EFAULT;
+    }
+    if (hdr->type != GNRC_NETTYPE_TCP) {
+        return -EBADMSG;
+    }
+    if (pseudo_hdr->type != GNRC_NETTYPE_IPV6) {
+        return -ENOENT;
+    }
+
+    ((tcp_hdr_t *)hdr->data)->checksum = byteorder_htons(0);
+    csum = _calc_csum(hdr, pseudo_hdr, hdr->next);
+    ((tcp_hdr_t *)hdr->data)->checksum = byteorder_htons(csum);
+    return 0;
+}
+
+int gnrc_tcp_init(void)
+{
+    /* check if thread is already running */
+    if (_pid == KERNEL_PID_UNDEF) {
+        _next_port = (uint16_t)random_uint32();
+        /* start TCP thread */
+        _pid = thread_create(_stack, sizeof(_stack), GNRC_TCP_PRIO,
+                             THREAD_CREATE_STACKTEST, _event_loop, NULL, "tcp");
+    }
+    return _pid;
+}
+
+#ifdef TEST_SUITES
+void gnrc_tcp_test_receive(gnrc_pktsnip_t *pkt)
+{
+    _receive(pkt);
+}
+
+void gnrc_tcp_test_tick(void)
+{
+    _tick();
+}
+
+void gnrc_tcp_test_reset(void)
+{
+    for (unsigned i = 0; i < GNRC_TCP_TCB_NUMOF; i++) {
+        if (_tcbs[i].flags & FLAG_USED) {
+            _free(&_tcbs[i]);
+        }
+    }
+}
+#endif
@@ -28,6 +28,9 @@
 #include "net/gnrc/udp.h"
 #include "net/gnrc.h"
 #include "net/inet_csum.h"
+#ifdef MODULE_GNRC_EVENT
+#include "net/gnrc/event_thread.h"
+#endif
 
 
 #define ENABLE_DEBUG    (0)
@@ -38,6 +41,22 @@
  */
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#ifdef MODULE_GNRC_EVENT
+/**
+ * @brief   UDP's adapter to the shared event thread
+ */
+static gnrc_event_netapi_t _ev;
+
+/**
+ * @brief   Ring of pending messages for the shared event thread
+ */
+static msg_t _ev_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+
+/**
+ * @brief   UDP's netreg entry
+ */
+static gnrc_netreg_entry_t _netreg;
+#else
 /**
  * @brief   Allocate memory for the UDP thread's stack
  */
@@ -46,6 +65,7 @@ static char _stack[GNRC_UDP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_UDP_STACK_SIZE];
 #endif
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -209,11 +229,30 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_EVENT
+static void _event_handler(uint16_t type, void *ptr)
+{
+    switch (type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+            _receive(ptr);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+            _send(ptr);
+            break;
+        default:
+            DEBUG("udp: received unidentified message\n");
+            break;
+    }
+}
+#else
 static void *_event_loop(void *arg)
 {
     (void)arg;
-    msg_t msg, reply;
+    msg_t msgs[GNRC_NETAPI_MSG_BULK], reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+    int num;
     gnrc_netreg_entry_t netreg;
 
     /* preset reply message */
@@ -222,35 +261,41 @@ static void *_event_loop(void *arg)
     /* initialize message queue */
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
-    netreg.demux_ctx = GNRC_NETREG_DEMUX_CTX_ALL;
-    netreg.pid = thread_getpid();
+    gnrc_netreg_entry_init_pid(&netreg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
 
     /* dispatch NETAPI messages */
     while (1) {
-        msg_receive(&msg);
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
-                _receive(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
-                _send(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                DEBUG("udp: received unidentified message\n");
-                break;
+        num = msg_receive_bulk(msgs, GNRC_NETAPI_MSG_BULK);
+
+        for (int i = 0; i < num; i++) {
+            msg_t *msg = &msgs[i];
+
+            switch (msg->type) {
+                case GNRC_NETAPI_MSG_TYPE_RCV:
+                    DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+                    _receive(msg->content.ptr);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_SND:
+                    DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+                    _send(msg->content.ptr);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_SET:
+                case GNRC_NETAPI_MSG_TYPE_GET:
+                    msg_reply(msg, &reply);
+                    break;
+                default:
+                    DEBUG("udp: received unidentified message\n");
+                    break;
+            }
         }
     }
 
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -294,9 +339,19 @@ int gnrc_udp_init(void)
 {
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
+#ifdef MODULE_GNRC_EVENT
+        /* run UDP on the shared event thread */
+        _pid = gnrc_event_init();
+        if (_pid > KERNEL_PID_UNDEF) {
+            gnrc_event_netapi_init(&_ev, &_netreg, GNRC_NETTYPE_UDP,
+                                   _event_handler, _ev_queue,
+                                   GNRC_UDP_MSG_QUEUE_SIZE);
+        }
+#else
         /* start UDP thread */
         _pid = thread_create(_stack, sizeof(_stack), GNRC_UDP_PRIO,
                              THREAD_CREATE_STACKTEST, _event_loop, NULL, "udp");
+#endif
     }
     return _pid;
 }
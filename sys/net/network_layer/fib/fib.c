@@ -224,6 +224,78 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
     return 0;
 }
 
+#ifdef MODULE_FIB_DYNAMIC
+/**
+ * @brief grows a single hop table by FIB_DYNAMIC_GROW_STEP entries,
+ *        but not beyond its max_size
+ *
+ * @param[in] table          the FIB table to grow
+ *
+ * @return 0 on success
+ *         -ENOMEM if the table cannot grow
+ */
+static int fib_grow(fib_table_t *table)
+{
+    if (table->size >= table->max_size) {
+        return -ENOMEM;
+    }
+
+    size_t size = table->size + FIB_DYNAMIC_GROW_STEP;
+
+    if (size > table->max_size) {
+        size = table->max_size;
+    }
+
+    fib_entry_t *entries = realloc(table->data.entries, size * sizeof(fib_entry_t));
+
+    if (entries == NULL) {
+        return -ENOMEM;
+    }
+
+    DEBUG("[fib_grow] growing table from %u to %u entries\n",
+          (unsigned)table->size, (unsigned)size);
+    memset(&entries[table->size], 0, (size - table->size) * sizeof(fib_entry_t));
+    table->data.entries = entries;
+    table->size = size;
+
+    return 0;
+}
+
+/**
+ * @brief shrinks a grown single hop table to its last used entry, but keeps
+ *        FIB_DYNAMIC_GROW_STEP spare entries and at least min_size entries
+ *
+ * @param[in] table          the FIB table to shrink
+ */
+static void fib_shrink(fib_table_t *table)
+{
+    size_t size = table->size;
+
+    while ((size > 0) && (table->data.entries[size - 1].lifetime == 0)) {
+        --size;
+    }
+
+    size += FIB_DYNAMIC_GROW_STEP;
+
+    if (size < table->min_size) {
+        size = table->min_size;
+    }
+
+    if ((table->max_size == 0) || (size >= table->size)) {
+        return;
+    }
+
+    fib_entry_t *entries = realloc(table->data.entries, size * sizeof(fib_entry_t));
+
+    if (entries != NULL) {
+        DEBUG("[fib_shrink] shrinking table from %u to %u entries\n",
+              (unsigned)table->size, (unsigned)size);
+        table->data.entries = entries;
+        table->size = size;
+    }
+}
+#endif
+
 /**
  * @brief creates a new FIB entry with the provided parameters
  *
@@ -245,34 +317,56 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+    fib_entry_t *entry = NULL;
+
     for (size_t i = 0; i < table->size; ++i) {
         if (table->data.entries[i].lifetime == 0) {
+            entry = &table->data.entries[i];
+            break;
+        }
+    }
 
-            table->data.entries[i].global = universal_address_add(dst, dst_size);
+#ifdef MODULE_FIB_DYNAMIC
+    if (entry == NULL) {
+        size_t pos = table->size;
 
-            if (table->data.entries[i].global != NULL) {
-                table->data.entries[i].global_flags = dst_flags;
-                table->data.entries[i].next_hop = universal_address_add(next_hop, next_hop_size);
-                table->data.entries[i].next_hop_flags = next_hop_flags;
-            }
+        if (fib_grow(table) == 0) {
+            entry = &table->data.entries[pos];
+        }
+    }
+#endif
 
-            if (table->data.entries[i].next_hop != NULL) {
-                /* everything worked fine */
-                table->data.entries[i].iface_id = iface_id;
+    if (entry == NULL) {
+        return -ENOMEM;
+    }
 
-                if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
-                    fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
-                }
-                else {
-                    table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
-                }
+    entry->global = universal_address_add(dst, dst_size);
 
-                return 0;
-            }
-        }
+    if (entry->global == NULL) {
+        return -ENOMEM;
     }
 
-    return -ENOMEM;
+    entry->next_hop = universal_address_add(next_hop, next_hop_size);
+
+    if (entry->next_hop == NULL) {
+        universal_address_rem(entry->global);
+        entry->global = NULL;
+        return -ENOMEM;
+    }
+
+    /* everything worked fine */
+    entry->global_flags = dst_flags;
+    entry->next_hop_flags = next_hop_flags;
+    entry->iface_id = iface_id;
+
+    if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
+        fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+    }
+    else {
+        entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
+    }
+
+    return 0;
 }
 
 /**
@@ -457,6 +551,9 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
     if (ret == 1) {
         /* we must take the according entry and update the values */
         fib_remove(entry[0]);
+#ifdef MODULE_FIB_DYNAMIC
+        fib_shrink(table);
+#endif
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -479,6 +576,9 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
             fib_remove(&table->data.entries[i]);
         }
     }
+#ifdef MODULE_FIB_DYNAMIC
+    fib_shrink(table);
+#endif
 
     mutex_unlock(&(table->mtx_access));
 }
@@ -592,8 +692,25 @@ void fib_init(fib_table_t *table)
                sizeof(fib_sr_t) * table->size);
         memset(table->data.source_routes->entry_pool, 0,
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
+        memset(table->data.source_routes->index, 0,
+               sizeof(table->data.source_routes->index));
     }
     else {
+#ifdef MODULE_FIB_DYNAMIC
+        if ((table->data.entries == NULL) && (table->size > 0)) {
+            table->data.entries = malloc(table->size * sizeof(fib_entry_t));
+            if (table->data.entries == NULL) {
+                DEBUG("[fib_init] cannot allocate %u entries\n", (unsigned)table->size);
+                /* empty, but the table may still grow later */
+                table->size = 0;
+                table->min_size = 0;
+                universal_address_init();
+                mutex_unlock(&(table->mtx_access));
+                return;
+            }
+        }
+        table->min_size = table->size;
+#endif
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
     universal_address_init();
@@ -617,9 +734,22 @@ void fib_deinit(fib_table_t *table)
                sizeof(fib_sr_t) * table->size);
         memset(table->data.source_routes->entry_pool, 0,
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
+        memset(table->data.source_routes->index, 0,
+               sizeof(table->data.source_routes->index));
     }
     else {
-        memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_DYNAMIC
+        if (table->max_size > 0) {
+            /* fib_init() allocates the entries again */
+            free(table->data.entries);
+            table->data.entries = NULL;
+            table->size = table->min_size;
+        }
+        else
+#endif
+        {
+            memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        }
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
@@ -697,25 +827,77 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
     return -ENOBUFS;
 }
 
+/**
+* @brief Internal function:
+*        returns the head of the destination index bucket for the given container
+*/
+static fib_sr_entry_t **fib_sr_index_bucket(fib_table_t *table,
+                                            universal_address_container_t *address)
+{
+    size_t i = ((uintptr_t)address / sizeof(universal_address_container_t)) % FIB_SR_INDEX_SIZE;
+    return &table->data.source_routes->index[i];
+}
+
+/**
+* @brief Internal function:
+*        adds a hop entry to the destination index
+*/
+static void fib_sr_index_add(fib_table_t *table, fib_sr_entry_t *entry)
+{
+    fib_sr_entry_t **bucket = fib_sr_index_bucket(table, entry->address);
+    entry->index_next = *bucket;
+    *bucket = entry;
+}
+
+/**
+* @brief Internal function:
+*        releases a hop entry and removes it from the destination index
+*/
+static void fib_sr_free_entry(fib_table_t *table, fib_sr_entry_t *entry)
+{
+    fib_sr_entry_t **elt = fib_sr_index_bucket(table, entry->address);
+
+    while (*elt != NULL) {
+        if (*elt == entry) {
+            *elt = entry->index_next;
+            break;
+        }
+        elt = &(*elt)->index_next;
+    }
+
+    universal_address_rem(entry->address);
+    entry->address = NULL;
+    entry->next = NULL;
+    entry->index_next = NULL;
+    entry->sr = NULL;
+}
+
+/**
+* @brief Internal function:
+*        releases all hop entries of a source route
+*/
+static void fib_sr_free_path(fib_table_t *table, fib_sr_t *fib_sr)
+{
+    fib_sr_entry_t *elt, *tmp;
+    LL_FOREACH_SAFE(fib_sr->sr_path, elt, tmp) {
+        fib_sr_free_entry(table, elt);
+    }
+    fib_sr->sr_path = NULL;
+    fib_sr->sr_dest = NULL;
+}
+
 /**
 * @brief Internal function:
 *        checks the lifetime and removes the entry in case it expired
 */
-static int fib_sr_check_lifetime(fib_sr_t *fib_sr)
+static int fib_sr_check_lifetime(fib_table_t *table, fib_sr_t *fib_sr)
 {
     uint64_t tm = fib_sr->sr_lifetime - xtimer_now64();
     /* check if the lifetime expired */
     if ((int64_t)tm < 0) {
         /* remove this sr if its lifetime expired */
         fib_sr->sr_lifetime = 0;
-
-        if (fib_sr->sr_path != NULL) {
-            fib_sr_entry_t *elt;
-            LL_FOREACH(fib_sr->sr_path, elt) {
-                universal_address_rem(elt->address);
-            }
-            fib_sr->sr_path = NULL;
-        }
+        fib_sr_free_path(table, fib_sr);
 
         /* and return an errorcode */
         return -ENOENT;
@@ -723,24 +905,46 @@ static int fib_sr_check_lifetime(fib_sr_t *fib_sr)
     return 0;
 }
 
+/**
+* @brief Internal function:
+*        removes the expired source routes passing the given address
+*/
+static void fib_sr_index_purge(fib_table_t *table, universal_address_container_t *address)
+{
+    fib_sr_entry_t **bucket = fib_sr_index_bucket(table, address);
+    fib_sr_entry_t *elt = *bucket;
+
+    while (elt != NULL) {
+        if ((elt->address == address)
+            && (fib_sr_check_lifetime(table, elt->sr) == -ENOENT)) {
+            /* the route left the bucket, so we start over */
+            elt = *bucket;
+        }
+        else {
+            elt = elt->index_next;
+        }
+    }
+}
+
 /**
 * @brief Internal function:
 *        creates a new entry in the table entry pool for a hop in a source route
 */
-static int fib_sr_new_entry(fib_table_t *table, uint8_t *addr, size_t addr_size,
-                            fib_sr_entry_t **new_entry)
+static int fib_sr_new_entry(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr,
+                            size_t addr_size, fib_sr_entry_t **new_entry)
 {
     for (size_t i = 0; i < table->data.source_routes->entry_pool_size; ++i) {
-        if (table->data.source_routes->entry_pool[i].address == NULL) {
-            table->data.source_routes->entry_pool[i].address = universal_address_add(addr, addr_size);
-            if (table->data.source_routes->entry_pool[i].address == NULL) {
+        fib_sr_entry_t *entry = &table->data.source_routes->entry_pool[i];
+        if (entry->address == NULL) {
+            entry->address = universal_address_add(addr, addr_size);
+            if (entry->address == NULL) {
                 return -ENOMEM;
             }
-            else {
-                (void)new_entry;
-                *new_entry = &table->data.source_routes->entry_pool[i];
-                return 0;
-            }
+            entry->next = NULL;
+            entry->sr = fib_sr;
+            fib_sr_index_add(table, entry);
+            *new_entry = entry;
+            return 0;
         }
     }
     return -ENOMEM;
@@ -770,7 +974,7 @@ int fib_sr_read_head(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *iface_i
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -793,7 +997,7 @@ int fib_sr_read_destination(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -821,7 +1025,7 @@ int fib_sr_set(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *sr_iface_id,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -851,16 +1055,7 @@ int fib_sr_delete(fib_table_t *table, fib_sr_t *fib_sr)
     }
 
     fib_sr->sr_lifetime = 0;
-
-    if (fib_sr->sr_path != NULL) {
-        fib_sr_entry_t *elt, *tmp;
-        LL_FOREACH_SAFE(fib_sr->sr_path, elt, tmp) {
-            universal_address_rem(elt->address);
-            elt->address = NULL;
-            LL_DELETE(fib_sr->sr_path, elt);
-        }
-        fib_sr->sr_path = NULL;
-    }
+    fib_sr_free_path(table, fib_sr);
 
     mutex_unlock(&(table->mtx_access));
     return 0;
@@ -880,7 +1075,7 @@ int fib_sr_next(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_t **sr_path_e
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -914,19 +1109,17 @@ int fib_sr_search(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, size_t ad
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
 
-    fib_sr_entry_t *elt;
-    LL_FOREACH(fib_sr->sr_path, elt) {
-        size_t addr_size_match = addr_size << 3;
-        if (universal_address_compare(elt->address, addr, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
-
-            /* temporary workaround to calm compiler */
-            (void)sr_path_entry;
+    /* addresses are stored only once, so we compare the containers */
+    universal_address_container_t *container = universal_address_search(addr, addr_size);
 
+    for (fib_sr_entry_t *elt = (container != NULL) ? *fib_sr_index_bucket(table, container) : NULL;
+         elt != NULL; elt = elt->index_next) {
+        if ((elt->address == container) && (elt->sr == fib_sr)) {
             *sr_path_entry = elt;
             mutex_unlock(&(table->mtx_access));
             return 0;
@@ -947,7 +1140,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -962,7 +1155,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
     }
 
     fib_sr_entry_t *new_entry[1];
-    int ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
+    int ret = fib_sr_new_entry(table, fib_sr, addr, addr_size, &new_entry[0]);
 
     if (ret == 0) {
         fib_sr_entry_t *tmp = fib_sr->sr_dest;
@@ -992,7 +1185,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1014,7 +1207,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
     int ret = -ENOENT;
     if (found) {
         fib_sr_entry_t *new_entry[1];
-        ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
+        ret = fib_sr_new_entry(table, fib_sr, addr, addr_size, &new_entry[0]);
         if (ret == 0) {
             fib_sr_entry_t *remaining = sr_path_entry->next;
             sr_path_entry->next = new_entry[0];
@@ -1024,9 +1217,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
             else {
                 fib_sr_entry_t *elt, *tmp;
                 LL_FOREACH_SAFE(remaining, elt, tmp) {
-                    universal_address_rem(elt->address);
-                    elt->address = NULL;
-                    LL_DELETE(remaining, elt);
+                    fib_sr_free_entry(table, elt);
                 }
                 new_entry[0]->next = NULL;
                 fib_sr->sr_dest = new_entry[0];
@@ -1047,43 +1238,43 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
 
-    fib_sr_entry_t *elt, *tmp;
-    tmp = fib_sr->sr_path;
+    fib_sr_entry_t *elt, *prev = NULL;
     LL_FOREACH(fib_sr->sr_path, elt) {
         size_t addr_size_match = addr_size << 3;
 
         if (universal_address_compare(elt->address, addr, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
-            universal_address_rem(elt->address);
-            if (keep_remaining_route) {
-                tmp->next = elt->next;
-            }
-            else {
+            fib_sr_entry_t *remaining = elt->next;
+            if (!keep_remaining_route) {
                 fib_sr_entry_t *elt_del, *tmp_del;
-                LL_FOREACH_SAFE(tmp, elt_del, tmp_del) {
-                    universal_address_rem(elt_del->address);
-                    elt_del->address = NULL;
-                    LL_DELETE(tmp, elt_del);
+                LL_FOREACH_SAFE(remaining, elt_del, tmp_del) {
+                    fib_sr_free_entry(table, elt_del);
                 }
+                remaining = NULL;
             }
-            if (elt == fib_sr->sr_path) {
+            if (prev == NULL) {
                 /* if we remove the first entry we must adjust the path start */
-                fib_sr->sr_path = elt->next;
+                fib_sr->sr_path = remaining;
             }
-            if (elt == fib_sr->sr_dest) {
+            else {
+                prev->next = remaining;
+            }
+            if (remaining == NULL) {
                 /* if we remove the last entry we must adjust the destination */
-                fib_sr->sr_dest = tmp;
+                fib_sr->sr_dest = prev;
             }
+            fib_sr_free_entry(table, elt);
             mutex_unlock(&(table->mtx_access));
             return 0;
         }
-        tmp = elt;
+        prev = elt;
     }
 
+    mutex_unlock(&(table->mtx_access));
     return -ENOENT;
 }
 
@@ -1098,7 +1289,7 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1119,19 +1310,21 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
     }
 
     if (elt_repl != NULL) {
-        universal_address_rem(elt_repl->address);
         universal_address_container_t *add = universal_address_add(addr_new, addr_new_size);
 
         if (add == NULL) {
-            /* if this happened we deleted one entry, i.e. decreased the usecount
-             * adding a new one was not possible since lack of memory
-             * so we add back the old entry, i.e. increasing the usecount
-             */
-            universal_address_add(addr_old, addr_old_size);
             mutex_unlock(&(table->mtx_access));
             return -ENOMEM;
         }
+
+        /* move the entry to the index bucket of its new address */
+        fib_sr_t *sr = elt_repl->sr;
+        fib_sr_entry_t *next = elt_repl->next;
+        fib_sr_free_entry(table, elt_repl);
         elt_repl->address = add;
+        elt_repl->next = next;
+        elt_repl->sr = sr;
+        fib_sr_index_add(table, elt_repl);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -1147,7 +1340,7 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1174,111 +1367,95 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
  *         and iff successful to create a new source route
  *
  * @param[in] table the fib table the entry should be added to
- * @param[in] dst pointer to the destination address bytes
- * @param[in] dst_size the size in bytes of the destination address type
- * @param[in] check_free_entry position to start the search for a free entry
+ * @param[in] dst the container of the destination address
  * @param[out] error the state of of this operation when finished
  *
  * @return pointer to the new source route on success
  *         NULL otherwise
 */
-static fib_sr_t* _fib_create_sr_from_partial(fib_table_t *table, uint8_t *dst, size_t dst_size,
-                                             int check_free_entry, int *error) {
-fib_sr_t* hit = NULL;
+static fib_sr_t* _fib_create_sr_from_partial(fib_table_t *table,
+                                             universal_address_container_t *dst,
+                                             int *error) {
+    /* the first source route in the table passing the destination wins */
+    fib_sr_entry_t *found = NULL;
+    for (fib_sr_entry_t *elt = *fib_sr_index_bucket(table, dst); elt != NULL;
+         elt = elt->index_next) {
+        if ((elt->address == dst) && ((found == NULL) || (elt->sr < found->sr))) {
+            found = elt;
+        }
+    }
+
+    if (found == NULL) {
+        return NULL;
+    }
 
+    /* we check if there is a free place for the new sr */
+    fib_sr_t *new_sr = NULL;
     for (size_t i = 0; i < table->size; ++i) {
-        if (table->data.source_routes->headers[i].sr_lifetime != 0) {
+        fib_sr_t *sr = &table->data.source_routes->headers[i];
+        if ((sr != found->sr) && (fib_sr_check_lifetime(table, sr) == -ENOENT)) {
+            new_sr = sr;
+            break;
+        }
+    }
 
-            fib_sr_entry_t *elt;
-            LL_FOREACH(table->data.source_routes->headers[i].sr_path, elt) {
-                size_t addr_size_match = dst_size << 3;
-                if (universal_address_compare(elt->address, dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
-                    /* we create a new sr */
-                    if (check_free_entry == -1) {
-                        /* we have no room to create a new sr
-                         * so we just retrun and NOT tell the RPs to find a route
-                         * since we cannot save it
-                         */
-                        *error = -ENOBUFS;
-                        return NULL;
-                    }
-                    else {
-                        /* we check if there is a free place for the new sr */
-                        fib_sr_t *new_sr = NULL;
-                        for (size_t j = check_free_entry; j < table->size; ++j) {
-                            if (table->data.source_routes->headers[j].sr_lifetime != 0) {
-                                /* not this one, maybe the next one */
-                                continue;
-                            }
-                            else {
-
-                                /* there it is, so we copy the header */
-                                new_sr = &table->data.source_routes->headers[j];
-                                new_sr->sr_iface_id = table->data.source_routes->headers[i].sr_iface_id;
-                                new_sr->sr_flags = table->data.source_routes->headers[i].sr_flags;
-                                new_sr->sr_lifetime = table->data.source_routes->headers[i].sr_lifetime;
-                                new_sr->sr_path = NULL;
-
-                                /* and the path until the searched destination */
-                                fib_sr_entry_t *elt_iter, *elt_add = NULL;
-
-                                LL_FOREACH(table->data.source_routes->headers[i].sr_path, elt_iter) {
-                                    fib_sr_entry_t *new_entry;
-
-                                    if (fib_sr_new_entry(table, elt_iter->address->address,
-                                                         elt_iter->address->address_size,
-                                                         &new_entry) != 0) {
-                                        /* we could not create a new entry
-                                         * so we return to clean up the partial route
-                                         */
-                                        *error = -ENOBUFS;
-                                        return new_sr;
-                                    }
-
-                                    if (new_sr->sr_path == NULL) {
-                                        new_sr->sr_path = new_entry;
-                                        elt_add = new_sr->sr_path;
-                                    }
-                                    else {
-                                        elt_add->next = new_entry;
-                                        elt_add = elt_add->next;
-                                    }
-
-                                    if (elt_iter == elt) {
-                                        /* we copied until the destination */
-                                        new_sr->sr_dest = new_entry;
-                                        hit = new_sr;
-
-                                        /* tell the RPs that a new sr has been created
-                                         * the size and the flags parameters are ignored
-                                         */
-                                        if (fib_signal_rp(table, FIB_MSG_RP_SIGNAL_SOURCE_ROUTE_CREATED,
-                                                      (uint8_t *)new_sr, 0, 0) != 0) {
-                                            /* if no RP can handle the source route
-                                             * then the host is not directly reachable
-                                             */
-                                            *error = -EHOSTUNREACH;
-                                        }
-
-                                        /* break from iterating for copy */
-                                        break;
-                                    }
-                                }
-                            }
-                        }
+    if (new_sr == NULL) {
+        /* we have no room to create a new sr
+         * so we just retrun and NOT tell the RPs to find a route
+         * since we cannot save it
+         */
+        *error = -ENOBUFS;
+        return NULL;
+    }
+
+    /* there it is, so we copy the header */
+    fib_sr_t *sr = found->sr;
+    new_sr->sr_iface_id = sr->sr_iface_id;
+    new_sr->sr_flags = sr->sr_flags;
+    new_sr->sr_lifetime = sr->sr_lifetime;
+    new_sr->sr_path = NULL;
+    new_sr->sr_dest = NULL;
+
+    /* and the path until the searched destination */
+    fib_sr_entry_t *elt_iter;
+    LL_FOREACH(sr->sr_path, elt_iter) {
+        fib_sr_entry_t *new_entry;
+
+        if (fib_sr_new_entry(table, new_sr, elt_iter->address->address,
+                             elt_iter->address->address_size, &new_entry) != 0) {
+            /* we could not create a new entry
+             * so we return to clean up the partial route
+             */
+            *error = -ENOBUFS;
+            return new_sr;
+        }
 
-                        /* break from iterating the found path */
-                        break;
-                    }
-                }
-            }
-            if (hit != NULL) {
-                /* break iterating all sr since we have a path now */
-                break;
-            }
+        if (new_sr->sr_path == NULL) {
+            new_sr->sr_path = new_entry;
+        }
+        else {
+            new_sr->sr_dest->next = new_entry;
+        }
+        new_sr->sr_dest = new_entry;
+
+        if (elt_iter == found) {
+            /* we copied until the destination */
+            break;
         }
     }
-    return hit;
+
+    /* tell the RPs that a new sr has been created
+     * the size and the flags parameters are ignored
+     */
+    if (fib_signal_rp(table, FIB_MSG_RP_SIGNAL_SOURCE_ROUTE_CREATED,
+                      (uint8_t *)new_sr, 0, 0) != 0) {
+        /* if no RP can handle the source route
+         * then the host is not directly reachable
+         */
+        *error = -EHOSTUNREACH;
+    }
+
+    return new_sr;
 }
 
 int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_pid_t *sr_iface_id,
@@ -1296,62 +1473,59 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
 
     fib_sr_t *hit = NULL;
     fib_sr_t *tmp_hit = NULL;
-    int check_free_entry = -1;
 
-    bool skip = (fib_sr != NULL) && (*fib_sr != NULL)?true:false;
+    /* on consecutive searches we only consider the source routes behind the last hit */
+    fib_sr_t *skip = (fib_sr != NULL) ? *fib_sr : NULL;
+
+    /* addresses are stored only once, so we look up the container of the
+     * destination once and compare the containers instead of the addresses.
+     * If there is none, no source route can lead to the destination */
+    universal_address_container_t *dst_container = universal_address_search(dst, dst_size);
+
+    if (dst_container != NULL) {
+        /* drop the expired source routes passing the destination */
+        fib_sr_index_purge(table, dst_container);
+    }
+
     /* Case 1 - check if we know a direct route */
-    for (size_t i = 0; i < table->size; ++i) {
+    for (fib_sr_entry_t *elt = (dst_container != NULL) ? *fib_sr_index_bucket(table, dst_container) : NULL;
+         elt != NULL; elt = elt->index_next) {
+        fib_sr_t *sr = elt->sr;
 
-        if (fib_sr_check_lifetime(&table->data.source_routes->headers[i]) == -ENOENT) {
-            /* expired, so skip this sr and remember its position */
-            if (check_free_entry == -1) {
-                /* we want to fill up the source routes from the beginning */
-                check_free_entry = i;
-            }
+        if ((elt->address != dst_container) || (sr->sr_dest != elt)
+            || ((skip != NULL) && (sr <= skip))) {
             continue;
         }
 
-        if( skip ) {
-            if(*fib_sr == &table->data.source_routes->headers[i]) {
-                skip = false;
+        if (*sr_flags == sr->sr_flags) {
+            /* found a perfect matching sr, the first one in the table wins */
+            if ((hit == NULL) || (sr < hit)) {
+                hit = sr;
             }
-            /* we skip all entries upon the consecutive one to start search */
-            continue;
         }
-
-        size_t addr_size_match = dst_size << 3;
-        if (universal_address_compare(table->data.source_routes->headers[i].sr_dest->address,
-                                      dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
-            if (*sr_flags == table->data.source_routes->headers[i].sr_flags) {
-                /* found a perfect matching sr, no need to search further */
-                hit = &table->data.source_routes->headers[i];
-                tmp_hit = NULL;
-                if (check_free_entry == -1) {
-                    check_free_entry = i;
-                }
-                break;
-            }
-            else {
-                /* found a sr to the destination but with different flags,
-                 * maybe we find a better one.
-                 */
-                tmp_hit = &table->data.source_routes->headers[i];
-            }
+        else if ((tmp_hit == NULL) || (sr > tmp_hit)) {
+            /* found a sr to the destination but with different flags,
+             * maybe we find a better one.
+             */
+            tmp_hit = sr;
         }
     }
 
-    if (hit == NULL) {
+    if (hit != NULL) {
+        /* a perfect sr beats the ones with distinct flags */
+        tmp_hit = NULL;
+    }
+    else {
         /* we didn't find a perfect sr, but one with distinct flags */
         hit = tmp_hit;
     }
 
     /* Case 2 - if no hit is found check if there is a matching entry in one sr_path
-     * @note the first match wins, if we find one we will NOT continue searching,
-     * since this search is very expensive in terms of compare operations
+     * @note the first match wins, if we find one we will NOT continue searching
     */
-    if (hit == NULL) {
+    if ((hit == NULL) && (dst_container != NULL)) {
         int error = 0;
-        hit = _fib_create_sr_from_partial(table, dst, dst_size, check_free_entry, &error);
+        hit = _fib_create_sr_from_partial(table, dst_container, &error);
         if ((error != 0) && (error != -EHOSTUNREACH)) {
             /* something went wrong, so we clean up our mess
              *
@@ -1362,16 +1536,7 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
              */
             if (hit != NULL) {
                 hit->sr_lifetime = 0;
-
-                if (hit->sr_path != NULL) {
-                    fib_sr_entry_t *elt, *tmp;
-                    LL_FOREACH_SAFE(hit->sr_path, elt, tmp) {
-                        universal_address_rem(elt->address);
-                        elt->address = NULL;
-                        LL_DELETE(hit->sr_path, elt);
-                    }
-                    hit->sr_path = NULL;
-                }
+                fib_sr_free_path(table, hit);
             }
             mutex_unlock(&(table->mtx_access));
             return error;
@@ -1440,6 +1605,337 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     }
 }
 
+/* snapshot handling */
+
+/**
+ * @brief size of the snapshot header
+ */
+#define FIB_SNAPSHOT_HDR_SIZE   (7)
+
+/**
+ * @brief remaining lifetime in a snapshot of an entry that does not expire
+ */
+#define FIB_SNAPSHOT_NO_EXPIRE  (0xffffffff)
+
+/**
+ * @brief Internal type: cursor to write a snapshot
+ */
+typedef struct {
+    uint8_t *buf;       /**< the buffer to write to */
+    size_t size;        /**< the size of buf */
+    size_t pos;         /**< the number of bytes written (or required) */
+} fib_snapshot_writer_t;
+
+/**
+ * @brief Internal type: cursor to read a snapshot
+ */
+typedef struct {
+    const uint8_t *buf; /**< the buffer to read from */
+    size_t size;        /**< the size of buf */
+    size_t pos;         /**< the number of bytes read */
+} fib_snapshot_reader_t;
+
+/**
+* @brief Internal function:
+*        writes a little endian value of len bytes, if it fits into the buffer
+*/
+static void fib_snapshot_put(fib_snapshot_writer_t *w, uint32_t val, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (w->pos < w->size) {
+            w->buf[w->pos] = (uint8_t)(val >> (i << 3));
+        }
+        w->pos++;
+    }
+}
+
+/**
+* @brief Internal function:
+*        writes an address prefixed by its size
+*/
+static void fib_snapshot_put_address(fib_snapshot_writer_t *w,
+                                     universal_address_container_t *addr)
+{
+    fib_snapshot_put(w, addr->address_size, 1);
+    for (size_t i = 0; i < addr->address_size; ++i) {
+        fib_snapshot_put(w, addr->address[i], 1);
+    }
+}
+
+/**
+* @brief Internal function:
+*        converts an absolute lifetime to the remaining lifetime in ms
+*/
+static uint32_t fib_snapshot_lifetime(uint64_t lifetime, uint64_t now)
+{
+    if (lifetime == FIB_LIFETIME_NO_EXPIRE) {
+        return FIB_SNAPSHOT_NO_EXPIRE;
+    }
+
+    uint64_t ms = (lifetime - now) / 1000;
+
+    if (ms == 0) {
+        /* keep entries that expire within the next ms */
+        return 1;
+    }
+    if (ms >= FIB_SNAPSHOT_NO_EXPIRE) {
+        return FIB_SNAPSHOT_NO_EXPIRE - 1;
+    }
+    return (uint32_t)ms;
+}
+
+/**
+* @brief Internal function:
+*        reads a little endian value of len bytes
+*
+* @return 0 on success, -EINVAL if the snapshot is too short
+*/
+static int fib_snapshot_get(fib_snapshot_reader_t *r, uint32_t *val, size_t len)
+{
+    if ((r->size - r->pos) < len) {
+        return -EINVAL;
+    }
+
+    *val = 0;
+    for (size_t i = 0; i < len; ++i) {
+        *val |= ((uint32_t)r->buf[r->pos++]) << (i << 3);
+    }
+    return 0;
+}
+
+/**
+* @brief Internal function:
+*        reads an address prefixed by its size
+*
+* @return pointer to the address within the snapshot on success,
+*         NULL if the snapshot is invalid
+*/
+static uint8_t *fib_snapshot_get_address(fib_snapshot_reader_t *r, size_t *addr_size)
+{
+    uint32_t size;
+
+    if ((fib_snapshot_get(r, &size, 1) != 0) || (size == 0)
+        || (size > UNIVERSAL_ADDRESS_SIZE) || ((r->size - r->pos) < size)) {
+        return NULL;
+    }
+
+    uint8_t *addr = (uint8_t *)&r->buf[r->pos];
+    r->pos += size;
+    *addr_size = size;
+    return addr;
+}
+
+int fib_snapshot(fib_table_t *table, uint8_t *buf, size_t *buf_size)
+{
+    if (buf_size == NULL) {
+        return -EFAULT;
+    }
+
+    mutex_lock(&(table->mtx_access));
+
+    fib_snapshot_writer_t w = { .buf = buf, .size = (buf == NULL) ? 0 : *buf_size };
+    uint64_t now = xtimer_now64();
+    uint32_t count = 0;
+
+    fib_snapshot_put(&w, 'F', 1);
+    fib_snapshot_put(&w, 'I', 1);
+    fib_snapshot_put(&w, 'B', 1);
+    fib_snapshot_put(&w, FIB_SNAPSHOT_VERSION, 1);
+    fib_snapshot_put(&w, table->table_type, 1);
+    /* the number of entries is written when we know it */
+    fib_snapshot_put(&w, 0, 2);
+
+    if (table->table_type == FIB_TABLE_TYPE_SR) {
+        for (size_t i = 0; (i < table->size) && (count < UINT16_MAX); ++i) {
+            fib_sr_t *sr = &table->data.source_routes->headers[i];
+            int hops = 0;
+            fib_sr_entry_t *elt;
+
+            if ((sr->sr_lifetime == 0) || (sr->sr_lifetime < now)) {
+                continue;
+            }
+
+            LL_COUNT(sr->sr_path, elt, hops);
+
+            if (hops > UINT8_MAX) {
+                DEBUG("[fib_snapshot] skipping source route with %d hops\n", hops);
+                continue;
+            }
+
+            fib_snapshot_put(&w, (uint16_t)sr->sr_iface_id, 2);
+            fib_snapshot_put(&w, sr->sr_flags, 4);
+            fib_snapshot_put(&w, fib_snapshot_lifetime(sr->sr_lifetime, now), 4);
+            fib_snapshot_put(&w, hops, 1);
+            LL_FOREACH(sr->sr_path, elt) {
+                fib_snapshot_put_address(&w, elt->address);
+            }
+            count++;
+        }
+    }
+    else {
+        for (size_t i = 0; (i < table->size) && (count < UINT16_MAX); ++i) {
+            fib_entry_t *entry = &table->data.entries[i];
+
+            if ((entry->global == NULL) || (entry->next_hop == NULL)
+                || (entry->lifetime < now)) {
+                continue;
+            }
+
+            fib_snapshot_put(&w, (uint16_t)entry->iface_id, 2);
+            fib_snapshot_put(&w, entry->global_flags, 4);
+            fib_snapshot_put(&w, entry->next_hop_flags, 4);
+            fib_snapshot_put(&w, fib_snapshot_lifetime(entry->lifetime, now), 4);
+            fib_snapshot_put_address(&w, entry->global);
+            fib_snapshot_put_address(&w, entry->next_hop);
+            count++;
+        }
+    }
+
+    mutex_unlock(&(table->mtx_access));
+
+    if (w.pos > w.size) {
+        *buf_size = w.pos;
+        return -ENOBUFS;
+    }
+
+    size_t len = w.pos;
+    w.pos = FIB_SNAPSHOT_HDR_SIZE - 2;
+    fib_snapshot_put(&w, count, 2);
+    *buf_size = len;
+    return 0;
+}
+
+/**
+* @brief Internal function:
+*        restores one source route of a snapshot
+*/
+static int fib_restore_sr(fib_table_t *table, fib_snapshot_reader_t *r)
+{
+    uint32_t iface_id, flags, lifetime, hops;
+
+    if ((fib_snapshot_get(r, &iface_id, 2) != 0) || (fib_snapshot_get(r, &flags, 4) != 0)
+        || (fib_snapshot_get(r, &lifetime, 4) != 0) || (fib_snapshot_get(r, &hops, 1) != 0)
+        || (lifetime == 0)) {
+        return -EINVAL;
+    }
+
+    fib_sr_t *sr = NULL;
+    for (size_t i = 0; i < table->size; ++i) {
+        if (table->data.source_routes->headers[i].sr_lifetime == 0) {
+            sr = &table->data.source_routes->headers[i];
+            break;
+        }
+    }
+
+    if (sr == NULL) {
+        return -ENOMEM;
+    }
+
+    sr->sr_iface_id = (kernel_pid_t)(int16_t)iface_id;
+    sr->sr_flags = flags;
+    sr->sr_path = NULL;
+    sr->sr_dest = NULL;
+    if (lifetime != FIB_SNAPSHOT_NO_EXPIRE) {
+        fib_lifetime_to_absolute(lifetime, &sr->sr_lifetime);
+    }
+    else {
+        sr->sr_lifetime = FIB_LIFETIME_NO_EXPIRE;
+    }
+
+    int ret = 0;
+    for (uint32_t i = 0; (ret == 0) && (i < hops); ++i) {
+        size_t addr_size;
+        uint8_t *addr = fib_snapshot_get_address(r, &addr_size);
+        fib_sr_entry_t *new_entry;
+
+        if (addr == NULL) {
+            ret = -EINVAL;
+        }
+        else if ((ret = fib_sr_new_entry(table, sr, addr, addr_size, &new_entry)) == 0) {
+            if (sr->sr_dest != NULL) {
+                sr->sr_dest->next = new_entry;
+            }
+            else {
+                sr->sr_path = new_entry;
+            }
+            sr->sr_dest = new_entry;
+        }
+    }
+
+    if (ret != 0) {
+        /* remove the partially restored source route */
+        sr->sr_lifetime = 0;
+        fib_sr_free_path(table, sr);
+    }
+
+    return ret;
+}
+
+/**
+* @brief Internal function:
+*        restores one single hop entry of a snapshot
+*/
+static int fib_restore_entry(fib_table_t *table, fib_snapshot_reader_t *r)
+{
+    uint32_t iface_id, dst_flags, next_hop_flags, lifetime;
+    size_t dst_size, next_hop_size;
+    uint8_t *dst, *next_hop;
+
+    if ((fib_snapshot_get(r, &iface_id, 2) != 0) || (fib_snapshot_get(r, &dst_flags, 4) != 0)
+        || (fib_snapshot_get(r, &next_hop_flags, 4) != 0)
+        || (fib_snapshot_get(r, &lifetime, 4) != 0) || (lifetime == 0)
+        || ((dst = fib_snapshot_get_address(r, &dst_size)) == NULL)
+        || ((next_hop = fib_snapshot_get_address(r, &next_hop_size)) == NULL)) {
+        return -EINVAL;
+    }
+
+    fib_entry_t *entry[1];
+    size_t count = 1;
+
+    if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
+        entry[0]->iface_id = (kernel_pid_t)(int16_t)iface_id;
+        entry[0]->global_flags = dst_flags;
+        return fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+    }
+
+    return fib_create_entry(table, (kernel_pid_t)(int16_t)iface_id, dst, dst_size, dst_flags,
+                            next_hop, next_hop_size, next_hop_flags, lifetime);
+}
+
+int fib_restore(fib_table_t *table, const uint8_t *buf, size_t buf_size)
+{
+    if (buf == NULL) {
+        return -EFAULT;
+    }
+
+    fib_snapshot_reader_t r = { .buf = buf, .size = buf_size };
+    uint32_t count;
+
+    if ((buf_size < FIB_SNAPSHOT_HDR_SIZE) || (buf[0] != 'F') || (buf[1] != 'I')
+        || (buf[2] != 'B') || (buf[3] != FIB_SNAPSHOT_VERSION)
+        || (buf[4] != table->table_type)) {
+        return -EINVAL;
+    }
+
+    r.pos = FIB_SNAPSHOT_HDR_SIZE - 2;
+    fib_snapshot_get(&r, &count, 2);
+
+    mutex_lock(&(table->mtx_access));
+
+    int ret = 0;
+    for (uint32_t i = 0; (ret == 0) && (i < count); ++i) {
+        if (table->table_type == FIB_TABLE_TYPE_SR) {
+            ret = fib_restore_sr(table, &r);
+        }
+        else {
+            ret = fib_restore_entry(table, &r);
+        }
+    }
+
+    mutex_unlock(&(table->mtx_access));
+    return ret;
+}
+
 /* print functions */
 
 void fib_print_notify_rp(fib_table_t *table)
@@ -44,8 +44,6 @@ bool ipv6_addr_equal(const ipv6_addr_t *a, const ipv6_addr_t *b)
 
 uint8_t ipv6_addr_match_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b)
 {
-    uint8_t prefix_len = 0;
-
     if ((a == NULL) || (b == NULL)) {
         return 0;
     }
@@ -54,51 +52,40 @@ uint8_t ipv6_addr_match_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b)
         return 128;
     }
 
-    for (int i = 0; i < 16; i++) {
-        /* if bytes are equal add 8 */
-        if (a->u8[i] == b->u8[i]) {
-            prefix_len += 8;
-        }
-        else {
-            uint8_t xor = (a->u8[i] ^ b->u8[i]);
-
-            /* while bits from byte equal add 1 */
-            for (int j = 0; j < 8; j++) {
-                if ((xor & 0x80) == 0) {
-                    prefix_len++;
-                    xor = xor << 1;
-                }
-                else {
-                    break;
-                }
-            }
+    for (unsigned i = 0; i < 2; i++) {
+        network_uint64_t xor = { a->u64[i].u64 ^ b->u64[i].u64 };
 
-            break;
+        if (xor.u64 != 0) {
+            /* the first differing bit is the most significant one set */
+            return (i * 64) + __builtin_clzll(byteorder_ntohll(xor));
         }
     }
 
-    return prefix_len;
+    return 128;
 }
 
-void ipv6_addr_init_prefix(ipv6_addr_t *out, const ipv6_addr_t *prefix,
-                           uint8_t bits)
+void ipv6_addr_init_mask(ipv6_addr_t *mask, uint8_t bits)
 {
-    uint8_t bytes;
-
     if (bits > 128) {
         bits = 128;
     }
 
-    bytes = bits / 8;
+    for (unsigned i = 0; i < 2; i++, bits -= (bits > 64) ? 64 : bits) {
+        /* shifting by 64 is undefined */
+        uint64_t word = (bits >= 64) ? UINT64_MAX :
+                        (bits == 0) ? 0 : (UINT64_MAX << (64 - bits));
 
-    memcpy(out, prefix, bytes);
+        mask->u64[i] = byteorder_htonll(word);
+    }
+}
 
-    if (bits % 8) {
-        uint8_t mask = 0xff << (8 - (bits - (bytes * 8)));
+void ipv6_addr_init_prefix(ipv6_addr_t *out, const ipv6_addr_t *prefix,
+                           uint8_t bits)
+{
+    ipv6_addr_t mask;
 
-        out->u8[bytes] &= ~mask;
-        out->u8[bytes] |= (prefix->u8[bytes] & mask);
-    }
+    ipv6_addr_init_mask(&mask, bits);
+    ipv6_addr_init_prefix_mask(out, prefix, &mask);
 }
 
 void ipv6_addr_init_iid(ipv6_addr_t *out, const uint8_t *iid, uint8_t bits)
@@ -13,33 +13,19 @@
  */
 #include <stdio.h>
 #include <string.h>
-#include <inttypes.h>
 
+#include "fmt.h"
 #include "od.h"
 
-#define _OCTAL_BYTE_LENGTH  (3)
-#define _INT_BYTE_LENGTH    (3)
-#define _HEX_BYTE_LENGTH    (2)
+#define _LINE_SIZE      (128U)
+#define _DATE_SIZE_MAX  (25U)   /* separator and 24 digits */
 
-static inline void _address_format(char *format, uint16_t flags)
-{
-    switch (flags & OD_FLAGS_ADDRESS_MASK) {
-        case OD_FLAGS_ADDRESS_OCTAL:
-            strncpy(format, "%09o", sizeof("%09o"));
-            break;
-
-        case OD_FLAGS_ADDRESS_HEX:
-            strncpy(format, "%06x", sizeof("%06x"));
-            break;
-
-        case OD_FLAGS_ADDRESS_DECIMAL:
-            strncpy(format, "%07d", sizeof("%07d"));
-            break;
+typedef struct {
+    char buf[_LINE_SIZE];
+    size_t pos;
+} _line_t;
 
-        default:
-            break;
-    }
-}
+static const char _hex_chars[16] = "0123456789abcdef";
 
 static inline uint8_t _length(uint16_t flags)
 {
@@ -69,272 +55,196 @@ static inline uint8_t _length(uint16_t flags)
     }
 }
 
-static inline void _bytes_format(char *format, uint16_t flags)
+static void _flush(_line_t *line)
 {
-    if (flags & OD_FLAGS_BYTES_CHAR) {
-        strncpy(format, "    %c", sizeof("    %c"));
-        return;
+    if (line->pos) {
+        fwrite(line->buf, 1, line->pos, stdout);
+        line->pos = 0;
     }
+}
 
-    switch (flags & (OD_FLAGS_BYTES_MASK | OD_FLAGS_LENGTH_MASK)) {
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_1:
-            strncpy(format, " %03o", sizeof(" %03o"));
-            break;
-
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_2:
-            strncpy(format, " %06" PRIo16, sizeof(" %06" PRIo16));
-            break;
-
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_4:
-            strncpy(format, " %012" PRIo32, sizeof(" %012" PRIo32));
-            break;
-
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_8:
-            strncpy(format, " %024" PRIo64, sizeof(" %024" PRIo64));
-            break;
-
-#if !defined(__MACH__)
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%0%do", sizeof(short) * _OCTAL_BYTE_LENGTH);
-            break;
-
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%0%dlo", sizeof(long) * _OCTAL_BYTE_LENGTH);
-            break;
-#else   /* !defined(__MACH__) */
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %lu", sizeof(short) * _OCTAL_BYTE_LENGTH);
-            break;
-
-        case OD_FLAGS_BYTES_OCTAL | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %lu", sizeof(long) * _OCTAL_BYTE_LENGTH);
-            break;
-#endif  /* !defined(__MACH__) */
-
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_1:
-            strncpy(format, " %4d", sizeof(" %4d"));
-            break;
-
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_2:
-            strncpy(format, " %6" PRId16, sizeof(" %6" PRId16));
-            break;
-
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_4:
-            strncpy(format, " %12" PRId32, sizeof(" %12" PRId32));
-            break;
-
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_8:
-            strncpy(format, " %24" PRId64, sizeof(" %24" PRId64));
-            break;
-
-#if !defined(__MACH__)
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%%dd", sizeof(short) * _INT_BYTE_LENGTH);
-            break;
+/* appends val in base 8, 10 or 16, right-aligned in a field of width
+ * characters padded with pad */
+static void _put_num(_line_t *line, uint64_t val, int negative, unsigned base,
+                     unsigned width, char pad)
+{
+    char digits[24];
+    size_t len = 0;
+    char *out;
 
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%%dld", sizeof(long) * _INT_BYTE_LENGTH);
-            break;
-#else   /* !defined(__MACH__) */
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%%ld", sizeof(short) * _INT_BYTE_LENGTH);
-            break;
+    if (base == 10) {
+        len = (val >> 32) ? fmt_u64_dec(digits, val)
+                          : fmt_u32_dec(digits, (uint32_t)val);
+    }
+    else {
+        unsigned shift = (base == 16) ? 4 : 3;
+        char *ptr = digits + sizeof(digits);
+
+        do {
+            *--ptr = _hex_chars[val & (base - 1)];
+            val >>= shift;
+        } while (val);
+        len = (digits + sizeof(digits)) - ptr;
+        memmove(digits, ptr, len);
+    }
 
-        case OD_FLAGS_BYTES_INT | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%%ld", sizeof(long) * _INT_BYTE_LENGTH);
-            break;
-#endif  /* !defined(__MACH__) */
+    out = &line->buf[line->pos];
+    if (width > (len + negative)) {
+        memset(out, pad, width - (len + negative));
+        out += width - (len + negative);
+    }
+    if (negative) {
+        *out++ = '-';
+    }
+    memcpy(out, digits, len);
+    line->pos = (out + len) - line->buf;
+}
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_1:
-            strncpy(format, " %3u", sizeof(" %3u"));
-            break;
+static void _put_str(_line_t *line, const char *str)
+{
+    size_t len = strlen(str);
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_2:
-            strncpy(format, " %6" PRIu16, sizeof(" %6" PRIu16));
-            break;
+    memcpy(&line->buf[line->pos], str, len);
+    line->pos += len;
+}
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_4:
-            strncpy(format, " %12" PRIu32, sizeof(" %12" PRIu32));
+static void _put_address(_line_t *line, size_t addr, uint16_t flags)
+{
+    switch (flags & OD_FLAGS_ADDRESS_MASK) {
+        case OD_FLAGS_ADDRESS_OCTAL:
+            _put_num(line, addr, 0, 8, 9, '0');
             break;
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_8:
-            strncpy(format, " %24" PRIu64, sizeof(" %24" PRIu64));
+        case OD_FLAGS_ADDRESS_HEX:
+            _put_num(line, addr, 0, 16, 6, '0');
             break;
 
-#if !defined(__MACH__)
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%%uu", (unsigned)sizeof(short) * _INT_BYTE_LENGTH);
+        case OD_FLAGS_ADDRESS_DECIMAL:
+            _put_num(line, addr, 0, 10, 7, '0');
             break;
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%%ulu", sizeof(long) * _INT_BYTE_LENGTH);
-            break;
-#else   /* !defined(__MACH__) */
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%%lu", sizeof(short) * _INT_BYTE_LENGTH);
+        default:
             break;
+    }
+}
 
-        case OD_FLAGS_BYTES_UINT | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%%lu", sizeof(long) * _INT_BYTE_LENGTH);
-            break;
-#endif  /* !defined(__MACH__) */
+static void _put_char(_line_t *line, char c)
+{
+    switch (c) {
+        case '\0':
+            _put_str(line, "   \\0");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_1:
-            strncpy(format, " %02x", sizeof(" %02x"));
-            break;
+        case '\a':
+            _put_str(line, "   \\a");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_2:
-            strncpy(format, " %04" PRIx16, sizeof(" %04" PRIx16));
-            break;
+        case '\b':
+            _put_str(line, "   \\b");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_4:
-            strncpy(format, " %08" PRIx32, sizeof(" %08" PRIx32));
-            break;
+        case '\f':
+            _put_str(line, "   \\f");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_8:
-            strncpy(format, " %016" PRIx64, sizeof(" %016" PRIx64));
-            break;
+        case '\n':
+            _put_str(line, "   \\n");
+            return;
 
-#if !defined(__MACH__)
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%0%ux", (unsigned)sizeof(short) * _HEX_BYTE_LENGTH);
-            break;
+        case '\r':
+            _put_str(line, "   \\r");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%0%ulx", (unsigned)sizeof(long) * _HEX_BYTE_LENGTH);
-            break;
-#else   /* !defined(__MACH__) */
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_SHORT:
-            sprintf(format, " %%0%lx", sizeof(short) * _HEX_BYTE_LENGTH);
-            break;
+        case '\t':
+            _put_str(line, "   \\t");
+            return;
 
-        case OD_FLAGS_BYTES_HEX | OD_FLAGS_LENGTH_LONG:
-            sprintf(format, " %%0%lx", sizeof(long) * _HEX_BYTE_LENGTH);
-            break;
-#endif  /* !defined(__MACH__) */
+        case '\v':
+            _put_str(line, "   \\v");
+            return;
 
         default:
-            break;
-    }
-}
-
-static void _print_date(const void *data, size_t offset, char *format, uint8_t length,
-                        uint16_t flags)
-{
-    switch (length) {
-        case 1:
-            if (flags & OD_FLAGS_BYTES_CHAR) {
-                switch (((signed char *)data)[offset]) {
-                    case '\0':
-                        printf("   \\0");
-                        return;
-
-                    case '\a':
-                        printf("   \\a");
-                        return;
-
-                    case '\b':
-                        printf("   \\b");
-                        return;
-
-                    case '\f':
-                        printf("   \\f");
-                        return;
-
-                    case '\n':
-                        printf("   \\n");
-                        return;
-
-                    case '\r':
-                        printf("   \\r");
-                        return;
-
-                    case '\t':
-                        printf("   \\t");
-                        return;
-
-                    case '\v':
-                        printf("   \\v");
-                        return;
-
-                    default:
-                        if (((signed char *)data)[offset] < 0) {
-                            printf("  %03o", ((unsigned char *)data)[offset]);
-                            return;
-                        }
-                        else if (((signed char *)data)[offset] < 32) {
-                            printf("  %03o", ((char *)data)[offset]);
-                            return;
-                        }
-
-                        break;
-                }
-
-            }
-
-            if (flags & OD_FLAGS_BYTES_INT) {
-                printf(format, ((int8_t *)data)[offset]);
+            if (((signed char)c < 0) || (c < 32)) {
+                _put_str(line, "  ");
+                _put_num(line, (unsigned char)c, 0, 8, 3, '0');
             }
             else {
-                printf(format, ((uint8_t *)data)[offset]);
+                _put_str(line, "    ");
+                line->buf[line->pos++] = c;
             }
+            return;
+    }
+}
 
-            break;
+static void _put_date(_line_t *line, const uint8_t *data, uint8_t length,
+                      uint16_t flags)
+{
+    uint64_t val = 0;
+    unsigned width = length * 3;
 
-        case 2:
-            if (flags & OD_FLAGS_BYTES_INT) {
-                printf(format, ((int16_t *)data)[offset]);
-            }
-            else {
-                printf(format, ((uint16_t *)data)[offset]);
-            }
+    if (flags & OD_FLAGS_BYTES_CHAR) {
+        _put_char(line, (char)data[0]);
+        return;
+    }
 
+    /* element in host byte order, read byte-wise as data may be unaligned */
+    switch (length) {
+        case 1:
+            val = data[0];
             break;
 
-        case 4:
-        default:
-            if (flags & OD_FLAGS_BYTES_INT) {
-                printf(format, ((int32_t *)data)[offset]);
-            }
-            else {
-                printf(format, ((uint32_t *)data)[offset]);
-            }
-
+        case 2: {
+            uint16_t tmp;
+            memcpy(&tmp, data, sizeof(tmp));
+            val = tmp;
             break;
+        }
 
         case 8:
-            if (flags & OD_FLAGS_BYTES_INT) {
-                printf(format, ((int64_t *)data)[offset]);
-            }
-            else {
-                printf(format, ((uint64_t *)data)[offset]);
-            }
-
+            memcpy(&val, data, sizeof(val));
             break;
 
+        case 4:
+        default: {
+            uint32_t tmp;
+            memcpy(&tmp, data, sizeof(tmp));
+            val = tmp;
+            break;
+        }
     }
-}
 
-static int _log10(uint8_t a)
-{
-    int res = 0;
+    line->buf[line->pos++] = ' ';
+    if (flags & OD_FLAGS_BYTES_INT) {
+        int negative = 0;
+        unsigned bits = length * 8;
 
-    while (a > 0) {
-        a /= 10;
-        ++res;
+        if ((bits < 64) && (val & (1ULL << (bits - 1)))) {
+            val = (1ULL << bits) - val;
+            negative = 1;
+        }
+        else if ((bits == 64) && (val >> 63)) {
+            val = -val;
+            negative = 1;
+        }
+        _put_num(line, val, negative, 10, (length == 1) ? 4 : width, ' ');
+    }
+    else if (flags & OD_FLAGS_BYTES_UINT) {
+        _put_num(line, val, 0, 10, width, ' ');
+    }
+    else if (flags & OD_FLAGS_BYTES_HEX) {
+        _put_num(line, val, 0, 16, length * 2, '0');
+    }
+    else {
+        _put_num(line, val, 0, 8, width, '0');
     }
-
-    return ++res;
 }
 
 void od(const void *data, size_t data_len, uint8_t width, uint16_t flags)
 {
-    char address_format[5];
+    const uint8_t *bytes = data;
     uint8_t date_length = _length(flags);
-    char bytes_format[_log10(date_length) + 7];
-
-    _address_format(address_format, flags);
-    _bytes_format(bytes_format, flags);
+    int address = ((flags & OD_FLAGS_ADDRESS_MASK) != OD_FLAGS_ADDRESS_NONE);
+    _line_t line;
 
     if (width == 0) {
         width = OD_WIDTH_DEFAULT;
@@ -347,30 +257,36 @@ void od(const void *data, size_t data_len, uint8_t width, uint16_t flags)
         width = (width / date_length);
     }
 
-    if (data_len % date_length) {
-        data_len = (data_len / date_length) + 1;
-    }
-    else {
-        data_len = data_len / date_length;
-    }
-
-    if ((flags & OD_FLAGS_ADDRESS_MASK) != OD_FLAGS_ADDRESS_NONE) {
-        printf(address_format, 0);
+    line.pos = 0;
+    if (address) {
+        _put_address(&line, 0, flags);
     }
 
-    for (size_t i = 0; i < data_len; i++) {
-        _print_date(data, i, bytes_format, date_length, flags);
-
-        if ((((i + 1) % width) == 0) || i == (data_len - 1)) {
-            printf("\n");
+    for (size_t offset = 0, i = 0; offset < data_len;
+         offset += date_length, i++) {
+        if ((data_len - offset) < date_length) {
+            /* the last element is padded with zeros */
+            uint8_t tmp[8] = { 0 };
+            memcpy(tmp, &bytes[offset], data_len - offset);
+            _put_date(&line, tmp, date_length, flags);
+        }
+        else {
+            _put_date(&line, &bytes[offset], date_length, flags);
+        }
 
-            if (i != (data_len - 1)) {
-                if ((flags & OD_FLAGS_ADDRESS_MASK) != OD_FLAGS_ADDRESS_NONE) {
-                    printf(address_format, date_length * (i + 1));
-                }
+        if ((((i + 1) % width) == 0) || ((offset + date_length) >= data_len)) {
+            line.buf[line.pos++] = '\n';
+            _flush(&line);
+            if (address && ((offset + date_length) < data_len)) {
+                _put_address(&line, offset + date_length, flags);
             }
         }
+        else if (line.pos > (_LINE_SIZE - _DATE_SIZE_MAX - 1)) {
+            /* lines longer than the buffer are written in parts */
+            _flush(&line);
+        }
     }
+    _flush(&line);
 }
 
 /** @} */
@@ -208,7 +208,7 @@ static int _implicit_bind(socket_t *s, void *addr)
     switch (s->type) {
 #ifdef MODULE_CONN_TCP
         case SOCK_STREAM:
-            res = conn_tcp_create(&s->conn.udp, best_match, sizeof(unspec),
+            res = conn_tcp_create(&s->conn.tcp, best_match, sizeof(unspec),
                                   s->domain, s->src_port);
             break;
 #endif
@@ -392,28 +392,35 @@ int accept(int socket, struct sockaddr *restrict address,
                 res = -1;
                 break;
             }
-            else if ((address != NULL) && (address_len != NULL)) {
-                /* TODO: add read and write */
-                int fd = fd_new(new_s - _pool, NULL, NULL, socket_close);
-                if (fd < 0) {
-                    errno = ENFILE;
-                    res = -1;
-                    break;
-                }
-                else {
-                    new_s->fd = res = fd;
-                }
-                new_s->domain = s->domain;
-                new_s->type = s->type;
-                new_s->protocol = s->protocol;
+            /* get the peer address first, so only the connection has to be
+             * closed if that fails */
+            if ((address != NULL) && (address_len != NULL)) {
+                int addr_res;
+
                 tmp.ss_family = s->domain;
-                if ((res = conn_tcp_getpeeraddr(&s->conn.tcp, addr, port)) < 0) {
-                    errno = -res;
+                if ((addr_res = conn_tcp_getpeeraddr(&new_s->conn.tcp, addr, port)) < 0) {
+                    conn_tcp_close(&new_s->conn.tcp);
+                    errno = -addr_res;
                     res = -1;
                     break;
                 }
                 *port = htons(*port); /* XXX: sin(6)_port is supposed to be
                                          network byte order */
+            }
+            /* TODO: add read and write */
+            int fd = fd_new(new_s - _pool, NULL, NULL, socket_close);
+            if (fd < 0) {
+                conn_tcp_close(&new_s->conn.tcp);
+                errno = ENFILE;
+                res = -1;
+                break;
+            }
+            new_s->fd = res = fd;
+            new_s->domain = s->domain;
+            new_s->type = s->type;
+            new_s->protocol = s->protocol;
+            new_s->bound = true;
+            if ((address != NULL) && (address_len != NULL)) {
                 *address_len = _addr_truncate(address, *address_len, &tmp, tmp_len);
             }
             break;
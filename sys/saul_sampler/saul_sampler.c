@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_saul_sampler
+ * @{
+ *
+ * @file
+ * @brief       SAUL sampler implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "irq.h"
+#include "saul_sampler.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static inline int _active(const saul_sampler_entry_t *e)
+{
+    return (e->dev != NULL) && (e->interval != 0);
+}
+
+static void _store(saul_sampler_t *s, unsigned entry, int dim,
+                   const phydat_t *data)
+{
+    unsigned state = irq_disable();
+    int idx = cib_put(&s->cib);
+
+    if (idx < 0) {
+        /* overwrite the oldest record */
+        cib_get(&s->cib);
+        idx = cib_put(&s->cib);
+        s->dropped++;
+    }
+    s->ring[idx].time = xtimer_now();
+    s->ring[idx].entry = entry;
+    s->ring[idx].dim = dim;
+    memcpy(&s->ring[idx].data, data, sizeof(phydat_t));
+    irq_restore(state);
+}
+
+static void _timer_cb(void *arg)
+{
+    saul_sampler_t *s = arg;
+
+    event_post(s->queue, &s->event);
+}
+
+static void _sample(event_t *event)
+{
+    saul_sampler_t *s = (saul_sampler_t *)event;
+    uint32_t now = xtimer_now();
+    uint32_t next = UINT32_MAX;
+
+    /* read all entries due in one pass */
+    for (unsigned i = 0; i < s->entries_numof; i++) {
+        saul_sampler_entry_t *e = &s->entries[i];
+
+        if (!_active(e) || ((int32_t)(e->due - now) > 0)) {
+            continue;
+        }
+
+        phydat_t data;
+        int dim = saul_reg_read(e->dev, &data);
+
+        if (dim > 0) {
+            _store(s, i, dim, &data);
+        }
+        else {
+            DEBUG("saul_sampler: reading %s failed (%d)\n", e->dev->name, dim);
+            s->errors++;
+        }
+        e->due += e->interval;
+        if ((int32_t)(e->due - now) <= 0) {
+            /* skip samples missed instead of catching up in bursts */
+            e->due = now + e->interval;
+        }
+    }
+
+    now = xtimer_now();
+    for (unsigned i = 0; i < s->entries_numof; i++) {
+        saul_sampler_entry_t *e = &s->entries[i];
+        int32_t diff = (int32_t)(e->due - now);
+
+        if (!_active(e)) {
+            continue;
+        }
+        if (diff <= 0) {
+            next = 0;
+            break;
+        }
+        if ((uint32_t)diff < next) {
+            next = diff;
+        }
+    }
+
+    if (s->cb) {
+        s->cb(s, s->arg);
+    }
+
+    if (s->queue == NULL) {
+        /* stopped by the callback */
+        return;
+    }
+    if (next == 0) {
+        event_post(s->queue, &s->event);
+    }
+    else if (next != UINT32_MAX) {
+        xtimer_set(&s->timer, next);
+    }
+}
+
+void saul_sampler_init(saul_sampler_t *sampler, saul_sampler_entry_t *entries,
+                       unsigned entries_numof, saul_sampler_rec_t *ring,
+                       unsigned ring_size, saul_sampler_cb_t cb, void *arg)
+{
+    assert(sampler && (entries_numof <= 256) && ring);
+
+    memset(sampler, 0, sizeof(saul_sampler_t));
+    sampler->event.handler = _sample;
+    sampler->timer.callback = _timer_cb;
+    sampler->timer.arg = sampler;
+    sampler->entries = entries;
+    sampler->entries_numof = entries_numof;
+    sampler->ring = ring;
+    cib_init(&sampler->cib, ring_size);
+    sampler->cb = cb;
+    sampler->arg = arg;
+}
+
+void saul_sampler_start(saul_sampler_t *sampler, event_queue_t *queue)
+{
+    uint32_t now = xtimer_now();
+
+    for (unsigned i = 0; i < sampler->entries_numof; i++) {
+        sampler->entries[i].due = now;
+    }
+    sampler->queue = queue;
+    event_post(queue, &sampler->event);
+}
+
+void saul_sampler_stop(saul_sampler_t *sampler)
+{
+    xtimer_remove(&sampler->timer);
+    if (sampler->queue) {
+        event_cancel(sampler->queue, &sampler->event);
+        sampler->queue = NULL;
+    }
+}
+
+int saul_sampler_read(saul_sampler_t *sampler, saul_sampler_rec_t *rec)
+{
+    unsigned state = irq_disable();
+    int idx = cib_get(&sampler->cib);
+
+    if (idx >= 0) {
+        memcpy(rec, &sampler->ring[idx], sizeof(saul_sampler_rec_t));
+    }
+    irq_restore(state);
+    return (idx >= 0);
+}
+
+unsigned saul_sampler_avail(saul_sampler_t *sampler)
+{
+    return cib_avail(&sampler->cib);
+}
@@ -227,7 +227,7 @@ int _gnrc_rpl_dodag_show(void)
 
     gnrc_rpl_dodag_t *dodag = NULL;
     char addr_str[IPV6_ADDR_MAX_STR_LEN];
-    int8_t cleanup;
+    uint64_t cleanup;
     uint64_t tc, ti, xnow = xtimer_now64();
 
     for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
@@ -250,7 +250,13 @@ int _gnrc_rpl_dodag_show(void)
                 | dodag->trickle.msg_interval_timer.target) - xnow;
         ti = (int64_t) ti < 0 ? 0 : ti / SEC_IN_USEC;
 
-        cleanup = dodag->instance->cleanup < 0 ? 0 : dodag->instance->cleanup;
+        /* time left until the pending cleanup removes the instance */
+        cleanup = 0;
+        if (dodag->instance->cleanup > 0) {
+            cleanup = (((uint64_t) dodag->instance->cleanup_timer.long_target << 32)
+                    | dodag->instance->cleanup_timer.target) - xnow;
+            cleanup = (int64_t) cleanup < 0 ? 0 : cleanup / SEC_IN_USEC;
+        }
 
         printf("\tdodag [%s | R: %d | OP: %s | PIO: %s | CL: %ds | "
                "TR(I=[%d,%d], k=%d, c=%d, TC=%" PRIu32 "s, TI=%" PRIu32 "s)]\n",
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to dump the binary log
+ *
+ * @}
+ */
+
+#include "log.h"
+
+int _log_dump_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    log_binary_dump();
+
+    return 0;
+}
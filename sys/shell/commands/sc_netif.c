@@ -125,6 +125,16 @@ static int _netif_stats(kernel_pid_t dev, unsigned module, bool reset)
                (unsigned) stats->tx_bytes,
                (unsigned) stats->tx_success,
                (unsigned) stats->tx_failed);
+        if (module == NETSTATS_LAYER2) {
+            printf("            Lost interrupts %u\n", (unsigned) stats->isr_lost);
+#ifdef MODULE_GNRC_NETDEV2_TXQ
+            for (unsigned i = 0; i < NETSTATS_TX_CLASSES; i++) {
+                printf("            TX class %u sent %u dropped %u\n", i,
+                       (unsigned) stats->tx_class_count[i],
+                       (unsigned) stats->tx_class_dropped[i]);
+            }
+#endif
+        }
         res = 0;
     }
     return res;
@@ -493,6 +503,11 @@ static void _netif_list(kernel_pid_t dev)
             printf("\n           ");
         }
     }
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+    printf("Source address cache: %" PRIu32 " hits, %" PRIu32 " misses",
+           entry->src_cache_hits, entry->src_cache_misses);
+    printf("\n           ");
+#endif
 #endif
 
 #ifdef MODULE_NETSTATS_L2
@@ -970,6 +985,7 @@ static int _netif_add(char *cmd_name, kernel_pid_t dev, int argc, char **argv)
     gnrc_ipv6_netif_addr_get(ifaddr)->valid = UINT32_MAX;
     /* Address shall be preferred infinitely */
     gnrc_ipv6_netif_addr_get(ifaddr)->preferred = UINT32_MAX;
+    gnrc_ipv6_netif_src_cache_flush(dev);
 
     printf("success: added %s/%d to interface %" PRIkernel_pid "\n", addr_str,
            prefix_len, dev);
@@ -57,6 +57,10 @@ extern int _at30tse75x_handler(int argc, char **argv);
 extern int _saul(int argc, char **argv);
 #endif
 
+#ifdef MODULE_LOG_BINARY
+extern int _log_dump_handler(int argc, char **argv);
+#endif
+
 #if FEATURE_PERIPH_RTC
 extern int _rtc_handler(int argc, char **argv);
 #endif
@@ -208,6 +212,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_SAUL_REG
     {"saul", "interact with sensors and actuators using SAUL", _saul },
 #endif
+#ifdef MODULE_LOG_BINARY
+    {"logdump", "print the buffered binary log records", _log_dump_handler },
+#endif
 #ifdef MODULE_CCN_LITE_UTILS
     { "ccnl_open", "opens an interface or socket", _ccnl_open},
     { "ccnl_int", "sends an interest", _ccnl_interest},
@@ -17,16 +17,42 @@
  * @}
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
+/* keeps the compiler from moving buffer accesses across counter updates */
+#define BARRIER()   __asm__ volatile ("" : : : "memory")
+
 static void _push(tsrb_t *rb, char c)
 {
-    rb->buf[rb->writes++ & (rb->size - 1)] = c;
+    rb->buf[rb->writes & (rb->size - 1)] = c;
+    BARRIER();
+    rb->writes++;
 }
 
 static char _pop(tsrb_t *rb)
 {
-    return rb->buf[rb->reads++ & (rb->size - 1)];
+    BARRIER();
+    char c = rb->buf[rb->reads & (rb->size - 1)];
+    BARRIER();
+    rb->reads++;
+    return c;
+}
+
+/* copies n bytes starting at the buffer position of counter pos */
+static void _copy_out(const tsrb_t *rb, unsigned pos, char *dst, size_t n)
+{
+    size_t idx = pos & (rb->size - 1);
+    size_t till_end = rb->size - idx;
+
+    if (n <= till_end) {
+        memcpy(dst, &rb->buf[idx], n);
+    }
+    else {
+        memcpy(dst, &rb->buf[idx], till_end);
+        memcpy(dst + till_end, rb->buf, n - till_end);
+    }
 }
 
 int tsrb_get_one(tsrb_t *rb)
@@ -39,14 +65,41 @@ int tsrb_get_one(tsrb_t *rb)
     }
 }
 
-int tsrb_get(tsrb_t *rb, char *dst, size_t n)
+int tsrb_peek(const tsrb_t *rb, char *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned avail = tsrb_avail(rb);
+
+    if (n > avail) {
+        n = avail;
     }
-    return (n - tmp);
+    BARRIER();
+    _copy_out(rb, rb->reads, dst, n);
+    return n;
+}
+
+int tsrb_get(tsrb_t *rb, char *dst, size_t n)
+{
+    n = tsrb_peek(rb, dst, n);
+    BARRIER();
+    rb->reads += n;
+    return n;
+}
+
+unsigned tsrb_read_span(const tsrb_t *rb, char **data)
+{
+    unsigned avail = tsrb_avail(rb);
+    unsigned idx = rb->reads & (rb->size - 1);
+    unsigned till_end = rb->size - idx;
+
+    *data = &rb->buf[idx];
+    return (avail < till_end) ? avail : till_end;
+}
+
+void tsrb_read_commit(tsrb_t *rb, unsigned n)
+{
+    assert(n <= tsrb_avail(rb));
+    BARRIER();
+    rb->reads += n;
 }
 
 int tsrb_add_one(tsrb_t *rb, char c)
@@ -62,10 +115,40 @@ int tsrb_add_one(tsrb_t *rb, char c)
 
 int tsrb_add(tsrb_t *rb, const char *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned writes = rb->writes;
+    unsigned free = tsrb_free(rb);
+    size_t idx = writes & (rb->size - 1);
+    size_t till_end = rb->size - idx;
+
+    if (n > free) {
+        n = free;
+    }
+    BARRIER();
+    if (n <= till_end) {
+        memcpy(&rb->buf[idx], src, n);
+    }
+    else {
+        memcpy(&rb->buf[idx], src, till_end);
+        memcpy(rb->buf, src + till_end, n - till_end);
     }
-    return (n - tmp);
+    BARRIER();
+    rb->writes = writes + n;
+    return n;
+}
+
+unsigned tsrb_write_span(const tsrb_t *rb, char **data)
+{
+    unsigned free = tsrb_free(rb);
+    unsigned idx = rb->writes & (rb->size - 1);
+    unsigned till_end = rb->size - idx;
+
+    *data = &rb->buf[idx];
+    return (free < till_end) ? free : till_end;
+}
+
+void tsrb_write_commit(tsrb_t *rb, unsigned n)
+{
+    assert(n <= tsrb_free(rb));
+    BARRIER();
+    rb->writes += n;
 }
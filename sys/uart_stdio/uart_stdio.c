@@ -33,6 +33,7 @@
 
 #include "board.h"
 #include "periph/uart.h"
+#include "uart_async.h"
 
 #ifdef USE_ETHOS_FOR_STDIO
 #include "ethos.h"
@@ -62,6 +63,7 @@ void uart_stdio_rx_cb(void *arg, uint8_t data)
 void uart_stdio_init(void)
 {
 #ifndef USE_ETHOS_FOR_STDIO
+    uart_async_init(UART_STDIO_DEV, UART_STDIO_TX_POLICY);
     uart_init(UART_STDIO_DEV, UART_STDIO_BAUDRATE, uart_stdio_rx_cb, NULL);
 #else
     uart_init(ETHOS_UART, ETHOS_BAUDRATE, uart_stdio_rx_cb, NULL);
@@ -80,7 +82,8 @@ int uart_stdio_read(char* buffer, int count)
 int uart_stdio_write(const char* buffer, int len)
 {
 #ifndef USE_ETHOS_FOR_STDIO
-    uart_write(UART_STDIO_DEV, (uint8_t *)buffer, (size_t)len);
+    /* report dropped bytes as written, so stdio does not retry them */
+    uart_write_async(UART_STDIO_DEV, (uint8_t *)buffer, (size_t)len);
 #else
     ethos_send_frame(&ethos, (uint8_t*)buffer, len, ETHOS_FRAME_TYPE_TEXT);
 #endif
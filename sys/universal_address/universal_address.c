@@ -56,11 +56,69 @@ static size_t universal_address_table_filled = 0;
  */
 static universal_address_container_t universal_address_table[UNIVERSAL_ADDRESS_MAX_ENTRIES];
 
+#ifdef MODULE_FIB_DYNAMIC
+/**
+ * @brief Number of containers allocated at once when all containers are in use
+ */
+#ifndef UNIVERSAL_ADDRESS_CHUNK_SIZE
+#define UNIVERSAL_ADDRESS_CHUNK_SIZE    (8)
+#endif
+
+/**
+ * @brief A chunk of containers allocated from the heap.
+ *        Chunks are never moved or freed, since their containers are referenced
+ */
+typedef struct universal_address_chunk {
+    struct universal_address_chunk *next;   /**< the next chunk */
+    /** the containers of this chunk */
+    universal_address_container_t entries[UNIVERSAL_ADDRESS_CHUNK_SIZE];
+} universal_address_chunk_t;
+
+/**
+ * @brief The chunks allocated in addition to universal_address_table
+ */
+static universal_address_chunk_t *universal_address_chunks = NULL;
+
+/**
+ * @brief the total number of containers
+ */
+static size_t universal_address_table_size = UNIVERSAL_ADDRESS_MAX_ENTRIES;
+#else
+#define universal_address_table_size    (UNIVERSAL_ADDRESS_MAX_ENTRIES)
+#endif
+
 /**
  * @brief access mutex to control exclusive operations on calls
  */
 static mutex_t mtx_access = MUTEX_INIT;
 
+/**
+ * @brief finds the universal address container for the given address in
+ *        an array of containers
+ *
+ * @param[in] table      the containers
+ * @param[in] num        the number of containers
+ * @param[in] addr       pointer to the address
+ * @param[in] addr_size  the number of bytes required for the address entry
+ *
+ * @return pointer to the universal_address_container_t containing the address on success
+ *         NULL if the address is not in table
+ */
+static universal_address_container_t *universal_address_find_in(universal_address_container_t *table,
+                                                                 size_t num, uint8_t *addr,
+                                                                 size_t addr_size)
+{
+    for (size_t i = 0; i < num; ++i) {
+        if (table[i].address_size == addr_size) {
+            if (memcmp((table[i].address), addr, addr_size) == 0) {
+                return &(table[i]);
+            }
+        }
+    }
+
+    return NULL;
+}
+
 /**
  * @brief finds the universal address container for the given address
  *
@@ -72,11 +130,37 @@ static mutex_t mtx_access = MUTEX_INIT;
  */
 static universal_address_container_t *universal_address_find_entry(uint8_t *addr, size_t addr_size)
 {
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        if (universal_address_table[i].address_size == addr_size) {
-            if (memcmp((universal_address_table[i].address), addr, addr_size) == 0) {
-                return &(universal_address_table[i]);
-            }
+    universal_address_container_t *pEntry;
+
+    pEntry = universal_address_find_in(universal_address_table, UNIVERSAL_ADDRESS_MAX_ENTRIES,
+                                       addr, addr_size);
+#ifdef MODULE_FIB_DYNAMIC
+    for (universal_address_chunk_t *chunk = universal_address_chunks;
+         (pEntry == NULL) && (chunk != NULL); chunk = chunk->next) {
+        pEntry = universal_address_find_in(chunk->entries, UNIVERSAL_ADDRESS_CHUNK_SIZE,
+                                           addr, addr_size);
+    }
+#endif
+
+    return pEntry;
+}
+
+/**
+ * @brief finds the next unused universal address container in an array of
+ *        containers
+ *
+ * @param[in] table      the containers
+ * @param[in] num        the number of containers
+ *
+ * @return pointer to the next unused universal_address_container_t
+ *         or NULL if all containers of table are in use
+ */
+static universal_address_container_t *universal_address_unused_in(universal_address_container_t *table,
+                                                                  size_t num)
+{
+    for (size_t i = 0; i < num; ++i) {
+        if (table[i].use_count == 0) {
+            return &(table[i]);
         }
     }
 
@@ -91,13 +175,32 @@ static universal_address_container_t *universal_address_find_entry(uint8_t *addr
  */
 static universal_address_container_t *universal_address_get_next_unused_entry(void)
 {
-    if (universal_address_table_filled < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
-        for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-            if (universal_address_table[i].use_count == 0) {
-                return &(universal_address_table[i]);
-            }
+    if (universal_address_table_filled < universal_address_table_size) {
+        universal_address_container_t *pEntry;
+
+        pEntry = universal_address_unused_in(universal_address_table,
+                                             UNIVERSAL_ADDRESS_MAX_ENTRIES);
+#ifdef MODULE_FIB_DYNAMIC
+        for (universal_address_chunk_t *chunk = universal_address_chunks;
+             (pEntry == NULL) && (chunk != NULL); chunk = chunk->next) {
+            pEntry = universal_address_unused_in(chunk->entries, UNIVERSAL_ADDRESS_CHUNK_SIZE);
         }
+#endif
+        return pEntry;
+    }
+
+#ifdef MODULE_FIB_DYNAMIC
+    /* all containers are in use, so we get a new chunk */
+    universal_address_chunk_t *chunk = calloc(1, sizeof(universal_address_chunk_t));
+
+    if (chunk != NULL) {
+        DEBUG("[universal_address_get_next_unused_entry] new chunk: %p\n", (void *)chunk);
+        chunk->next = universal_address_chunks;
+        universal_address_chunks = chunk;
+        universal_address_table_size += UNIVERSAL_ADDRESS_CHUNK_SIZE;
+        return &(chunk->entries[0]);
     }
+#endif
 
     return NULL;
 }
@@ -166,6 +269,20 @@ void universal_address_rem(universal_address_container_t *entry)
     mutex_unlock(&mtx_access);
 }
 
+universal_address_container_t *universal_address_search(uint8_t *addr, size_t addr_size)
+{
+    mutex_lock(&mtx_access);
+    universal_address_container_t *pEntry = universal_address_find_entry(addr, addr_size);
+
+    if ((pEntry != NULL) && (pEntry->use_count == 0)) {
+        /* the container is a leftover of a removed address */
+        pEntry = NULL;
+    }
+
+    mutex_unlock(&mtx_access);
+    return pEntry;
+}
+
 uint8_t* universal_address_get_address(universal_address_container_t *entry,
                                   uint8_t *addr, size_t *addr_size)
 {
@@ -294,11 +411,13 @@ void universal_address_init(void)
 {
     mutex_lock(&mtx_access);
 
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        universal_address_table[i].use_count = 0;
-        universal_address_table[i].address_size = 0;
-        memset(universal_address_table[i].address, 0, UNIVERSAL_ADDRESS_SIZE);
+    memset(universal_address_table, 0, sizeof(universal_address_table));
+#ifdef MODULE_FIB_DYNAMIC
+    for (universal_address_chunk_t *chunk = universal_address_chunks; chunk != NULL;
+         chunk = chunk->next) {
+        memset(chunk->entries, 0, sizeof(chunk->entries));
     }
+#endif
 
     mutex_unlock(&mtx_access);
 }
@@ -310,6 +429,14 @@ void universal_address_reset(void)
     for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
         universal_address_table[i].use_count = 0;
     }
+#ifdef MODULE_FIB_DYNAMIC
+    for (universal_address_chunk_t *chunk = universal_address_chunks; chunk != NULL;
+         chunk = chunk->next) {
+        for (size_t i = 0; i < UNIVERSAL_ADDRESS_CHUNK_SIZE; ++i) {
+            chunk->entries[i].use_count = 0;
+        }
+    }
+#endif
 
     universal_address_table_filled = 0;
     mutex_unlock(&mtx_access);
@@ -351,4 +478,12 @@ void universal_address_print_table(void)
     for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
         universal_address_print_entry(&universal_address_table[i]);
     }
+#ifdef MODULE_FIB_DYNAMIC
+    for (universal_address_chunk_t *chunk = universal_address_chunks; chunk != NULL;
+         chunk = chunk->next) {
+        for (size_t i = 0; i < UNIVERSAL_ADDRESS_CHUNK_SIZE; ++i) {
+            universal_address_print_entry(&chunk->entries[i]);
+        }
+    }
+#endif
 }
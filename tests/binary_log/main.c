@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the binary log module
+ *
+ * Decode the output with dist/tools/log_binary/decode.py.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "log.h"
+#include "xtimer.h"
+
+/* records of LOG_DEBUG("...", i, n) fit into the buffer */
+#define BATCH   (LOG_BINARY_BUFSIZE / 4)
+#define RUNS    (100U)
+
+static const char *name = "log_binary";
+
+int main(void)
+{
+    uint32_t total = 0;
+
+    LOG_INFO("%s test application\n", name);
+    LOG_WARNING("signed %d, unsigned %u, hex 0x%04x, char '%c'\n",
+                -42, 42U, 0xbeef, 'x');
+    LOG_ERROR("no arguments\n");
+    log_binary_dump();
+
+    for (unsigned n = 0; n < RUNS; n++) {
+        uint32_t start = xtimer_now();
+        for (unsigned i = 0; i < BATCH; i++) {
+            LOG_DEBUG("iteration %u of run %u\n", i, n);
+        }
+        total += xtimer_now() - start;
+        /* discard the records */
+        log_binary_clear();
+    }
+    printf("%u LOG_DEBUG calls took %" PRIu32 "us\n", RUNS * BATCH, total);
+    printf("%u records dropped\n", log_binary_dropped());
+
+    return 0;
+}
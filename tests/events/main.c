@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for the event queue
+ *
+ * Checks posting from thread and ISR context, duplicate posts and
+ * cancellation, and compares the hand-off latency of event_post() with
+ * msg_send() to a thread of higher priority.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define BENCH_ROUNDS    (1000U)
+
+static char _ev_stack[THREAD_STACKSIZE_MAIN];
+static char _msg_stack[THREAD_STACKSIZE_MAIN];
+static event_queue_t _queue;
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    _handled++;
+}
+
+static event_t _event = EVENT_INIT(_handler);
+static event_t _isr_event = EVENT_INIT(_handler);
+
+static void *_ev_thread(void *arg)
+{
+    (void)arg;
+    event_queue_init(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+static void *_msg_thread(void *arg)
+{
+    msg_t msg, msg_q[1];
+
+    (void)arg;
+    msg_init_queue(msg_q, 1);
+    while (1) {
+        msg_receive(&msg);
+        _handled++;
+    }
+    return NULL;
+}
+
+static void _isr_cb(void *arg)
+{
+    (void)arg;
+    event_post(&_queue, &_isr_event);
+}
+
+static int _check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("error: %s\n", what);
+    }
+    return cond;
+}
+
+int main(void)
+{
+    event_queue_t unclaimed = EVENT_QUEUE_INIT;
+    xtimer_t timer;
+    kernel_pid_t msg_pid;
+    uint32_t start, ev_time, msg_time;
+    int ok = 1;
+
+    puts("events test");
+    thread_create(_ev_stack, sizeof(_ev_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _ev_thread, NULL, "ev");
+    msg_pid = thread_create(_msg_stack, sizeof(_msg_stack),
+                            THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                            _msg_thread, NULL, "msg");
+
+    /* the higher priority thread handles the event right away */
+    event_post(&_queue, &_event);
+    ok &= _check(_handled == 1, "event posted from thread not handled");
+
+    /* post from ISR context */
+    timer.callback = _isr_cb;
+    xtimer_set(&timer, 1000);
+    xtimer_usleep(10000);
+    ok &= _check(_handled == 2, "event posted from ISR not handled");
+
+    /* an event is queued only once */
+    event_post(&unclaimed, &_event);
+    event_post(&unclaimed, &_event);
+    ok &= _check(event_get(&unclaimed) == &_event, "event not queued");
+    ok &= _check(event_get(&unclaimed) == NULL, "event queued twice");
+
+    /* a cancelled event is not handled */
+    event_post(&unclaimed, &_event);
+    event_post(&unclaimed, &_isr_event);
+    event_cancel(&unclaimed, &_event);
+    ok &= _check(event_get(&unclaimed) == &_isr_event, "wrong event dequeued");
+    ok &= _check(event_get(&unclaimed) == NULL, "cancelled event dequeued");
+
+    /* compare hand-off latency to a higher priority thread */
+    _handled = 0;
+    start = xtimer_now();
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        event_post(&_queue, &_event);
+    }
+    ev_time = xtimer_now() - start;
+    ok &= _check(_handled == BENCH_ROUNDS, "events lost");
+
+    _handled = 0;
+    start = xtimer_now();
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        msg_t msg;
+        msg_send(&msg, msg_pid);
+    }
+    msg_time = xtimer_now() - start;
+    ok &= _check(_handled == BENCH_ROUNDS, "messages lost");
+
+    printf("%u hand-offs: event_post() %" PRIu32 " us, msg_send() %" PRIu32
+           " us\n", BENCH_ROUNDS, ev_time, msg_time);
+
+    if (ok) {
+        puts("Test successful.");
+    }
+    return 0;
+}
@@ -14,17 +14,216 @@
  * @brief       fmt print test application
  *
  * This test is supposed to check for "compilabilty" of the fmt print_* instructions.
+ * It also compares the speed of the fmt conversions to the previous
+ * digit-by-digit and byte-by-byte implementations.
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
+#include <string.h>
+
 #include "fmt.h"
+#include "xtimer.h"
+
+#define RUNS        (10000U)
+#define HEX_BYTES   (64U)
+
+static const char _hex_chars[16] = "0123456789ABCDEF";
+static uint8_t _bytes[HEX_BYTES];
+static char _out[2 * HEX_BYTES];
+static char _ref[2 * HEX_BYTES];
+static int _failed;
+
+/* previous implementations for reference */
+static size_t _ref_u32_dec(char *out, uint32_t val)
+{
+    size_t len = 1;
+
+    for (uint32_t tmp = val; (tmp > 9); len++) {
+        tmp /= 10;
+    }
+
+    if (out) {
+        char *ptr = out + len;
+        do {
+            *--ptr = (val % 10) + '0';
+        } while ((val /= 10));
+    }
+
+    return len;
+}
+
+static size_t _ref_u64_dec(char *out, uint64_t val)
+{
+    uint32_t d[5];
+    uint32_t q;
+    size_t len = 0;
+
+    d[0] = val       & 0xFFFF;
+    d[1] = (val>>16) & 0xFFFF;
+    d[2] = (val>>32) & 0xFFFF;
+    d[3] = (val>>48) & 0xFFFF;
+
+    d[0] = 656 * d[3] + 7296 * d[2] + 5536 * d[1] + d[0];
+    q = d[0] / 10000;
+    d[0] = d[0] % 10000;
+
+    d[1] = q + 7671 * d[3] + 9496 * d[2] + 6 * d[1];
+    q = d[1] / 10000;
+    d[1] = d[1] % 10000;
+
+    d[2] = q + 4749 * d[3] + 42 * d[2];
+    q = d[2] / 10000;
+    d[2] = d[2] % 10000;
+
+    d[3] = q + 281 * d[3];
+    q = d[3] / 10000;
+    d[3] = d[3] % 10000;
+
+    d[4] = q;
+
+    int first = 4;
+
+    while (!d[first] && first) {
+        first--;
+    }
+
+    len = _ref_u32_dec(out, d[first]);
+    int total_len = len + (first * 4);
+
+    if (out) {
+        out += len;
+        memset(out, '0', total_len - len);
+        while(first) {
+            first--;
+            if (d[first]) {
+                size_t tmp = _ref_u32_dec(NULL, d[first]);
+                _ref_u32_dec(out+(4-tmp), d[first]);
+            }
+            out += 4;
+        }
+    }
+
+    return total_len;
+}
+
+static size_t _ref_bytes_hex_reverse(char *out, const uint8_t *ptr, size_t n)
+{
+    size_t i = n;
+    while (i--) {
+        *out++ = _hex_chars[ptr[i] >> 4];
+        *out++ = _hex_chars[ptr[i] & 0x0F];
+    }
+    return (n<<1);
+}
+
+static uint64_t _val(unsigned i)
+{
+    /* values of all lengths */
+    return ((uint64_t)i * 0x9e3779b97f4a7c15ULL) >> (i % 64);
+}
+
+static void _check(size_t len, size_t ref_len)
+{
+    if ((len != ref_len) || memcmp(_out, _ref, len)) {
+        _failed = 1;
+    }
+}
+
+static void _result(const char *name, uint32_t time, uint32_t ref_time)
+{
+    print_str(name);
+    print_str(": ");
+    print_u32_dec(time);
+    print_str("us (previous implementation: ");
+    print_u32_dec(ref_time);
+    print_str("us)\n");
+}
+
+static void bench_u32_dec(void)
+{
+    uint32_t start, time, ref_time;
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_u32_dec(_out, (uint32_t)_val(i));
+    }
+    time = xtimer_now() - start;
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        _ref_u32_dec(_ref, (uint32_t)_val(i));
+    }
+    ref_time = xtimer_now() - start;
+
+    for (unsigned i = 0; i < RUNS; i++) {
+        _check(fmt_u32_dec(_out, (uint32_t)_val(i)),
+               _ref_u32_dec(_ref, (uint32_t)_val(i)));
+    }
+    _result("fmt_u32_dec", time, ref_time);
+}
+
+static void bench_u64_dec(void)
+{
+    uint32_t start, time, ref_time;
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_u64_dec(_out, _val(i));
+    }
+    time = xtimer_now() - start;
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        _ref_u64_dec(_ref, _val(i));
+    }
+    ref_time = xtimer_now() - start;
+
+    for (unsigned i = 0; i < RUNS; i++) {
+        _check(fmt_u64_dec(_out, _val(i)), _ref_u64_dec(_ref, _val(i)));
+    }
+    _result("fmt_u64_dec", time, ref_time);
+}
+
+static void bench_bytes_hex(void)
+{
+    uint32_t start, time, ref_time;
+
+    for (unsigned i = 0; i < HEX_BYTES; i++) {
+        _bytes[i] = (uint8_t)_val(i);
+    }
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_bytes_hex_reverse(_out, _bytes, HEX_BYTES);
+    }
+    time = xtimer_now() - start;
+
+    start = xtimer_now();
+    for (unsigned i = 0; i < RUNS; i++) {
+        _ref_bytes_hex_reverse(_ref, _bytes, HEX_BYTES);
+    }
+    ref_time = xtimer_now() - start;
+
+    _check(fmt_bytes_hex_reverse(_out, _bytes, HEX_BYTES),
+           _ref_bytes_hex_reverse(_ref, _bytes, HEX_BYTES));
+    _result("fmt_bytes_hex_reverse", time, ref_time);
+}
 
 int main(void)
 {
     print_str("If you can read this:\n");
+
+    bench_u32_dec();
+    bench_u64_dec();
+    bench_bytes_hex();
+
+    if (_failed) {
+        print_str("Test failed: output differs from previous implementation\n");
+        return 1;
+    }
     print_str("Test successful.\n");
 
     return 0;
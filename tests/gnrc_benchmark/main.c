@@ -0,0 +1,783 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark and stress test for the GNRC 6LoWPAN/IPv6/UDP stack
+ *
+ * A @ref sys_netdev2_test device reflects every unicast frame back to the
+ * stack, so UDP datagrams travel the full send and receive paths. Results
+ * are printed as CSV or JSON, one line per run. See README.md.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cib.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netdev2/ieee802154.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/udp.h"
+#include "net/ieee802154.h"
+#include "net/netdev2_test.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define BENCH_THREADS_MAX   (4U)        /**< maximum number of sender threads */
+#define BENCH_PORT          (0xf0b0U)   /**< first UDP port (NHC compressible) */
+#define BENCH_PAYLOAD_MAX   (512U)      /**< maximum UDP payload size */
+#define BENCH_WINDOW        (4U)        /**< packets in flight per closed-loop sender */
+#define BENCH_TIMEOUT_US    (500000U)   /**< give up on outstanding packets */
+#define BENCH_STRESS_GAP_US (2000U)     /**< maximum random gap in stress mode */
+#define BENCH_RING          (16U)       /**< frames buffered by the reflector */
+#define BENCH_FRAME_MAX     (127U)      /**< aMaxPHYPacketSize of IEEE 802.15.4 */
+#define BENCH_STAMPS        (64U)       /**< device timestamps per sender */
+#define BENCH_SAMPLES       (1024U)     /**< latency samples per stage */
+#define BENCH_MAGIC         "RIOT"
+
+#define BENCH_MSG_CREDIT    (0x0b01)
+#define BENCH_MSG_DONE      (0x0b02)
+
+#define _MAC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT + THREAD_EXTRA_STACKSIZE_PRINTF)
+#define _MAC_PRIO           (THREAD_PRIORITY_MAIN - 5)
+#define _SENDER_PRIO        (THREAD_PRIORITY_MAIN - 1)
+#define _SINK_PRIO          (THREAD_PRIORITY_MAIN - 1)
+#define _SINK_QUEUE_SIZE    (16U)
+
+/**
+ * @brief   Header at the start of every UDP payload
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t magic[4];       /**< BENCH_MAGIC, found by the device in frames */
+    uint32_t seq;           /**< per-sender sequence number */
+    uint32_t sent;          /**< xtimer_now() when handed to the stack */
+    uint16_t len;           /**< full payload length */
+    uint8_t sender;         /**< sender thread id */
+    uint8_t pad;
+} bench_hdr_t;
+
+/**
+ * @brief   Timestamps taken by the device for a packet
+ */
+typedef struct {
+    uint32_t seq;
+    uint32_t dev_tx;        /**< first frame handed to the device */
+    uint32_t dev_rx;        /**< first frame read back by the stack */
+} bench_stamp_t;
+
+/**
+ * @brief   Latency samples of one stage
+ */
+typedef struct {
+    uint32_t samples[BENCH_SAMPLES];
+    uint32_t num;           /**< number of values seen */
+    uint32_t max;
+} bench_stage_t;
+
+enum {
+    STAGE_TX = 0,           /**< application to device */
+    STAGE_LINK,             /**< device to stack (reflector queueing) */
+    STAGE_RX,               /**< stack to application */
+    STAGE_TOTAL,            /**< application to application */
+    STAGE_NUMOF,
+};
+
+static const char *_stage_names[] = { "tx", "link", "rx", "total" };
+
+typedef struct {
+    uint8_t frame[BENCH_FRAME_MAX];
+    uint8_t len;
+    int8_t hdr_pos;         /**< offset of a bench_hdr_t in frame or -1 */
+} bench_frame_t;
+
+typedef struct {
+    char stack[THREAD_STACKSIZE_MAIN];
+    msg_t queue[2 * BENCH_WINDOW];
+    kernel_pid_t pid;
+    uint8_t id;
+    uint32_t prng;
+    uint32_t count;         /**< packets to send */
+    uint32_t tx;
+    uint32_t tx_fail;
+} bench_sender_t;
+
+static const char *_mode;
+static uint16_t _size;      /**< 0 for random sizes */
+static uint32_t _rate;      /**< packets per second over all senders, 0 closed-loop */
+static uint32_t _seed;
+static unsigned _threads;
+static bool _json;
+
+/* device */
+static char _mac_stack[_MAC_STACKSIZE];
+static gnrc_netdev2_t _gnrc_dev;
+static netdev2_test_t _dev;
+static kernel_pid_t _iface;
+static const uint8_t _dev_l2[] = { 0x02, 0x1b, 0x5e, 0xc4, 0x00, 0x00, 0xb0, 0x01 };
+static const uint8_t _peer_l2[] = { 0x02, 0x1b, 0x5e, 0xc4, 0x00, 0x00, 0xb0, 0x02 };
+static ipv6_addr_t _peer_addr;
+static bench_frame_t _ring[BENCH_RING];
+static cib_t _ring_cib = CIB_INIT(BENCH_RING);
+static volatile bool _rx_pending;
+static bench_stamp_t _stamps[BENCH_THREADS_MAX][BENCH_STAMPS];
+static uint32_t _dev_frames, _dev_drops;
+
+/* senders and sink */
+static bench_sender_t _senders[BENCH_THREADS_MAX];
+static char _sink_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _sink_queue[_SINK_QUEUE_SIZE];
+static gnrc_netreg_entry_t _sink_regs[BENCH_THREADS_MAX];
+static kernel_pid_t _sink_pid, _main_pid;
+static bench_stage_t _stages[STAGE_NUMOF];
+static uint32_t _sink_prng = 1;
+static volatile uint32_t _rx, _rx_bytes, _corrupt, _rx_last;
+
+static uint32_t _xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static inline uint8_t _pattern(const bench_hdr_t *hdr, size_t i)
+{
+    /* consecutive bytes differ by one so BENCH_MAGIC never shows up */
+    return (uint8_t)((hdr->seq * 31) + hdr->sender + i);
+}
+
+static int _find_hdr(const uint8_t *frame, size_t start, size_t len)
+{
+    for (size_t i = start; (i + sizeof(bench_hdr_t)) <= len; i++) {
+        if ((frame[i] == BENCH_MAGIC[0]) &&
+            (memcmp(&frame[i], BENCH_MAGIC, sizeof(((bench_hdr_t *)0)->magic)) == 0)) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static bench_stamp_t *_stamp_get(const uint8_t *frame, int hdr_pos)
+{
+    bench_hdr_t hdr;
+
+    memcpy(&hdr, &frame[hdr_pos], sizeof(hdr));
+    if (hdr.sender >= BENCH_THREADS_MAX) {
+        return NULL;
+    }
+    return &_stamps[hdr.sender][hdr.seq % BENCH_STAMPS];
+}
+
+/*
+ * Reflector device: every unicast frame to the peer is queued with source
+ * and destination swapped and read back by the stack. Since the IPv6
+ * addresses are elided by IPHC they are swapped alongside, and sender and
+ * receiver use the same UDP port.
+ */
+static int _dev_send(netdev2_t *dev, const struct iovec *vector, int count)
+{
+    netdev2_ieee802154_t *netdev = (netdev2_ieee802154_t *)dev;
+    const uint8_t *mhr = vector[0].iov_base;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN], dst[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t pan;
+    bench_frame_t *frame;
+    size_t len = 0, mhr_len;
+    int idx;
+
+    for (int i = 0; i < count; i++) {
+        len += vector[i].iov_len;
+    }
+    _dev_frames++;
+    if ((ieee802154_get_dst(mhr, dst, &pan) != sizeof(_peer_l2)) ||
+        (memcmp(dst, _peer_l2, sizeof(_peer_l2)) != 0) ||
+        (ieee802154_get_src(mhr, src, &pan) != sizeof(_dev_l2))) {
+        /* router solicitations and the like */
+        return (int)len;
+    }
+    if ((len > BENCH_FRAME_MAX) || ((idx = cib_put(&_ring_cib)) < 0)) {
+        /* lost on the "air" */
+        _dev_drops++;
+        return (int)len;
+    }
+    frame = &_ring[idx];
+    mhr_len = ieee802154_set_frame_hdr(frame->frame, dst, sizeof(dst), src,
+                                       sizeof(src), pan, pan,
+                                       mhr[0] & ~IEEE802154_FCF_ACK_REQ,
+                                       ieee802154_get_seq(mhr));
+    frame->len = (uint8_t)mhr_len;
+    for (int i = 1; i < count; i++) {
+        memcpy(&frame->frame[frame->len], vector[i].iov_base, vector[i].iov_len);
+        frame->len += vector[i].iov_len;
+    }
+    frame->hdr_pos = (int8_t)_find_hdr(frame->frame, mhr_len, frame->len);
+    if (frame->hdr_pos >= 0) {
+        bench_stamp_t *stamp = _stamp_get(frame->frame, frame->hdr_pos);
+
+        if (stamp != NULL) {
+            memcpy(&stamp->seq, &frame->frame[frame->hdr_pos + offsetof(bench_hdr_t, seq)],
+                   sizeof(stamp->seq));
+            stamp->dev_tx = xtimer_now();
+            stamp->dev_rx = 0;
+        }
+    }
+    if (!_rx_pending) {
+        _rx_pending = true;
+        netdev->netdev.event_callback(dev, NETDEV2_EVENT_ISR);
+    }
+    return (int)len;
+}
+
+static int _dev_recv(netdev2_t *dev, char *buf, int len, void *info)
+{
+    netdev2_ieee802154_rx_info_t *rx_info = info;
+    bench_frame_t *frame;
+    int idx = cib_peek(&_ring_cib);
+
+    (void)dev;
+    if (idx < 0) {
+        return 0;
+    }
+    frame = &_ring[idx];
+    if (buf == NULL) {
+        if (len > 0) {
+            cib_get(&_ring_cib);
+            _dev_drops++;
+        }
+        return frame->len;
+    }
+    if (len < frame->len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, frame->frame, frame->len);
+    if (frame->hdr_pos >= 0) {
+        bench_stamp_t *stamp = _stamp_get(frame->frame, frame->hdr_pos);
+
+        if (stamp != NULL) {
+            stamp->dev_rx = xtimer_now();
+        }
+    }
+    if (rx_info != NULL) {
+        rx_info->rssi = UINT8_MAX;
+        rx_info->lqi = UINT8_MAX;
+    }
+    len = frame->len;
+    cib_get(&_ring_cib);
+    return len;
+}
+
+static void _dev_isr(netdev2_t *dev)
+{
+    netdev2_ieee802154_t *netdev = (netdev2_ieee802154_t *)dev;
+    unsigned avail;
+
+    _rx_pending = false;
+    avail = cib_avail(&_ring_cib);
+    while (avail--) {
+        unsigned before = cib_avail(&_ring_cib);
+
+        netdev->netdev.event_callback(dev, NETDEV2_EVENT_RX_COMPLETE);
+        if (cib_avail(&_ring_cib) == before) {
+            /* stack could not take the frame (packet buffer full): drop it */
+            cib_get(&_ring_cib);
+            _dev_drops++;
+        }
+    }
+}
+
+#define _DEV_GET(name, opt) \
+    static int name(netdev2_t *dev, void *value, size_t max_len) \
+    { \
+        return netdev2_ieee802154_get((netdev2_ieee802154_t *)dev, opt, value, \
+                                      max_len); \
+    }
+
+_DEV_GET(_get_addr, NETOPT_ADDRESS)
+_DEV_GET(_get_addr_long, NETOPT_ADDRESS_LONG)
+_DEV_GET(_get_addr_len, NETOPT_ADDR_LEN)
+_DEV_GET(_get_src_len, NETOPT_SRC_LEN)
+_DEV_GET(_get_nid, NETOPT_NID)
+_DEV_GET(_get_proto, NETOPT_PROTO)
+_DEV_GET(_get_device_type, NETOPT_DEVICE_TYPE)
+_DEV_GET(_get_ipv6_iid, NETOPT_IPV6_IID)
+
+static int _get_max_packet_size(netdev2_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(uint16_t)) {
+        return -EOVERFLOW;
+    }
+    *((uint16_t *)value) = BENCH_FRAME_MAX - IEEE802154_MAX_HDR_LEN -
+                           IEEE802154_FCS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _set_src_len(netdev2_t *dev, void *value, size_t value_len)
+{
+    return netdev2_ieee802154_set((netdev2_ieee802154_t *)dev, NETOPT_SRC_LEN,
+                                  value, value_len);
+}
+
+static void _dev_init(void)
+{
+    netdev2_ieee802154_t *netdev = (netdev2_ieee802154_t *)&_dev;
+    eui64_t iid;
+
+    netdev2_test_setup(&_dev, NULL);
+    netdev2_test_set_send_cb(&_dev, _dev_send);
+    netdev2_test_set_recv_cb(&_dev, _dev_recv);
+    netdev2_test_set_isr_cb(&_dev, _dev_isr);
+    netdev2_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_addr);
+    netdev2_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev2_test_set_get_cb(&_dev, NETOPT_ADDR_LEN, _get_addr_len);
+    netdev2_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev2_test_set_get_cb(&_dev, NETOPT_NID, _get_nid);
+    netdev2_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev2_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev2_test_set_get_cb(&_dev, NETOPT_IPV6_IID, _get_ipv6_iid);
+    netdev2_test_set_get_cb(&_dev, NETOPT_MAX_PACKET_SIZE, _get_max_packet_size);
+    netdev2_test_set_set_cb(&_dev, NETOPT_SRC_LEN, _set_src_len);
+    netdev->proto = GNRC_NETTYPE_SIXLOWPAN;
+    netdev->pan = 0x23;
+    netdev->flags = NETDEV2_IEEE802154_SRC_MODE_LONG | NETDEV2_IEEE802154_PAN_COMP;
+    memcpy(netdev->long_addr, _dev_l2, sizeof(_dev_l2));
+    memcpy(netdev->short_addr, &_dev_l2[sizeof(_dev_l2) - IEEE802154_SHORT_ADDRESS_LEN],
+           IEEE802154_SHORT_ADDRESS_LEN);
+    /* peer is on-link: its link-local address is derived from its EUI-64 */
+    memcpy(iid.uint8, _peer_l2, sizeof(_peer_l2));
+    iid.uint8[0] ^= 0x02;
+    ipv6_addr_set_aiid(&_peer_addr, iid.uint8);
+    ipv6_addr_set_link_local_prefix(&_peer_addr);
+
+    gnrc_netdev2_ieee802154_init(&_gnrc_dev, netdev);
+    _iface = gnrc_netdev2_init(_mac_stack, sizeof(_mac_stack), _MAC_PRIO,
+                               "bench_dev", &_gnrc_dev);
+}
+
+static void _dev_kick(void)
+{
+    /* the ISR message may have been lost on a full message queue */
+    if ((cib_avail(&_ring_cib) > 0) && (_dev.netdev.netdev.event_callback != NULL)) {
+        _rx_pending = true;
+        _dev.netdev.netdev.event_callback((netdev2_t *)&_dev, NETDEV2_EVENT_ISR);
+    }
+}
+
+/* senders */
+static int _send(bench_sender_t *s, uint32_t seq, uint16_t size)
+{
+    gnrc_pktsnip_t *payload, *udp, *ip, *netif;
+    bench_hdr_t hdr;
+    uint16_t port = BENCH_PORT + s->id;
+
+    payload = gnrc_pktbuf_add_headroom(NULL, NULL, size, GNRC_PKTBUF_HEADROOM,
+                                       GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOBUFS;
+    }
+    memcpy(hdr.magic, BENCH_MAGIC, sizeof(hdr.magic));
+    hdr.seq = seq;
+    hdr.len = size;
+    hdr.sender = s->id;
+    hdr.pad = 0;
+    for (size_t i = sizeof(hdr); i < size; i++) {
+        ((uint8_t *)payload->data)[i] = _pattern(&hdr, i);
+    }
+    udp = gnrc_udp_hdr_build(payload, port, port);
+    if (udp == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOBUFS;
+    }
+    ip = gnrc_ipv6_hdr_build(udp, NULL, &_peer_addr);
+    if (ip == NULL) {
+        gnrc_pktbuf_release(udp);
+        return -ENOBUFS;
+    }
+    netif = gnrc_pktbuf_add(ip, NULL, sizeof(gnrc_netif_hdr_t), GNRC_NETTYPE_NETIF);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ip);
+        return -ENOBUFS;
+    }
+    gnrc_netif_hdr_init(netif->data, 0, 0);
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _iface;
+    ip = netif;
+    hdr.sent = xtimer_now();
+    memcpy(payload->data, &hdr, sizeof(hdr));
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL, ip)) {
+        gnrc_pktbuf_release(ip);
+        return -ENOTCONN;
+    }
+    return 0;
+}
+
+static void *_sender(void *arg)
+{
+    bench_sender_t *s = arg;
+    uint32_t last = xtimer_now();
+    uint32_t period = (_rate > 0) ? (_threads * SEC_IN_USEC) / _rate : 0;
+    unsigned inflight = 0;
+    msg_t msg;
+
+    msg_init_queue(s->queue, sizeof(s->queue) / sizeof(s->queue[0]));
+    for (uint32_t seq = 0; seq < s->count; seq++) {
+        uint16_t size = _size;
+
+        if (period > 0) {
+            xtimer_usleep_until(&last, period);
+        }
+        else {
+            while (inflight >= BENCH_WINDOW) {
+                if (xtimer_msg_receive_timeout(&msg, BENCH_TIMEOUT_US) < 0) {
+                    /* outstanding packets are lost */
+                    inflight = 0;
+                }
+                else if (msg.type == BENCH_MSG_CREDIT) {
+                    inflight--;
+                }
+            }
+        }
+        if (size == 0) {
+            uint32_t gap = _xorshift32(&s->prng) % (BENCH_STRESS_GAP_US + 1);
+
+            size = sizeof(bench_hdr_t) +
+                   (_xorshift32(&s->prng) % (BENCH_PAYLOAD_MAX - sizeof(bench_hdr_t) + 1));
+            if (gap & 1) {
+                xtimer_usleep(gap);
+            }
+        }
+        if (_send(s, seq, size) < 0) {
+            s->tx_fail++;
+        }
+        else {
+            s->tx++;
+            inflight++;
+        }
+    }
+    msg.type = BENCH_MSG_DONE;
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+/* sink */
+static void _sample(bench_stage_t *stage, uint32_t value)
+{
+    if (stage->num < BENCH_SAMPLES) {
+        stage->samples[stage->num] = value;
+    }
+    else {
+        /* reservoir sampling keeps the percentiles unbiased */
+        uint32_t i = _xorshift32(&_sink_prng) % (stage->num + 1);
+
+        if (i < BENCH_SAMPLES) {
+            stage->samples[i] = value;
+        }
+    }
+    stage->num++;
+    if (value > stage->max) {
+        stage->max = value;
+    }
+}
+
+static bool _check(gnrc_pktsnip_t *pkt, bench_hdr_t *hdr)
+{
+    if (pkt->size < sizeof(*hdr)) {
+        return false;
+    }
+    memcpy(hdr, pkt->data, sizeof(*hdr));
+    if ((memcmp(hdr->magic, BENCH_MAGIC, sizeof(hdr->magic)) != 0) ||
+        (hdr->len != pkt->size) || (hdr->sender >= _threads)) {
+        return false;
+    }
+    for (size_t i = sizeof(*hdr); i < pkt->size; i++) {
+        if (((uint8_t *)pkt->data)[i] != _pattern(hdr, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _receive(gnrc_pktsnip_t *pkt)
+{
+    uint32_t now = xtimer_now();
+    bench_hdr_t hdr;
+
+    if (!_check(pkt, &hdr)) {
+        _corrupt++;
+    }
+    else {
+        bench_stamp_t *stamp = &_stamps[hdr.sender][hdr.seq % BENCH_STAMPS];
+
+        if ((stamp->seq == hdr.seq) && (stamp->dev_tx != 0) && (stamp->dev_rx != 0)) {
+            _sample(&_stages[STAGE_TX], stamp->dev_tx - hdr.sent);
+            _sample(&_stages[STAGE_LINK], stamp->dev_rx - stamp->dev_tx);
+            _sample(&_stages[STAGE_RX], now - stamp->dev_rx);
+        }
+        _sample(&_stages[STAGE_TOTAL], now - hdr.sent);
+        _rx_bytes += pkt->size;
+        _rx++;
+        if (_rate == 0) {
+            msg_t msg = { .type = BENCH_MSG_CREDIT };
+
+            msg_try_send(&msg, _senders[hdr.sender].pid);
+        }
+    }
+    _rx_last = now;
+    gnrc_pktbuf_release(pkt);
+}
+
+static void *_sink(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_init_queue(_sink_queue, _SINK_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            _receive(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+/* runs */
+static int _cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t _percentile(const bench_stage_t *stage, unsigned p)
+{
+    uint32_t num = (stage->num < BENCH_SAMPLES) ? stage->num : BENCH_SAMPLES;
+
+    if (num == 0) {
+        return 0;
+    }
+    return stage->samples[((num - 1) * p) / 100];
+}
+
+static void _print_csv_header(void)
+{
+    printf("mode,threads,size,packets,rate,seed,duration_us,sent,received,lost,"
+           "corrupt,tx_fail,pps,kbps");
+    for (unsigned i = 0; i < STAGE_NUMOF; i++) {
+        printf(",%s_p50,%s_p90,%s_p99,%s_max", _stage_names[i], _stage_names[i],
+               _stage_names[i], _stage_names[i]);
+    }
+    puts(",pktbuf_max,pktbuf_fails,dev_frames,dev_drops");
+}
+
+static void _print_result(uint32_t packets, uint32_t duration, uint32_t tx,
+                          uint32_t tx_fail, const gnrc_pktbuf_usage_t *usage)
+{
+    uint32_t lost = (tx > (_rx + _corrupt)) ? tx - (_rx + _corrupt) : 0;
+    uint32_t pps = (duration > 0) ? (uint32_t)(((uint64_t)_rx * SEC_IN_USEC) / duration) : 0;
+    uint32_t kbps = (duration > 0) ?
+                    (uint32_t)(((uint64_t)_rx_bytes * 8 * 1000) / duration) : 0;
+
+    if (_json) {
+        printf("{\"mode\":\"%s\",\"threads\":%u,\"size\":%u,\"packets\":%" PRIu32
+               ",\"rate\":%" PRIu32 ",\"seed\":%" PRIu32 ",\"duration_us\":%" PRIu32
+               ",\"sent\":%" PRIu32 ",\"received\":%" PRIu32 ",\"lost\":%" PRIu32
+               ",\"corrupt\":%" PRIu32 ",\"tx_fail\":%" PRIu32 ",\"pps\":%" PRIu32
+               ",\"kbps\":%" PRIu32 ",\"latency_us\":{",
+               _mode, _threads, (unsigned)_size, packets, _rate, _seed, duration,
+               tx, _rx, lost, _corrupt, tx_fail, pps, kbps);
+        for (unsigned i = 0; i < STAGE_NUMOF; i++) {
+            printf("%s\"%s\":{\"p50\":%" PRIu32 ",\"p90\":%" PRIu32 ",\"p99\":%"
+                   PRIu32 ",\"max\":%" PRIu32 "}", (i > 0) ? "," : "",
+                   _stage_names[i], _percentile(&_stages[i], 50),
+                   _percentile(&_stages[i], 90), _percentile(&_stages[i], 99),
+                   _stages[i].max);
+        }
+        printf("},\"pktbuf\":{\"max_used\":%u,\"alloc_fails\":%" PRIu32 "},"
+               "\"dev\":{\"frames\":%" PRIu32 ",\"drops\":%" PRIu32 "}}\n",
+               (unsigned)usage->max_used, usage->alloc_fails, _dev_frames, _dev_drops);
+    }
+    else {
+        printf("%s,%u,%u,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+               ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32,
+               _mode, _threads, (unsigned)_size, packets, _rate, _seed, duration,
+               tx, _rx, lost, _corrupt, tx_fail, pps, kbps);
+        for (unsigned i = 0; i < STAGE_NUMOF; i++) {
+            printf(",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32,
+                   _percentile(&_stages[i], 50), _percentile(&_stages[i], 90),
+                   _percentile(&_stages[i], 99), _stages[i].max);
+        }
+        printf(",%u,%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n", (unsigned)usage->max_used,
+               usage->alloc_fails, _dev_frames, _dev_drops);
+    }
+}
+
+static void _run(uint32_t packets)
+{
+    gnrc_pktbuf_usage_t usage;
+    uint32_t start, idle_since, tx = 0, tx_fail = 0, seen = 0;
+    msg_t msg;
+
+    memset(_stamps, 0xff, sizeof(_stamps));
+    memset(_stages, 0, sizeof(_stages));
+    _rx = _rx_bytes = _corrupt = 0;
+    _dev_frames = _dev_drops = 0;
+    _sink_prng = _seed | 1;
+    gnrc_pktbuf_get_usage(&usage, true);
+
+    start = xtimer_now();
+    _rx_last = start;
+    for (unsigned i = 0; i < _threads; i++) {
+        bench_sender_t *s = &_senders[i];
+
+        s->id = i;
+        s->prng = (_seed + i) | 1;
+        s->count = (packets / _threads) + ((i < (packets % _threads)) ? 1 : 0);
+        s->tx = s->tx_fail = 0;
+        s->pid = thread_create(s->stack, sizeof(s->stack), _SENDER_PRIO,
+                               THREAD_CREATE_STACKTEST, _sender, s, "bench_tx");
+    }
+    for (unsigned i = 0; i < _threads; i++) {
+        msg_receive(&msg);
+    }
+    for (unsigned i = 0; i < _threads; i++) {
+        tx += _senders[i].tx;
+        tx_fail += _senders[i].tx_fail;
+    }
+    /* drain */
+    idle_since = xtimer_now();
+    while (((_rx + _corrupt) < tx) && ((xtimer_now() - idle_since) < BENCH_TIMEOUT_US)) {
+        xtimer_usleep(1000);
+        if ((_rx + _corrupt) != seen) {
+            seen = _rx + _corrupt;
+            idle_since = xtimer_now();
+        }
+        else {
+            _dev_kick();
+        }
+    }
+    gnrc_pktbuf_get_usage(&usage, false);
+    for (unsigned i = 0; i < STAGE_NUMOF; i++) {
+        uint32_t num = (_stages[i].num < BENCH_SAMPLES) ? _stages[i].num : BENCH_SAMPLES;
+
+        qsort(_stages[i].samples, num, sizeof(uint32_t), _cmp_u32);
+    }
+    _print_result(packets, _rx_last - start, tx, tx_fail, &usage);
+}
+
+static int _parse_threads(const char *arg)
+{
+    int threads = atoi(arg);
+
+    if ((threads < 1) || (threads > (int)BENCH_THREADS_MAX)) {
+        printf("Error: threads must be between 1 and %u\n", BENCH_THREADS_MAX);
+        return -1;
+    }
+    return threads;
+}
+
+static int _bench(int argc, char **argv)
+{
+    int threads = 1, size;
+
+    if (argc < 3) {
+        printf("usage: %s <size> <packets> [<rate> [<threads>]]\n", argv[0]);
+        return 1;
+    }
+    size = atoi(argv[1]);
+    if ((size < (int)sizeof(bench_hdr_t)) || (size > (int)BENCH_PAYLOAD_MAX)) {
+        printf("Error: size must be between %u and %u\n",
+               (unsigned)sizeof(bench_hdr_t), BENCH_PAYLOAD_MAX);
+        return 1;
+    }
+    if ((argc > 4) && ((threads = _parse_threads(argv[4])) < 0)) {
+        return 1;
+    }
+    _mode = "bench";
+    _size = (uint16_t)size;
+    _rate = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 10) : 0;
+    _seed = 0;
+    _threads = threads;
+    _run((uint32_t)strtoul(argv[2], NULL, 10));
+    return 0;
+}
+
+static int _stress(int argc, char **argv)
+{
+    int threads = BENCH_THREADS_MAX;
+
+    if (argc < 2) {
+        printf("usage: %s <packets> [<threads> [<seed>]]\n", argv[0]);
+        return 1;
+    }
+    if ((argc > 2) && ((threads = _parse_threads(argv[2])) < 0)) {
+        return 1;
+    }
+    _mode = "stress";
+    _size = 0;
+    _rate = 0;
+    _seed = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 10) : xtimer_now();
+    _threads = threads;
+    _run((uint32_t)strtoul(argv[1], NULL, 10));
+    return 0;
+}
+
+static int _format(int argc, char **argv)
+{
+    if ((argc < 2) || ((strcmp(argv[1], "csv") != 0) && (strcmp(argv[1], "json") != 0))) {
+        printf("usage: %s csv|json\n", argv[0]);
+        return 1;
+    }
+    _json = (strcmp(argv[1], "json") == 0);
+    if (!_json) {
+        _print_csv_header();
+    }
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "send fixed size UDP packets through the stack", _bench },
+    { "stress", "send random size UDP packets from parallel threads", _stress },
+    { "format", "select the result format", _format },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("gnrc benchmark");
+    _main_pid = thread_getpid();
+    _dev_init();
+    gnrc_ipv6_netif_init_by_dev();
+    _sink_pid = thread_create(_sink_stack, sizeof(_sink_stack), _SINK_PRIO,
+                              THREAD_CREATE_STACKTEST, _sink, NULL, "bench_rx");
+    for (unsigned i = 0; i < BENCH_THREADS_MAX; i++) {
+        gnrc_netreg_entry_init_pid(&_sink_regs[i], BENCH_PORT + i, _sink_pid);
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_sink_regs[i]);
+    }
+    _print_csv_header();
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    /* should be never reached */
+    return 0;
+}
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2016 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+# mode,threads,size,packets,rate,seed,duration_us,sent,received,lost,corrupt
+RESULT = r"(\w+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+),"
+
+def run(child, cmd, packets, lossless=True):
+    child.sendline(cmd)
+    child.expect(RESULT)
+    sent, received, lost, corrupt = (int(x) for x in child.match.groups()[7:11])
+    assert corrupt == 0, "%s: %d corrupt" % (cmd, corrupt)
+    if lossless:
+        assert sent == packets, "%s: sent %d of %d" % (cmd, sent, packets)
+        assert received == packets, "%s: received %d of %d" % (cmd, received, packets)
+    else:
+        assert received > 0, "%s: nothing received" % cmd
+
+def testfunc(child):
+    child.expect_exact("mode,threads,size,packets")
+    # single closed-loop senders must not lose packets, fragmented or not
+    run(child, "bench 32 100", 100)
+    run(child, "bench 256 100", 100)
+    # parallel senders may exhaust the packet buffer, but never corrupt data
+    run(child, "stress 200 4 1", 200, lossless=False)
+    print("All tests successful")
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
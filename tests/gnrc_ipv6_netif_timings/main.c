@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup   tests
+ * @{
+ *
+ * @file
+ * @brief     Measure the speed of source address selection in gnrc_ipv6_netif
+ *
+ * An interface is configured with many global addresses. Cycling over a few
+ * destinations is answered by the source address cache, cycling over more
+ * destinations than the cache holds always runs the full RFC 6724 selection.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/netif.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TIMEOUT_S (5ul)
+#define TIMEOUT (TIMEOUT_S * SEC_IN_USEC)
+/* leave room for the link-local and multicast addresses */
+#define ADDR_NUMOF (GNRC_IPV6_NETIF_ADDR_NUMOF - 4)
+#define DST_NUMOF (ADDR_NUMOF)
+
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+#define CACHED_DST_NUMOF (GNRC_IPV6_NETIF_SRC_CACHE_SIZE)
+#else
+#define CACHED_DST_NUMOF (1)
+#endif
+
+static kernel_pid_t iface;
+static ipv6_addr_t dsts[DST_NUMOF];
+
+static void callback(void *done_)
+{
+    volatile int *done = done_;
+    *done = 1;
+}
+
+static void run_test(const char *name, unsigned dst_numof)
+{
+    volatile int done = 0;
+    unsigned long count = 0;
+
+    xtimer_t xtimer;
+    xtimer.callback = callback;
+    xtimer.arg = (void *) &done;
+
+    xtimer_set(&xtimer, TIMEOUT);
+
+    do {
+        for (unsigned i = 0; i < dst_numof; ++i) {
+            ipv6_addr_t *volatile r;
+            r = gnrc_ipv6_netif_find_best_src_addr(iface, &dsts[i], false);
+            (void) r;
+        }
+
+        ++count;
+    } while (done == 0);
+
+    printf("+ %s: %lu iterations per second\r\n", name, dst_numof * count / TIMEOUT_S);
+}
+
+int main(void)
+{
+    ipv6_addr_t addr = { {
+            0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x1a, 0x2b, 0xff, 0xfe, 0x3c, 0x4d, 0x5e
+        }
+    };
+
+    printf("Start.\r\n");
+
+    gnrc_ipv6_netif_init();
+    /* no device is attached, any PID works as a key */
+    iface = thread_getpid();
+    gnrc_ipv6_netif_add(iface);
+    gnrc_ipv6_netif_add_addr(iface, &addr, 64, 0);
+
+    /* 2001:db8:<i>::/64 with the same interface identifier */
+    addr.u16[0] = byteorder_htons(0x2001);
+    addr.u16[1] = byteorder_htons(0x0db8);
+    for (unsigned i = 0; i < ADDR_NUMOF; i++) {
+        addr.u16[2] = byteorder_htons(i);
+        if (gnrc_ipv6_netif_add_addr(iface, &addr, 64, 0) == NULL) {
+            printf("Error: unable to add address %u\r\n", i);
+            return 1;
+        }
+        dsts[i] = addr;
+        dsts[i].u8[15] ^= 0x01;
+    }
+
+    run_test("cached destinations", CACHED_DST_NUMOF);
+    run_test("uncached destinations", DST_NUMOF);
+
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+    gnrc_ipv6_netif_t *entry = gnrc_ipv6_netif_get(iface);
+
+    printf("Source address cache: %" PRIu32 " hits, %" PRIu32 " misses\r\n",
+           entry->src_cache_hits, entry->src_cache_misses);
+#endif
+
+    printf("Done.\r\n");
+    return 0;
+}
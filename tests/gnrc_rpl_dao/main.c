@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the DAO processing of a storing mode RPL root
+ *
+ * Simulates hundreds of downstream nodes that announce their addresses in DAOs
+ * with many targets and measures how long the root needs to install, refresh
+ * and remove the resulting routes.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/of_manager.h"
+#include "net/icmpv6.h"
+#include "xtimer.h"
+
+#define TARGETS_NUMOF           (GNRC_IPV6_FIB_TABLE_SIZE - 2)
+#define TARGETS_PER_DAO         (48)
+#define IFACE                   (KERNEL_PID_LAST)
+#define INSTANCE_ID             (0)
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dao_t dao;
+    gnrc_rpl_opt_target_t targets[TARGETS_PER_DAO];
+    gnrc_rpl_opt_transit_t transit;
+} dao_t;
+
+static dao_t _dao;
+static ipv6_addr_t _dodag_id = {{ 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                                  0, 0, 0, 0, 0, 0, 0, 1 }};
+
+static gnrc_rpl_instance_t *_root_init(void)
+{
+    gnrc_rpl_instance_t *inst;
+
+    gnrc_rpl_of_manager_init();
+    if (!gnrc_rpl_instance_add(INSTANCE_ID, &inst)) {
+        return NULL;
+    }
+    inst->mop = GNRC_RPL_MOP_STORING_MODE_NO_MC;
+    inst->of = gnrc_rpl_get_of_for_ocp(GNRC_RPL_DEFAULT_OCP);
+    if (!gnrc_rpl_dodag_init(inst, &_dodag_id, IFACE, NULL)) {
+        return NULL;
+    }
+    inst->dodag.node_status = GNRC_RPL_ROOT_NODE;
+    inst->dodag.my_rank = GNRC_RPL_ROOT_RANK;
+    return inst;
+}
+
+/* sends all targets in DAOs of TARGETS_PER_DAO targets, returns the elapsed time */
+static uint32_t _send_daos(uint8_t path_lifetime)
+{
+    uint32_t elapsed = 0;
+    unsigned target = 0;
+
+    while (target < TARGETS_NUMOF) {
+        unsigned numof = TARGETS_NUMOF - target;
+        ipv6_addr_t src = IPV6_ADDR_UNSPECIFIED;
+
+        if (numof > TARGETS_PER_DAO) {
+            numof = TARGETS_PER_DAO;
+        }
+
+        /* every DAO comes from another child */
+        src.u8[0] = 0xfe;
+        src.u8[1] = 0x80;
+        src.u16[7] = byteorder_htons(target / TARGETS_PER_DAO + 1);
+
+        memset(&_dao, 0, sizeof(_dao));
+        _dao.icmpv6.type = ICMPV6_RPL_CTRL;
+        _dao.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DAO;
+        _dao.dao.instance_id = INSTANCE_ID;
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_rpl_opt_target_t *opt = &_dao.targets[i];
+            opt->type = GNRC_RPL_OPT_TARGET;
+            opt->length = sizeof(opt->flags) + sizeof(opt->prefix_length) +
+                          sizeof(opt->target);
+            opt->prefix_length = IPV6_ADDR_BIT_LEN;
+            opt->target = _dodag_id;
+            opt->target.u16[7] = byteorder_htons(target + i + 2);
+        }
+        /* the transit follows the last target immediately */
+        gnrc_rpl_opt_transit_t *transit = (gnrc_rpl_opt_transit_t *) &_dao.targets[numof];
+        transit->type = GNRC_RPL_OPT_TRANSIT;
+        transit->length = sizeof(transit->e_flags) + sizeof(transit->path_control) +
+                          sizeof(transit->path_sequence) + sizeof(transit->path_lifetime);
+        transit->path_lifetime = path_lifetime;
+
+        uint16_t len = sizeof(icmpv6_hdr_t) + sizeof(gnrc_rpl_dao_t) +
+                       (numof * sizeof(gnrc_rpl_opt_target_t)) +
+                       sizeof(gnrc_rpl_opt_transit_t);
+
+        uint32_t start = xtimer_now();
+        gnrc_rpl_recv_DAO(&_dao.dao, IFACE, &src, len);
+        elapsed += xtimer_now() - start;
+
+        target += numof;
+    }
+
+    return elapsed;
+}
+
+static unsigned _routes_numof(void)
+{
+    unsigned numof = 0;
+
+    for (size_t i = 0; i < gnrc_ipv6_fib_table.size; i++) {
+        if (gnrc_ipv6_fib_table.data.entries[i].lifetime != 0) {
+            numof++;
+        }
+    }
+    return numof;
+}
+
+static void _report(const char *name, uint32_t elapsed)
+{
+    printf("+ %s: %u targets in %lu us (%lu ns per target), %u routes\n", name,
+           (unsigned)TARGETS_NUMOF, (unsigned long)elapsed,
+           (unsigned long)((elapsed * 1000UL) / TARGETS_NUMOF), _routes_numof());
+}
+
+int main(void)
+{
+    gnrc_rpl_instance_t *inst;
+
+    puts("RPL DAO benchmark");
+
+    if ((inst = _root_init()) == NULL) {
+        puts("Error: could not initialize the RPL root");
+        return 1;
+    }
+
+    _report("install", _send_daos(inst->dodag.default_lifetime));
+    if (_routes_numof() != TARGETS_NUMOF) {
+        puts("Error: not all routes were installed");
+        return 1;
+    }
+
+    _report("refresh", _send_daos(inst->dodag.default_lifetime));
+    if (_routes_numof() != TARGETS_NUMOF) {
+        puts("Error: routes were not refreshed in place");
+        return 1;
+    }
+
+    _report("no-path", _send_daos(0));
+    if (_routes_numof() != 0) {
+        puts("Error: not all routes were removed");
+        return 1;
+    }
+
+    puts("Test successful.");
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput test for the gnrc_tcp module
+ *
+ * Sends data to or receives data from a TCP peer, e.g. the host of a
+ * native instance, and prints the throughput. See README.md.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/conn/tcp.h"
+#include "net/ipv6/addr.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define BUFFER_SIZE     (1024U)
+
+static uint8_t buffer[BUFFER_SIZE];
+static char sink_stack[THREAD_STACKSIZE_DEFAULT];
+static uint16_t sink_port;
+
+static void _print_result(const char *what, uint32_t bytes, uint32_t start)
+{
+    uint32_t us = xtimer_now() - start;
+    uint32_t kbps = (us > 0) ? (uint32_t)(((uint64_t)bytes * 8 * 1000) / us) : 0;
+
+    printf("%s %" PRIu32 " bytes in %" PRIu32 " us: %" PRIu32 " kbit/s\n",
+           what, bytes, us, kbps);
+}
+
+static void *_sink_thread(void *arg)
+{
+    conn_tcp_t server, client;
+    ipv6_addr_t addr = IPV6_ADDR_UNSPECIFIED;
+    int res;
+
+    (void)arg;
+    if ((res = conn_tcp_create(&server, &addr, sizeof(addr), AF_INET6, sink_port)) < 0) {
+        printf("Error: unable to open port %u (%d)\n", (unsigned)sink_port, res);
+        return NULL;
+    }
+    if ((res = conn_tcp_listen(&server, 1)) < 0) {
+        printf("Error: unable to listen (%d)\n", res);
+        conn_tcp_close(&server);
+        return NULL;
+    }
+    printf("Success: listening on port %u\n", (unsigned)sink_port);
+    while (conn_tcp_accept(&server, &client) == 0) {
+        uint32_t bytes = 0, start = xtimer_now();
+
+        while ((res = conn_tcp_recv(&client, buffer, sizeof(buffer))) > 0) {
+            bytes += res;
+        }
+        if (res < 0) {
+            printf("Error: receive failed (%d)\n", res);
+        }
+        _print_result("received", bytes, start);
+        conn_tcp_close(&client);
+    }
+    conn_tcp_close(&server);
+    return NULL;
+}
+
+static int _sink(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+    if (sink_port != 0) {
+        puts("Error: sink already running");
+        return 1;
+    }
+    sink_port = (uint16_t)atoi(argv[1]);
+    thread_create(sink_stack, sizeof(sink_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sink_thread, NULL, "tcp sink");
+    return 0;
+}
+
+static int _send(int argc, char **argv)
+{
+    conn_tcp_t conn;
+    ipv6_addr_t addr = IPV6_ADDR_UNSPECIFIED;
+    uint32_t total, bytes = 0, start;
+    int res;
+
+    if (argc < 4) {
+        printf("usage: %s <addr> <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    total = (uint32_t)strtoul(argv[3], NULL, 10);
+    if ((res = conn_tcp_create(&conn, &addr, sizeof(addr), AF_INET6, 0)) < 0) {
+        printf("Error: unable to open connection (%d)\n", res);
+        return 1;
+    }
+    if (ipv6_addr_from_str(&addr, argv[1]) == NULL) {
+        puts("Error: unable to parse destination address");
+        conn_tcp_close(&conn);
+        return 1;
+    }
+    if ((res = conn_tcp_connect(&conn, &addr, sizeof(addr), (uint16_t)atoi(argv[2]))) < 0) {
+        printf("Error: unable to connect (%d)\n", res);
+        conn_tcp_close(&conn);
+        return 1;
+    }
+    for (unsigned i = 0; i < BUFFER_SIZE; i++) {
+        buffer[i] = (uint8_t)i;
+    }
+    start = xtimer_now();
+    while (bytes < total) {
+        size_t len = ((total - bytes) < BUFFER_SIZE) ? (total - bytes) : BUFFER_SIZE;
+
+        if ((res = conn_tcp_send(&conn, buffer, len)) < 0) {
+            printf("Error: send failed (%d)\n", res);
+            break;
+        }
+        bytes += res;
+    }
+    _print_result("sent", bytes, start);
+    conn_tcp_close(&conn);
+    return (bytes == total) ? 0 : 1;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tcp_send", "send bytes to a TCP peer", _send },
+    { "tcp_sink", "receive and discard data from TCP peers", _sink },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("gnrc_tcp throughput test");
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    /* should be never reached */
+    return 0;
+}
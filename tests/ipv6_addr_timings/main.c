@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup   tests
+ * @{
+ *
+ * @file
+ * @brief     Measure the speed of the prefix functions in ipv6_addr.c
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/ipv6/addr.h"
+#include "xtimer.h"
+
+#define TIMEOUT_S (5ul)
+#define TIMEOUT (TIMEOUT_S * SEC_IN_USEC)
+#define PER_ITERATION (IPV6_ADDR_BIT_LEN)
+
+static ipv6_addr_t addrs[PER_ITERATION];
+static ipv6_addr_t masks[PER_ITERATION];
+static const ipv6_addr_t base = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+        0x02, 0x1a, 0x2b, 0xff, 0xfe, 0x3c, 0x4d, 0x5e
+    }
+};
+
+static void callback(void *done_)
+{
+    volatile int *done = done_;
+    *done = 1;
+}
+
+static unsigned test_match_prefix(unsigned i)
+{
+    return ipv6_addr_match_prefix(&addrs[i], &base);
+}
+
+static unsigned test_match_mask(unsigned i)
+{
+    return ipv6_addr_match_mask(&addrs[i], &base, &masks[i]);
+}
+
+static unsigned test_init_prefix(unsigned i)
+{
+    ipv6_addr_t out = addrs[i];
+
+    ipv6_addr_init_prefix(&out, &base, i);
+    return out.u8[i / 8];
+}
+
+static unsigned test_init_prefix_mask(unsigned i)
+{
+    ipv6_addr_t out = addrs[i];
+
+    ipv6_addr_init_prefix_mask(&out, &base, &masks[i]);
+    return out.u8[i / 8];
+}
+
+static void run_test(const char *name, unsigned (*test)(unsigned))
+{
+    volatile int done = 0;
+    unsigned long count = 0;
+
+    xtimer_t xtimer;
+    xtimer.callback = callback;
+    xtimer.arg = (void *) &done;
+
+    xtimer_set(&xtimer, TIMEOUT);
+
+    do {
+        /* addresses differing in every bit position */
+        for (unsigned i = 0; i < PER_ITERATION; ++i) {
+            volatile unsigned r;
+            r = test(i);
+            (void) r;
+        }
+
+        ++count;
+    } while (done == 0);
+
+    printf("+ %s: %lu iterations per second\r\n", name, PER_ITERATION * count / TIMEOUT_S);
+}
+
+#define run_test(test) run_test(#test, test)
+
+int main(void)
+{
+    printf("Start.\r\n");
+
+    for (unsigned i = 0; i < PER_ITERATION; i++) {
+        addrs[i] = base;
+        addrs[i].u8[i / 8] ^= 0x80 >> (i % 8);
+        ipv6_addr_init_mask(&masks[i], i);
+    }
+
+    run_test(test_match_prefix);
+    run_test(test_match_mask);
+    run_test(test_init_prefix);
+    run_test(test_init_prefix_mask);
+
+    printf("Done.\r\n");
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the speed of interrupt masking and of the kernel
+ *              primitives using it
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TIMEOUT_S (5ul)
+#define TIMEOUT (TIMEOUT_S * SEC_IN_USEC)
+
+static char reply_stack[THREAD_STACKSIZE_DEFAULT];
+static char pong_stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t ping = MUTEX_INIT;
+static mutex_t pong = MUTEX_INIT;
+static volatile int done;
+
+static void callback(void *arg)
+{
+    (void)arg;
+    done = 1;
+}
+
+static void start_timeout(xtimer_t *xtimer)
+{
+    done = 0;
+    xtimer->callback = callback;
+    xtimer->arg = NULL;
+    xtimer_set(xtimer, TIMEOUT);
+}
+
+static void *reply_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+        msg_reply(&m, &m);
+    }
+
+    return NULL;
+}
+
+static void *pong_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&ping);
+        mutex_unlock(&pong);
+    }
+
+    return NULL;
+}
+
+static void run_irq(void)
+{
+    unsigned long count = 0;
+    xtimer_t xtimer;
+
+    start_timeout(&xtimer);
+    do {
+        unsigned state = irq_disable();
+        irq_restore(state);
+        ++count;
+    } while (done == 0);
+
+    printf("+ irq_disable/irq_restore: %lu per second\n", count / TIMEOUT_S);
+}
+
+static void run_msg(void)
+{
+    unsigned long count = 0;
+    kernel_pid_t pid;
+    xtimer_t xtimer;
+    msg_t m;
+
+    pid = thread_create(reply_stack, sizeof(reply_stack), THREAD_PRIORITY_MAIN - 1,
+                        THREAD_CREATE_STACKTEST, reply_thread, NULL, "reply");
+
+    start_timeout(&xtimer);
+    do {
+        msg_send_receive(&m, &m, pid);
+        ++count;
+    } while (done == 0);
+
+    printf("+ msg_send_receive/msg_reply: %lu round trips per second\n",
+           count / TIMEOUT_S);
+}
+
+static void run_mutex(void)
+{
+    unsigned long count = 0;
+    xtimer_t xtimer;
+
+    /* both mutexes are handed over between the threads */
+    mutex_lock(&ping);
+    mutex_lock(&pong);
+    thread_create(pong_stack, sizeof(pong_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, pong_thread, NULL, "pong");
+
+    start_timeout(&xtimer);
+    do {
+        mutex_unlock(&ping);
+        mutex_lock(&pong);
+        ++count;
+    } while (done == 0);
+
+    printf("+ mutex_unlock/mutex_lock: %lu hand-overs per second\n",
+           count / TIMEOUT_S);
+}
+
+int main(void)
+{
+    puts("Start.");
+
+    run_irq();
+    run_msg();
+    run_mutex();
+
+    puts("Done.");
+    return 0;
+}
@@ -13,6 +13,9 @@
  * @file
  * @brief       Test msg_send_receive().
  *
+ * Afterwards, the time to pass a burst of messages to a lower priority
+ * thread is compared for single and bulk sending and receiving.
+ *
  * @author      Martine Lenders <mlenders@inf.fu-berlin.de>
  * @author      René Kijewski <rene.kijewski@fu-berlin.de>
  * @author      Oliver Hahm <oliver.hahm@inria.fr>
@@ -20,10 +23,13 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "cpu_conf.h"
+#include "msg.h"
 #include "thread.h"
+#include "xtimer.h"
 
 #define THREAD1_STACKSIZE   (THREAD_STACKSIZE_MAIN)
 #define THREAD2_STACKSIZE   (THREAD_STACKSIZE_MAIN)
@@ -32,6 +38,14 @@
 #define TEST_EXECUTION_NUM  (10)
 #endif
 
+#define BENCH_STACKSIZE     (THREAD_STACKSIZE_MAIN)
+#define BENCH_TYPE_SEQ      (0)
+#define BENCH_TYPE_FANOUT   (1)
+#define BENCH_BURST         (8U)
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000U)
+#endif
+
 static char thread1_stack[THREAD1_STACKSIZE];
 static char thread2_stack[THREAD2_STACKSIZE];
 
@@ -39,13 +53,20 @@ static kernel_pid_t thread1_pid, thread2_pid;
 
 static int counter1 = 0;
 static int counter2 = 0;
+static int success = 0;
+
+static char bench_stack[BENCH_STACKSIZE];
+static msg_t bench_queue[BENCH_BURST];
+static kernel_pid_t bench_pid, main_pid;
+static volatile int bench_bulk;
 
 static void *thread1(void *args)
 {
     (void)args;
 
     msg_t msg_req, msg_resp;
-    int success = 1;
+
+    success = 1;
 
     msg_resp.content.ptr = NULL;
     msg_req.content.ptr = &counter1;
@@ -62,13 +83,6 @@ static void *thread1(void *args)
         }
     }
 
-    if (success) {
-        puts("Test successful.");
-    }
-    else {
-        puts("Test failed.");
-    }
-
     return NULL;
 }
 
@@ -94,11 +108,101 @@ static void *thread2(void *args)
     return NULL;
 }
 
+/* receives bursts of BENCH_BURST messages and reports them to main */
+static void *bench_thread(void *args)
+{
+    (void)args;
+
+    msg_t msgs[BENCH_BURST], done;
+
+    msg_init_queue(bench_queue, BENCH_BURST);
+    done.content.value = 1;
+
+    while (1) {
+        unsigned num = 0;
+
+        while (num < BENCH_BURST) {
+            unsigned first = num;
+
+            if (bench_bulk) {
+                num += msg_receive_bulk(&msgs[num], BENCH_BURST - num);
+            }
+            else {
+                msg_receive(&msgs[num++]);
+            }
+            for (unsigned i = first; i < num; i++) {
+                /* messages of a fan-out are all alike, the others must be
+                 * received in order */
+                uint32_t expected = (msgs[i].type == BENCH_TYPE_FANOUT) ?
+                                    BENCH_BURST : i;
+                if (msgs[i].content.value != expected) {
+                    done.content.value = 0;
+                }
+            }
+        }
+        msg_send(&done, main_pid);
+    }
+
+    return NULL;
+}
+
+static uint32_t bench(int bulk_send, int bulk_receive)
+{
+    kernel_pid_t pids[BENCH_BURST];
+    msg_t msg, done;
+    uint32_t start;
+
+    for (unsigned i = 0; i < BENCH_BURST; i++) {
+        pids[i] = bench_pid;
+    }
+    bench_bulk = bulk_receive;
+
+    start = xtimer_now();
+    for (unsigned run = 0; run < BENCH_RUNS; run++) {
+        if (bulk_send) {
+            msg.type = BENCH_TYPE_FANOUT;
+            msg.content.value = BENCH_BURST;
+            msg_send_bulk(&msg, pids, BENCH_BURST);
+        }
+        else {
+            msg.type = BENCH_TYPE_SEQ;
+            for (unsigned i = 0; i < BENCH_BURST; i++) {
+                msg.content.value = i;
+                msg_try_send(&msg, bench_pid);
+            }
+        }
+        msg_receive(&done);
+        if (done.content.value != 1) {
+            success = 0;
+        }
+    }
+    return xtimer_now() - start;
+}
+
 int main(void)
 {
     thread2_pid = thread_create(thread2_stack, THREAD2_STACKSIZE, THREAD_PRIORITY_MAIN - 2,
                                 0, thread2, NULL, "thread2");
     thread1_pid = thread_create(thread1_stack, THREAD1_STACKSIZE, THREAD_PRIORITY_MAIN - 1,
                                 0, thread1, NULL, "thread1");
+
+    main_pid = thread_getpid();
+    bench_pid = thread_create(bench_stack, BENCH_STACKSIZE, THREAD_PRIORITY_MAIN + 1,
+                              THREAD_CREATE_STACKTEST, bench_thread, NULL, "bench");
+
+    printf("%u bursts of %u messages:\n", BENCH_RUNS, BENCH_BURST);
+    printf("msg_try_send(), msg_receive():          %" PRIu32 "us\n",
+           bench(0, 0));
+    printf("msg_try_send(), msg_receive_bulk():     %" PRIu32 "us\n",
+           bench(0, 1));
+    printf("msg_send_bulk(), msg_receive_bulk():    %" PRIu32 "us\n",
+           bench(1, 1));
+
+    if (success) {
+        puts("Test successful.");
+    }
+    else {
+        puts("Test failed.");
+    }
     return 0;
 }
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for native's virtual time mode
+ *
+ * Threads of different priority wake up periodically, partly at the same
+ * deadlines, and print the time they see. With virtual time, this output is
+ * identical in every run, which tests/01-run.py checks. The final sleep of
+ * ten minutes passes instantly.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ROUNDS          (10U)
+#define FINAL_SLEEP     (600U)
+
+typedef struct {
+    const char *name;
+    uint32_t period;
+    char stack[THREAD_STACKSIZE_MAIN];
+} worker_t;
+
+static worker_t _workers[] = {
+    { .name = "fast", .period = 3000 },
+    { .name = "mid",  .period = 5000 },
+    { .name = "slow", .period = 15000 },
+};
+
+#define WORKERS_NUMOF   (sizeof(_workers) / sizeof(_workers[0]))
+
+static kernel_pid_t _main_pid;
+
+static void *_worker(void *arg)
+{
+    worker_t *w = arg;
+    uint32_t last = xtimer_now();
+    msg_t msg;
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        xtimer_usleep_until(&last, w->period);
+        printf("%s %u %" PRIu32 "\n", w->name, i, xtimer_now());
+    }
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t msg;
+
+    puts("Virtual time test");
+    _main_pid = thread_getpid();
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        thread_create(_workers[i].stack, sizeof(_workers[i].stack),
+                      THREAD_PRIORITY_MAIN - 1 - i, THREAD_CREATE_STACKTEST,
+                      _worker, &_workers[i], _workers[i].name);
+    }
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        msg_receive(&msg);
+    }
+
+    xtimer_sleep(FINAL_SLEEP);
+    printf("end %" PRIu32 "\n", xtimer_now());
+    puts("Test successful.");
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2016 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+outputs = []
+
+def testfunc(child):
+    child.expect(u"Virtual time test")
+    child.expect(u"Test successful.")
+    outputs.append(child.before)
+
+if __name__ == "__main__":
+    # two runs of the same binary must print the same times
+    for run in range(2):
+        res = testrunner.run(testfunc)
+        if res != 0:
+            sys.exit(res)
+    if outputs[0] != outputs[1]:
+        print("Outputs of the two runs differ")
+        sys.exit(1)
+    sys.exit(0)
@@ -21,13 +21,16 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <inttypes.h>
 
 #include "board.h"
 #include "shell.h"
 #include "thread.h"
 #include "msg.h"
 #include "ringbuffer.h"
+#include "xtimer.h"
 #include "periph/uart.h"
+#include "uart_async.h"
 
 #define SHELL_BUFSIZE       (128U)
 #define UART_BUFSIZE        (128U)
@@ -132,6 +135,7 @@ static int cmd_init(int argc, char **argv)
         puts("Error: Unable to initialize UART device\n");
         return 1;
     }
+    uart_async_init(UART_DEV(dev), UART_ASYNC_DROP);
     printf("Successfully initialized UART_DEV(%i)\n", dev);
     return 0;
 }
@@ -155,9 +159,46 @@ static int cmd_send(int argc, char **argv)
     return 0;
 }
 
+static int cmd_send_async(int argc, char **argv)
+{
+    int dev;
+    unsigned count = 1;
+
+    if (argc < 3) {
+        printf("usage: %s <dev> <data (string)> [count]\n", argv[0]);
+        return 1;
+    }
+    /* parse parameters */
+    dev = parse_dev(argv[1]);
+    if (dev < 0) {
+        return 1;
+    }
+    if (argc > 3) {
+        count = (unsigned)atoi(argv[3]);
+    }
+
+    size_t len = strlen(argv[2]) + 1;
+    size_t sent = 0;
+    uint32_t start = xtimer_now();
+    for (unsigned i = 0; i < count; i++) {
+        sent += uart_write_async(UART_DEV(dev), (uint8_t *)argv[2], len);
+    }
+    uint32_t queued = xtimer_now();
+    uart_async_flush(UART_DEV(dev));
+    uint32_t flushed = xtimer_now();
+
+    printf("UART_DEV(%i) TX: queued %u of %u bytes in %" PRIu32 "us, "
+           "sent after %" PRIu32 "us, %u bytes dropped in total\n", dev,
+           (unsigned)sent, (unsigned)(len * count), queued - start,
+           flushed - start, uart_async_dropped(UART_DEV(dev)));
+    return 0;
+}
+
 static const shell_command_t shell_commands[] = {
     { "init", "Initialize a UART device with a given baudrate", cmd_init },
     { "send", "Send a string through given UART device", cmd_send },
+    { "send_async", "Queue a string [count times] for a UART device",
+      cmd_send_async },
     { NULL, NULL, NULL }
 };
 
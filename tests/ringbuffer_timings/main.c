@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup   tests
+ * @{
+ *
+ * @file
+ * @brief     Measure the throughput of ringbuffer and tsrb
+ *
+ * Moves chunks through the ringbuffers byte by byte and in bulk. The chunk
+ * size does not divide the buffer size, so the bulk operations wrap around.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#define TIMEOUT_S (5ul)
+#define TIMEOUT (TIMEOUT_S * SEC_IN_USEC)
+#define BUF_SIZE (256U)
+#define CHUNK_SIZE (48U)
+
+static char rb_mem[BUF_SIZE];
+static ringbuffer_t rb = RINGBUFFER_INIT(rb_mem);
+static char tsrb_mem[BUF_SIZE];
+static tsrb_t trb = TSRB_INIT(tsrb_mem);
+static char in[CHUNK_SIZE], out[CHUNK_SIZE];
+
+static void callback(void *done_)
+{
+    volatile int *done = done_;
+    *done = 1;
+}
+
+static void rb_bytes(void)
+{
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        ringbuffer_add_one(&rb, in[i]);
+    }
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        out[i] = ringbuffer_get_one(&rb);
+    }
+}
+
+static void rb_bulk(void)
+{
+    ringbuffer_add(&rb, in, CHUNK_SIZE);
+    ringbuffer_get(&rb, out, CHUNK_SIZE);
+}
+
+static void tsrb_bytes(void)
+{
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        tsrb_add_one(&trb, in[i]);
+    }
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        out[i] = tsrb_get_one(&trb);
+    }
+}
+
+static void tsrb_bulk(void)
+{
+    tsrb_add(&trb, in, CHUNK_SIZE);
+    tsrb_get(&trb, out, CHUNK_SIZE);
+}
+
+static void tsrb_spans(void)
+{
+    unsigned n = 0;
+    char *data;
+
+    while (n < CHUNK_SIZE) {
+        unsigned len = tsrb_write_span(&trb, &data);
+
+        if (len > (CHUNK_SIZE - n)) {
+            len = CHUNK_SIZE - n;
+        }
+        memcpy(data, &in[n], len);
+        tsrb_write_commit(&trb, len);
+        n += len;
+    }
+    for (n = 0; n < CHUNK_SIZE;) {
+        unsigned len = tsrb_read_span(&trb, &data);
+
+        if (len > (CHUNK_SIZE - n)) {
+            len = CHUNK_SIZE - n;
+        }
+        memcpy(&out[n], data, len);
+        tsrb_read_commit(&trb, len);
+        n += len;
+    }
+}
+
+static void run_test(const char *name, void (*test)(void))
+{
+    volatile int done = 0;
+    unsigned long count = 0;
+
+    xtimer_t xtimer;
+    xtimer.callback = callback;
+    xtimer.arg = (void *) &done;
+
+    memset(out, 0, sizeof(out));
+    xtimer_set(&xtimer, TIMEOUT);
+
+    do {
+        test();
+        ++count;
+    } while (done == 0);
+
+    printf("+ %s: %lu bytes per second%s\r\n", name,
+           (CHUNK_SIZE * count) / TIMEOUT_S,
+           (memcmp(in, out, sizeof(in)) == 0) ? "" : " (data corrupted)");
+}
+
+#define run_test(test) run_test(#test, test)
+
+int main(void)
+{
+    printf("Start.\r\n");
+
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        in[i] = (char)i;
+    }
+
+    run_test(rb_bytes);
+    run_test(rb_bulk);
+    run_test(tsrb_bytes);
+    run_test(tsrb_bulk);
+    run_test(tsrb_spans);
+
+    printf("Done.\r\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for asynchronous SPI transactions
+ *
+ * Runs transactions against the emulated SPI device of native: register
+ * writes read back in the same transaction, looped back transfers framed by
+ * @ref SPI_ASYNC_CONT, resubmission from the completion callback and
+ * submission from ISR context.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "spi_async.h"
+#include "xtimer.h"
+
+#define DEV             (SPI_0)
+#define REG_BASE        (0x10)
+#define CHAIN_ROUNDS    (10U)
+
+static const uint8_t _pattern[] = { 0xde, 0xad, 0xbe, 0xef };
+static uint8_t _regs[sizeof(_pattern)];
+static uint8_t _loop[sizeof(_pattern)];
+static uint8_t _cmd = 0x42, _cmd_in;
+
+static const spi_async_op_t _ops[] = {
+    SPI_ASYNC_REG(NATIVE_SPI_REG_WRITE | REG_BASE, _pattern, NULL,
+                  sizeof(_pattern)),
+    SPI_ASYNC_BYTES(&_cmd, &_cmd_in, 1, SPI_ASYNC_CONT),
+    SPI_ASYNC_BYTES(_pattern, _loop, sizeof(_pattern), 0),
+    SPI_ASYNC_REG(REG_BASE, NULL, _regs, sizeof(_regs)),
+};
+
+static spi_async_t _trans;
+static volatile unsigned _completed;
+
+static void _chain_cb(spi_async_t *trans, void *arg)
+{
+    (void)arg;
+    if ((spi_async_result(trans) >= 0) && (++_completed < CHAIN_ROUNDS)) {
+        spi_async_submit(trans);
+    }
+}
+
+static void _isr_cb(void *arg)
+{
+    spi_async_submit(arg);
+}
+
+static int _check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("error: %s\n", what);
+    }
+    return cond;
+}
+
+int main(void)
+{
+    xtimer_t timer;
+    int ok = 1;
+
+    puts("spi_async test");
+    spi_init_master(DEV, SPI_CONF_FIRST_RISING, SPI_SPEED_1MHZ);
+    spi_async_init();
+
+    /* notification by thread flag */
+    spi_async_setup(&_trans, DEV, GPIO_UNDEF, _ops,
+                    sizeof(_ops) / sizeof(_ops[0]), NULL, NULL);
+    ok &= _check(spi_async_submit(&_trans) == 0, "submit failed");
+    ok &= _check(spi_async_wait(&_trans) == (int)(3 * sizeof(_pattern) + 1),
+                 "wrong number of bytes transferred");
+    ok &= _check(memcmp(_regs, _pattern, sizeof(_pattern)) == 0,
+                 "registers not written");
+    ok &= _check(memcmp(_loop, _pattern, sizeof(_pattern)) == 0,
+                 "transfer not looped back");
+    ok &= _check(_cmd_in == _cmd, "command not looped back");
+
+    /* resubmission from the completion callback */
+    memset(_regs, 0, sizeof(_regs));
+    spi_async_setup(&_trans, DEV, GPIO_UNDEF, &_ops[3], 1, _chain_cb, NULL);
+    spi_async_submit(&_trans);
+    xtimer_usleep(10000);
+    ok &= _check(_completed == CHAIN_ROUNDS, "chained transactions lost");
+    ok &= _check(memcmp(_regs, _pattern, sizeof(_pattern)) == 0,
+                 "registers not read");
+
+    /* submission from ISR context */
+    _completed = CHAIN_ROUNDS - 1;
+    timer.callback = _isr_cb;
+    timer.arg = &_trans;
+    xtimer_set(&timer, 1000);
+    xtimer_usleep(10000);
+    ok &= _check(_completed == CHAIN_ROUNDS, "transaction from ISR lost");
+    ok &= _check(spi_async_done(&_trans), "transaction still pending");
+
+    if (ok) {
+        puts("Test successful.");
+    }
+    return 0;
+}
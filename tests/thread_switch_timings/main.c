@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the speed of context switches
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "thread.h"
+#include "xtimer.h"
+
+#define TIMEOUT_S (5ul)
+#define TIMEOUT (TIMEOUT_S * SEC_IN_USEC)
+
+static char yield_stack[THREAD_STACKSIZE_DEFAULT];
+static char sleep_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t main_pid;
+static volatile unsigned long count;
+static volatile int done;
+
+static void callback(void *arg)
+{
+    (void)arg;
+    done = 1;
+}
+
+static void start_timeout(xtimer_t *xtimer)
+{
+    done = 0;
+    count = 0;
+    xtimer->callback = callback;
+    xtimer->arg = NULL;
+    xtimer_set(xtimer, TIMEOUT);
+}
+
+static void *yield_thread(void *arg)
+{
+    (void)arg;
+
+    while (!done) {
+        ++count;
+        thread_yield();
+    }
+
+    return NULL;
+}
+
+static void *sleep_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        thread_wakeup(main_pid);
+    }
+
+    return NULL;
+}
+
+static void run_yield(void)
+{
+    xtimer_t xtimer;
+
+    start_timeout(&xtimer);
+    thread_create(yield_stack, sizeof(yield_stack), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                  yield_thread, NULL, "yield");
+    while (!done) {
+        ++count;
+        thread_yield();
+    }
+
+    printf("+ thread_yield: %lu switches per second\n", count / TIMEOUT_S);
+}
+
+static void run_sleep(void)
+{
+    kernel_pid_t pid;
+    xtimer_t xtimer;
+
+    pid = thread_create(sleep_stack, sizeof(sleep_stack), THREAD_PRIORITY_MAIN,
+                        THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                        sleep_thread, NULL, "sleep");
+    /* let the thread go to sleep */
+    thread_yield();
+
+    start_timeout(&xtimer);
+    while (!done) {
+        /* two switches: to the sleeping thread and back */
+        count += 2;
+        thread_wakeup(pid);
+        thread_sleep();
+    }
+
+    printf("+ thread_wakeup/thread_sleep: %lu switches per second\n",
+           count / TIMEOUT_S);
+}
+
+int main(void)
+{
+    puts("Start.");
+
+    main_pid = thread_getpid();
+    run_yield();
+    run_sleep();
+
+    puts("Done.");
+    return 0;
+}
@@ -13,6 +13,7 @@
 
 #include "hashes.h"
 #include "bloom.h"
+#include "bloom_blocked.h"
 #include "bitfield.h"
 
 #include "tests-bloom-sets.h"
@@ -23,8 +24,16 @@
 #define TESTS_BLOOM_NOT_IN_FILTER (996)
 #define TESTS_BLOOM_FALSE_POS_RATE_THR (0.005)
 
+#define TESTS_BLOOM_BLOCKED_BITS (BLOOM_BLOCKED_BLOCK_BITS)
+#define TESTS_BLOOM_BLOCKED_K (6)
+#define TESTS_BLOOM_AGING_LIMIT (5)
+
 static bloom_t bloom;
 BITFIELD(bf, TESTS_BLOOM_BITS);
+static bloom_blocked_t blocked;
+static bloom_aging_t aging;
+BITFIELD(blocked_bf, TESTS_BLOOM_BLOCKED_BITS);
+BITFIELD(aging_bf, 2 * TESTS_BLOOM_BLOCKED_BITS);
 hashfp_t hashes[TESTS_BLOOM_HASHF] = {
                      (hashfp_t) fnv_hash,
                      (hashfp_t) sax_hash,
@@ -85,6 +94,76 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
 }
 
+static void set_up_blocked(void)
+{
+    bloom_blocked_init(&blocked, TESTS_BLOOM_BLOCKED_BITS, blocked_bf,
+                       TESTS_BLOOM_BLOCKED_K);
+    bloom_aging_init(&aging, TESTS_BLOOM_BLOCKED_BITS, aging_bf,
+                     TESTS_BLOOM_BLOCKED_K, TESTS_BLOOM_AGING_LIMIT);
+}
+
+static void test_bloom_blocked_based_on_dictionary_fixture(void)
+{
+    int in = 0;
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&blocked, (const uint8_t *) B[i], strlen(B[i]));
+    }
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&blocked, (const uint8_t *) B[i],
+                                        strlen(B[i])));
+    }
+    for (int i = 0; i < lenA; i++) {
+        if (bloom_blocked_check(&blocked, (const uint8_t *) A[i],
+                                strlen(A[i]))) {
+            in++;
+        }
+    }
+    TEST_ASSERT(((double) in / (double) lenA) < TESTS_BLOOM_FALSE_POS_RATE_THR);
+
+    bloom_blocked_clear(&blocked);
+    TEST_ASSERT(!bloom_blocked_check(&blocked, (const uint8_t *) B[0],
+                                     strlen(B[0])));
+}
+
+static void test_bloom_aging_window(void)
+{
+    /* fills both generations */
+    for (int i = 0; i < (2 * TESTS_BLOOM_AGING_LIMIT); i++) {
+        TEST_ASSERT(!bloom_aging_check_add(&aging, (const uint8_t *) B[i],
+                                           strlen(B[i])));
+    }
+    for (int i = 0; i < (2 * TESTS_BLOOM_AGING_LIMIT); i++) {
+        TEST_ASSERT(bloom_aging_check_add(&aging, (const uint8_t *) B[i],
+                                          strlen(B[i])));
+    }
+
+    /* the next key replaces the oldest generation */
+    bloom_aging_add(&aging, (const uint8_t *) A[0], strlen(A[0]));
+    TEST_ASSERT(bloom_aging_check(&aging, (const uint8_t *) A[0],
+                                  strlen(A[0])));
+    for (int i = 0; i < TESTS_BLOOM_AGING_LIMIT; i++) {
+        TEST_ASSERT(!bloom_aging_check(&aging, (const uint8_t *) B[i],
+                                       strlen(B[i])));
+    }
+    for (int i = TESTS_BLOOM_AGING_LIMIT; i < (2 * TESTS_BLOOM_AGING_LIMIT); i++) {
+        TEST_ASSERT(bloom_aging_check(&aging, (const uint8_t *) B[i],
+                                      strlen(B[i])));
+    }
+}
+
+Test *tests_bloom_blocked_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bloom_blocked_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_aging_window),
+    };
+
+    EMB_UNIT_TESTCALLER(bloom_blocked_tests, set_up_blocked, NULL, fixtures);
+
+    return (Test *)&bloom_blocked_tests;
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -100,4 +179,5 @@ Test *tests_bloom_tests(void)
 void tests_bloom(void)
 {
     TESTS_RUN(tests_bloom_tests());
+    TESTS_RUN(tests_bloom_blocked_tests());
 }
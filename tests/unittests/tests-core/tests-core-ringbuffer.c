@@ -16,6 +16,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <string.h>
+
 #include "thread.h"
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -114,10 +116,34 @@ static void tests_core_ringbuffer(void)
     run_add();
 }
 
+static void tests_core_ringbuffer_bulk(void)
+{
+    char buf[BUF_SIZE + 1];
+
+    ringbuffer_init(&rb, rb_buf, sizeof(rb_buf));
+
+    /* move the start close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_add(&rb, "01234", 5));
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_get(&rb, buf, 4));
+
+    /* the added data wraps around, only as much as fits is added */
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 1, ringbuffer_add(&rb, "abcdefgh", 8));
+    assert_avail(BUF_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_add(&rb, "x", 1));
+
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_remove(&rb, 2));
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 2, ringbuffer_peek(&rb, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "bcdef", BUF_SIZE - 2));
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 2, ringbuffer_get(&rb, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "bcdef", BUF_SIZE - 2));
+    assert_avail(0);
+}
+
 Test *tests_core_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(tests_core_ringbuffer),
+        new_TestFixture(tests_core_ringbuffer_bulk),
     };
 
     EMB_UNIT_TESTCALLER(ringbuffer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "coro.h"
+#include "tests-coro.h"
+
+#define TEST_MSG_TYPE_A     (0x1234)
+#define TEST_MSG_TYPE_B     (0x1235)
+#define TEST_MSG_TYPE_NONE  (0x1236)
+
+typedef struct {
+    coro_t coro;
+    uint16_t type;      /* message type the coroutine takes */
+    unsigned rounds;    /* messages to take before exiting */
+    unsigned taken;
+    unsigned timeouts;
+} test_coro_t;
+
+static coro_sched_t sched;
+static test_coro_t a, b;
+
+static int _test_func(coro_t *c)
+{
+    test_coro_t *t = c->arg;
+
+    CORO_BEGIN(c);
+    while (t->taken < t->rounds) {
+        CORO_RECEIVE(c, c->msg->type == t->type);
+        if (coro_timed_out(c)) {
+            t->timeouts++;
+        }
+        else {
+            t->taken++;
+        }
+    }
+    CORO_END(c);
+}
+
+static void _init(test_coro_t *t, uint16_t type, unsigned rounds)
+{
+    memset(t, 0, sizeof(*t));
+    t->type = type;
+    t->rounds = rounds;
+    coro_init(&t->coro, _test_func, t);
+}
+
+static void set_up(void)
+{
+    sched.list = NULL;
+    _init(&a, TEST_MSG_TYPE_A, 2);
+    _init(&b, TEST_MSG_TYPE_B, 2);
+}
+
+static void test_coro_start__exit(void)
+{
+    _init(&a, TEST_MSG_TYPE_A, 0);
+    TEST_ASSERT_EQUAL_INT(CORO_EXITED, coro_start(&sched, &a.coro));
+    TEST_ASSERT(coro_sched_idle(&sched));
+}
+
+static void test_coro_start__wait(void)
+{
+    TEST_ASSERT_EQUAL_INT(CORO_WAITING, coro_start(&sched, &a.coro));
+    TEST_ASSERT(!coro_sched_idle(&sched));
+    TEST_ASSERT_EQUAL_INT(0, a.taken);
+}
+
+static void test_coro_sched_dispatch__demux(void)
+{
+    msg_t msg;
+
+    coro_start(&sched, &a.coro);
+    coro_start(&sched, &b.coro);
+    msg.type = TEST_MSG_TYPE_B;
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(0, a.taken);
+    TEST_ASSERT_EQUAL_INT(1, b.taken);
+    msg.type = TEST_MSG_TYPE_A;
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(1, a.taken);
+    TEST_ASSERT_EQUAL_INT(1, b.taken);
+    msg.type = TEST_MSG_TYPE_NONE;
+    TEST_ASSERT(!coro_sched_dispatch(&sched, &msg));
+}
+
+static void test_coro_sched_dispatch__one_taker(void)
+{
+    msg_t msg;
+
+    /* both coroutines want the message, only one gets it */
+    _init(&b, TEST_MSG_TYPE_A, 2);
+    coro_start(&sched, &a.coro);
+    coro_start(&sched, &b.coro);
+    msg.type = TEST_MSG_TYPE_A;
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(1, a.taken + b.taken);
+}
+
+static void test_coro_sched_dispatch__exit(void)
+{
+    msg_t msg;
+
+    coro_start(&sched, &a.coro);
+    msg.type = TEST_MSG_TYPE_A;
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT(!coro_sched_idle(&sched));
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT(coro_sched_idle(&sched));
+    TEST_ASSERT_EQUAL_INT(2, a.taken);
+    /* exited coroutine does not take messages anymore */
+    TEST_ASSERT(!coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(2, a.taken);
+}
+
+static void test_coro_sched_dispatch__timeout(void)
+{
+    msg_t msg;
+
+    coro_start(&sched, &a.coro);
+    coro_start(&sched, &b.coro);
+    /* timeouts are only taken by their coroutine */
+    msg.type = CORO_MSG_TYPE_TIMEOUT;
+    msg.content.ptr = &b.coro;
+    TEST_ASSERT(coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(0, a.timeouts);
+    TEST_ASSERT_EQUAL_INT(1, b.timeouts);
+    TEST_ASSERT_EQUAL_INT(0, b.taken);
+    /* stale timeout */
+    msg.content.ptr = &sched;
+    TEST_ASSERT(!coro_sched_dispatch(&sched, &msg));
+}
+
+static void test_coro_cancel(void)
+{
+    msg_t msg;
+
+    coro_start(&sched, &a.coro);
+    coro_start(&sched, &b.coro);
+    coro_cancel(&sched, &a.coro);
+    msg.type = TEST_MSG_TYPE_A;
+    TEST_ASSERT(!coro_sched_dispatch(&sched, &msg));
+    TEST_ASSERT_EQUAL_INT(0, a.taken);
+    coro_cancel(&sched, &b.coro);
+    TEST_ASSERT(coro_sched_idle(&sched));
+}
+
+Test *tests_coro_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_coro_start__exit),
+        new_TestFixture(test_coro_start__wait),
+        new_TestFixture(test_coro_sched_dispatch__demux),
+        new_TestFixture(test_coro_sched_dispatch__one_taker),
+        new_TestFixture(test_coro_sched_dispatch__exit),
+        new_TestFixture(test_coro_sched_dispatch__timeout),
+        new_TestFixture(test_coro_cancel),
+    };
+
+    EMB_UNIT_TESTCALLER(coro_tests, set_up, NULL, fixtures);
+
+    return (Test *)&coro_tests;
+}
+
+void tests_coro(void)
+{
+    TESTS_RUN(tests_coro_tests());
+}
+/** @} */
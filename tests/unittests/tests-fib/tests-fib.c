@@ -976,6 +976,69 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief snapshot a FIB and restore it after de-initialization
+* It is expected to find all entries again after the restore
+*/
+static void test_fib_21_snapshot_restore(void)
+{
+    size_t add_buf_size = 16; /* includes space for terminating \0 */
+    char addr_dst[] = "Test address 03";
+    char addr_expect[] = "Test address 13";
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    char addr_nxt[add_buf_size];
+    /* header + 10 * (interface + flags + lifetime + 2 * sized address) */
+    size_t snapshot_size = 7 + 10 * (2 + 4 + 4 + 4 + 2 * (1 + 15));
+    uint8_t snapshot[snapshot_size];
+    size_t size = 0;
+
+    size_t entries = 10;
+    _fill_FIB_unique(entries);
+
+    /* query the required size */
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, fib_snapshot(&test_fib_table, NULL, &size));
+    TEST_ASSERT_EQUAL_INT(snapshot_size, size);
+
+    size = sizeof(snapshot) - 1;
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, fib_snapshot(&test_fib_table, snapshot, &size));
+
+    size = sizeof(snapshot);
+    TEST_ASSERT_EQUAL_INT(0, fib_snapshot(&test_fib_table, snapshot, &size));
+    TEST_ASSERT_EQUAL_INT(snapshot_size, size);
+
+    fib_deinit(&test_fib_table);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+
+    /* a truncated snapshot is rejected */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, fib_restore(&test_fib_table, snapshot, 6));
+
+    TEST_ASSERT_EQUAL_INT(0, fib_restore(&test_fib_table, snapshot, size));
+    TEST_ASSERT_EQUAL_INT(10, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(20, universal_address_get_num_used_entries());
+
+    int ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                               (uint8_t *)addr_nxt, &add_buf_size, &next_hop_flags,
+                               (uint8_t *)addr_dst, add_buf_size - 1, 0x13);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(42, iface_id);
+    TEST_ASSERT_EQUAL_INT(0x00777777, next_hop_flags);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(addr_expect, addr_nxt, add_buf_size - 1));
+
+    /* restoring again only updates the existing entries */
+    TEST_ASSERT_EQUAL_INT(0, fib_restore(&test_fib_table, snapshot, size));
+    TEST_ASSERT_EQUAL_INT(10, fib_get_num_used_entries(&test_fib_table));
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1063,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_snapshot_restore),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
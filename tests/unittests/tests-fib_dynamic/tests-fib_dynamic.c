@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdio.h> /**< required for snprintf() */
+#include <string.h>
+#include <errno.h>
+#include "embUnit.h"
+#include "tests-fib_dynamic.h"
+
+#include "net/fib.h"
+#include "universal_address.h"
+
+/**
+ * @brief the number of entries allocated by fib_init()
+ */
+#define TEST_FIB_TABLE_SIZE     (FIB_DYNAMIC_GROW_STEP)
+
+/**
+ * @brief the number of entries the table may grow to
+ */
+#define TEST_FIB_TABLE_MAX_SIZE (3 * FIB_DYNAMIC_GROW_STEP)
+
+static fib_table_t test_fib_table;
+
+static void set_up(void)
+{
+    test_fib_table.data.entries = NULL;
+    test_fib_table.table_type = FIB_TABLE_TYPE_SH;
+    test_fib_table.size = TEST_FIB_TABLE_SIZE;
+    test_fib_table.max_size = TEST_FIB_TABLE_MAX_SIZE;
+    fib_init(&test_fib_table);
+}
+
+static void tear_down(void)
+{
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief helper to add the entry with the given number
+*/
+static int _add_entry(size_t i)
+{
+    char addr_dst[16];
+    char addr_nxt[16];
+
+    /* construct "addresses" for the FIB */
+    snprintf(addr_dst, sizeof(addr_dst), "Test address %02d", (int)i);
+    snprintf(addr_nxt, sizeof(addr_nxt), "Test address %02d", (int)(i + 50));
+    /* the terminating \0 is unnecessary here */
+    return fib_add_entry(&test_fib_table, 42,
+                         (uint8_t *)addr_dst, sizeof(addr_dst) - 1, 0x0,
+                         (uint8_t *)addr_nxt, sizeof(addr_nxt) - 1, 0x0,
+                         10000);
+}
+
+/*
+* @brief helper to remove the entry with the given number
+*/
+static void _remove_entry(size_t i)
+{
+    char addr_dst[16];
+
+    snprintf(addr_dst, sizeof(addr_dst), "Test address %02d", (int)i);
+    fib_remove_entry(&test_fib_table, (uint8_t *)addr_dst, sizeof(addr_dst) - 1);
+}
+
+/*
+* @brief fib_init() allocates the initial entries
+*/
+static void test_fib_dynamic_01_init_allocates(void)
+{
+    TEST_ASSERT_NOT_NULL(test_fib_table.data.entries);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_SIZE, test_fib_table.size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+}
+
+/*
+* @brief add more entries than initially allocated
+* It is expected that the table grows up to its maximum size
+*/
+static void test_fib_dynamic_02_grow(void)
+{
+    for (size_t i = 0; i < TEST_FIB_TABLE_MAX_SIZE; ++i) {
+        TEST_ASSERT_EQUAL_INT(0, _add_entry(i));
+    }
+
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE, test_fib_table.size);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add_entry(TEST_FIB_TABLE_MAX_SIZE));
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE, test_fib_table.size);
+
+    /* the entries survived moving to the grown table */
+    char addr_dst[] = "Test address 00";
+    char addr_expect[] = "Test address 50";
+    char addr_nxt[16];
+    size_t addr_nxt_size = sizeof(addr_nxt);
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              (uint8_t *)addr_nxt, &addr_nxt_size,
+                                              &next_hop_flags, (uint8_t *)addr_dst,
+                                              sizeof(addr_dst) - 1, 0x0));
+    TEST_ASSERT_EQUAL_INT(42, iface_id);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(addr_expect, addr_nxt, sizeof(addr_expect) - 1));
+}
+
+/*
+* @brief remove the entries of a grown table from the end
+* It is expected that the table keeps one step of spare entries,
+* and shrinks back to its initial size
+*/
+static void test_fib_dynamic_03_shrink(void)
+{
+    for (size_t i = 0; i < TEST_FIB_TABLE_MAX_SIZE; ++i) {
+        TEST_ASSERT_EQUAL_INT(0, _add_entry(i));
+    }
+
+    /* removing the last step keeps it as spare entries */
+    for (size_t i = 2 * FIB_DYNAMIC_GROW_STEP; i < TEST_FIB_TABLE_MAX_SIZE; ++i) {
+        _remove_entry(i);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE, test_fib_table.size);
+
+    _remove_entry(2 * FIB_DYNAMIC_GROW_STEP - 1);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE - 1, test_fib_table.size);
+    TEST_ASSERT_EQUAL_INT(2 * FIB_DYNAMIC_GROW_STEP - 1,
+                          fib_get_num_used_entries(&test_fib_table));
+
+    /* the table never shrinks below its initial size */
+    fib_flush(&test_fib_table, KERNEL_PID_UNDEF);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_SIZE, test_fib_table.size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+
+    /* and grows again */
+    for (size_t i = 0; i < TEST_FIB_TABLE_MAX_SIZE; ++i) {
+        TEST_ASSERT_EQUAL_INT(0, _add_entry(i));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_MAX_SIZE, test_fib_table.size);
+}
+
+/*
+* @brief de-initialize a grown table
+* It is expected that the entries are freed, and allocated again
+* with the initial size by fib_init()
+*/
+static void test_fib_dynamic_04_deinit_frees(void)
+{
+    for (size_t i = 0; i < TEST_FIB_TABLE_MAX_SIZE; ++i) {
+        TEST_ASSERT_EQUAL_INT(0, _add_entry(i));
+    }
+
+    fib_deinit(&test_fib_table);
+    TEST_ASSERT_NULL(test_fib_table.data.entries);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_SIZE, test_fib_table.size);
+
+    fib_init(&test_fib_table);
+    TEST_ASSERT_NOT_NULL(test_fib_table.data.entries);
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_SIZE, test_fib_table.size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+}
+
+Test *tests_fib_dynamic_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fib_dynamic_01_init_allocates),
+        new_TestFixture(test_fib_dynamic_02_grow),
+        new_TestFixture(test_fib_dynamic_03_shrink),
+        new_TestFixture(test_fib_dynamic_04_deinit_frees),
+    };
+
+    EMB_UNIT_TESTCALLER(fib_dynamic_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&fib_dynamic_tests;
+}
+
+void tests_fib_dynamic(void)
+{
+    TESTS_RUN(tests_fib_dynamic_tests());
+}
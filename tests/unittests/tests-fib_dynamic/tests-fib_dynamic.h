@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``fib_dynamic`` module
+ */
+#ifndef TESTS_FIB_DYNAMIC_H_
+#define TESTS_FIB_DYNAMIC_H_
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_fib_dynamic(void);
+
+/**
+ * @brief   Generates tests for FIB tables growing from the heap
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_fib_dynamic_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_FIB_DYNAMIC_H_ */
+/** @} */
@@ -700,6 +700,114 @@ static void test_fib_sr_12_get_consecutive_sr(void)
     fib_deinit(&test_fib_sr_table);
 }
 
+/*
+ * @brief snapshot a source route table and restore it after de-initialization
+ */
+static void test_fib_sr_13_snapshot_restore(void)
+{
+    fib_sr_t *local_sourceroutes[1];
+    size_t add_buf_size = 16;
+    char addr_nxt[add_buf_size];
+    /* header + interface + flags + lifetime + hop count + 5 sized hops */
+    uint8_t snapshot[7 + 2 + 4 + 4 + 1 + 5 * (1 + 16)];
+    size_t size = sizeof(snapshot);
+
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_create(&test_fib_sr_table, &local_sourceroutes[0],
+                                           42, 0x5, 10000));
+
+    TEST_ASSERT_EQUAL_INT(0, _create_sr("Some address X", 0, 5, local_sourceroutes[0], 16));
+
+    TEST_ASSERT_EQUAL_INT(0, fib_snapshot(&test_fib_sr_table, snapshot, &size));
+    TEST_ASSERT_EQUAL_INT(sizeof(snapshot), size);
+
+    fib_deinit(&test_fib_sr_table);
+
+    TEST_ASSERT_EQUAL_INT(0, fib_restore(&test_fib_sr_table, snapshot, size));
+
+    size_t addr_list_elements = 5;
+    size_t element_size = 16;
+    uint8_t addr_list[ addr_list_elements * element_size ];
+    kernel_pid_t sr_iface_id;
+    uint32_t sr_flags = 0x5;
+    snprintf(addr_nxt, add_buf_size, "Some address X4");
+
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_nxt,
+                                              add_buf_size, &sr_iface_id, &sr_flags,
+                                              addr_list, &addr_list_elements, &element_size,
+                                              false, NULL)
+                          );
+    TEST_ASSERT_EQUAL_INT(5, addr_list_elements);
+    TEST_ASSERT_EQUAL_INT(42, sr_iface_id);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("Some address X0", addr_list, add_buf_size));
+
+    fib_deinit(&test_fib_sr_table);
+}
+
+/*
+ * @brief overwrite and truncate a source route and look up its hops
+ * It is expected that lookups follow the changed addresses
+ */
+static void test_fib_sr_14_lookup_after_overwrite_and_truncate(void)
+{
+    fib_sr_t *local_sourceroutes[1];
+    fib_sr_entry_t *sr_path_entry;
+    size_t add_buf_size = 16;
+    char addr_old[add_buf_size];
+    char addr_nxt[add_buf_size];
+
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_create(&test_fib_sr_table, &local_sourceroutes[0],
+                                           42, 0x0, 10000));
+    TEST_ASSERT_EQUAL_INT(0, _create_sr("Some address X", 0, 5, local_sourceroutes[0], 16));
+
+    snprintf(addr_old, add_buf_size, "Some address X2");
+    snprintf(addr_nxt, add_buf_size, "Some address Y2");
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_overwrite(&test_fib_sr_table, local_sourceroutes[0],
+                                                    (uint8_t *)&addr_old, add_buf_size,
+                                                    (uint8_t *)&addr_nxt, add_buf_size)
+                          );
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_search(&test_fib_sr_table, local_sourceroutes[0],
+                                           (uint8_t *)&addr_nxt, add_buf_size,
+                                           &sr_path_entry)
+                          );
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, fib_sr_search(&test_fib_sr_table,
+                                                       local_sourceroutes[0],
+                                                       (uint8_t *)&addr_old, add_buf_size,
+                                                       &sr_path_entry)
+                          );
+
+    /* we delete X3 and all hops behind it */
+    snprintf(addr_old, add_buf_size, "Some address X3");
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_delete(&test_fib_sr_table, local_sourceroutes[0],
+                                                 (uint8_t *)&addr_old, add_buf_size,
+                                                 false)
+                          );
+
+    size_t addr_list_elements = 5;
+    size_t element_size = 16;
+    uint8_t addr_list[ addr_list_elements * element_size ];
+    kernel_pid_t sr_iface_id;
+    uint32_t sr_flags = 0x0;
+
+    /* Y2 is the new destination */
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_nxt,
+                                              add_buf_size, &sr_iface_id, &sr_flags,
+                                              addr_list, &addr_list_elements, &element_size,
+                                              false, NULL)
+                          );
+    TEST_ASSERT_EQUAL_INT(3, addr_list_elements);
+
+    snprintf(addr_old, add_buf_size, "Some address X4");
+    addr_list_elements = 5;
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, fib_sr_get_route(&test_fib_sr_table,
+                                                          (uint8_t *)&addr_old, add_buf_size,
+                                                          &sr_iface_id, &sr_flags, addr_list,
+                                                          &addr_list_elements, &element_size,
+                                                          false, NULL)
+                          );
+
+    fib_deinit(&test_fib_sr_table);
+}
+
 Test *tests_fib_sr_tests(void)
 {
     test_fib_sr_table.data.source_routes = &_entries_sr;
@@ -722,6 +830,8 @@ Test *tests_fib_sr_tests(void)
         new_TestFixture(test_fib_sr_10_create_sr_with_hops_and_get_a_route),
         new_TestFixture(test_fib_sr_11_create_sr_with_hops_and_get_a_partial_route),
         new_TestFixture(test_fib_sr_12_get_consecutive_sr),
+        new_TestFixture(test_fib_sr_13_snapshot_restore),
+        new_TestFixture(test_fib_sr_14_lookup_after_overwrite_and_truncate),
     };
 
     EMB_UNIT_TESTCALLER(fib_sr_tests, NULL, NULL, fixtures);
@@ -60,6 +60,19 @@ static void test_fmt_bytes_hex_reverse(void)
     TEST_ASSERT_EQUAL_STRING("06070809", (char *) out);
 }
 
+static void test_fmt_bytes_hex(void)
+{
+    char out[15] = "--------------";
+    uint8_t val[7] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd };
+
+    TEST_ASSERT_EQUAL_INT(14, fmt_bytes_hex(out, val, 7));
+    TEST_ASSERT_EQUAL_STRING("0123456789ABCD", (char *) out);
+
+    TEST_ASSERT_EQUAL_INT(6, fmt_bytes_hex_reverse(out, val + 4, 3));
+    out[6] = '\0';
+    TEST_ASSERT_EQUAL_STRING("CDAB89", (char *) out);
+}
+
 static void test_fmt_u32_hex(void)
 {
     char out[9] = "--------";
@@ -280,6 +293,7 @@ Test *tests_fmt_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_fmt_byte_hex),
         new_TestFixture(test_fmt_bytes_hex_reverse),
+        new_TestFixture(test_fmt_bytes_hex),
         new_TestFixture(test_fmt_u32_hex),
         new_TestFixture(test_fmt_u64_hex),
         new_TestFixture(test_fmt_u32_dec),
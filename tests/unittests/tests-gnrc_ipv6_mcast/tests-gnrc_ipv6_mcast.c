@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/gnrc/ipv6/mcast.h"
+#include "tests-gnrc_ipv6_mcast.h"
+
+#define IFACE_A     (KERNEL_PID_LAST)
+#define IFACE_B     (KERNEL_PID_LAST - 1)
+#define IFACE_C     (KERNEL_PID_LAST - 2)
+#define IFACE_D     (KERNEL_PID_LAST - 3)
+
+static const ipv6_addr_t group_a = { {
+        0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+static const ipv6_addr_t group_b = { {
+        0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0xff, 0x12, 0x34, 0x56
+    } };
+static const ipv6_addr_t unicast = { {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+
+static void set_up(void)
+{
+    gnrc_ipv6_mcast_leave_all(IFACE_A);
+    gnrc_ipv6_mcast_leave_all(IFACE_B);
+    gnrc_ipv6_mcast_leave_all(IFACE_C);
+    gnrc_ipv6_mcast_leave_all(IFACE_D);
+}
+
+static void _group(ipv6_addr_t *addr, unsigned i)
+{
+    *addr = group_b;
+    addr->u8[15] = (uint8_t)i;
+}
+
+static void test_gnrc_ipv6_mcast_join__EINVAL(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_ipv6_mcast_join(KERNEL_PID_UNDEF, &group_a));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_ipv6_mcast_join(IFACE_A, &unicast));
+}
+
+static void test_gnrc_ipv6_mcast_join__ENOMEM_ifs(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_B, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_C, &group_a));
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_ipv6_mcast_join(IFACE_D, &group_a));
+}
+
+static void test_gnrc_ipv6_mcast_join__ENOMEM_groups(void)
+{
+    ipv6_addr_t addr;
+
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group(&addr, i);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &addr));
+    }
+    _group(&addr, GNRC_IPV6_MCAST_GROUP_NUMOF);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_ipv6_mcast_join(IFACE_A, &addr));
+    /* joining an existing group on another interface does not need a new entry */
+    _group(&addr, 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_B, &addr));
+}
+
+static void test_gnrc_ipv6_mcast_join__twice(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    gnrc_ipv6_mcast_leave(IFACE_A, &group_a);
+    TEST_ASSERT_EQUAL_INT(KERNEL_PID_UNDEF, gnrc_ipv6_mcast_rcv(IFACE_A, &group_a));
+}
+
+static void test_gnrc_ipv6_mcast_rcv(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_B, &group_b));
+    TEST_ASSERT_EQUAL_INT(IFACE_A, gnrc_ipv6_mcast_rcv(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(KERNEL_PID_UNDEF, gnrc_ipv6_mcast_rcv(IFACE_B, &group_a));
+    TEST_ASSERT_EQUAL_INT(IFACE_A, gnrc_ipv6_mcast_rcv(KERNEL_PID_UNDEF, &group_a));
+    TEST_ASSERT_EQUAL_INT(IFACE_B, gnrc_ipv6_mcast_rcv(KERNEL_PID_UNDEF, &group_b));
+    TEST_ASSERT_EQUAL_INT(KERNEL_PID_UNDEF, gnrc_ipv6_mcast_rcv(IFACE_C, &group_b));
+}
+
+static void test_gnrc_ipv6_mcast_leave(void)
+{
+    ipv6_addr_t addr;
+
+    /* fill the table, so lookups of the left groups probe the whole table */
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group(&addr, i);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &addr));
+    }
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i += 2) {
+        _group(&addr, i);
+        gnrc_ipv6_mcast_leave(IFACE_A, &addr);
+    }
+    for (unsigned i = 0; i < GNRC_IPV6_MCAST_GROUP_NUMOF; i++) {
+        _group(&addr, i);
+        TEST_ASSERT_EQUAL_INT((i & 1) ? IFACE_A : KERNEL_PID_UNDEF,
+                              gnrc_ipv6_mcast_rcv(IFACE_A, &addr));
+    }
+    /* left entries are reused */
+    _group(&addr, GNRC_IPV6_MCAST_GROUP_NUMOF);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &addr));
+    TEST_ASSERT_EQUAL_INT(IFACE_A, gnrc_ipv6_mcast_rcv(IFACE_A, &addr));
+}
+
+static void test_gnrc_ipv6_mcast_leave_all(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_b));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_B, &group_a));
+    gnrc_ipv6_mcast_leave_all(IFACE_A);
+    TEST_ASSERT_EQUAL_INT(KERNEL_PID_UNDEF, gnrc_ipv6_mcast_rcv(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(KERNEL_PID_UNDEF, gnrc_ipv6_mcast_rcv(IFACE_A, &group_b));
+    TEST_ASSERT_EQUAL_INT(IFACE_B, gnrc_ipv6_mcast_rcv(IFACE_B, &group_a));
+    /* the interface's bit is free for another interface again */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_C, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_D, &group_a));
+}
+
+static void test_gnrc_ipv6_mcast_get_stats(void)
+{
+    gnrc_ipv6_mcast_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_ipv6_mcast_get_stats(&group_a, &stats));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_get_stats(&group_a, &stats));
+    TEST_ASSERT_EQUAL_INT(0, stats.rx_count);
+    TEST_ASSERT_EQUAL_INT(0, stats.tx_count);
+    gnrc_ipv6_mcast_rcv(IFACE_A, &group_a);
+    gnrc_ipv6_mcast_rcv(IFACE_B, &group_a);     /* not counted */
+    gnrc_ipv6_mcast_rcv(KERNEL_PID_UNDEF, &group_a);
+    gnrc_ipv6_mcast_sent(&group_a);
+    gnrc_ipv6_mcast_sent(&group_b);             /* not counted */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_get_stats(&group_a, &stats));
+    TEST_ASSERT_EQUAL_INT(2, stats.rx_count);
+    TEST_ASSERT_EQUAL_INT(1, stats.tx_count);
+    /* counters restart when the group is joined again */
+    gnrc_ipv6_mcast_leave(IFACE_A, &group_a);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_ipv6_mcast_get_stats(&group_a, &stats));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_join(IFACE_A, &group_a));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_mcast_get_stats(&group_a, &stats));
+    TEST_ASSERT_EQUAL_INT(0, stats.rx_count);
+}
+
+Test *tests_gnrc_ipv6_mcast_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_ipv6_mcast_join__EINVAL),
+        new_TestFixture(test_gnrc_ipv6_mcast_join__ENOMEM_ifs),
+        new_TestFixture(test_gnrc_ipv6_mcast_join__ENOMEM_groups),
+        new_TestFixture(test_gnrc_ipv6_mcast_join__twice),
+        new_TestFixture(test_gnrc_ipv6_mcast_rcv),
+        new_TestFixture(test_gnrc_ipv6_mcast_leave),
+        new_TestFixture(test_gnrc_ipv6_mcast_leave_all),
+        new_TestFixture(test_gnrc_ipv6_mcast_get_stats),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_ipv6_mcast_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_ipv6_mcast_tests;
+}
+
+void tests_gnrc_ipv6_mcast(void)
+{
+    TESTS_RUN(tests_gnrc_ipv6_mcast_tests());
+}
+/** @} */
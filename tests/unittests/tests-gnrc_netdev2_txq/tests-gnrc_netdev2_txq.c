@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/netdev2.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+
+#include "tests-gnrc_netdev2_txq.h"
+
+#define DSCP_BULK       (0U)
+#define DSCP_PRIO       (46U)   /* EF */
+#define DSCP_CTRL       (48U)   /* CS6 */
+#define SENT_NUMOF      (GNRC_NETDEV2_TXQ_LEN + 2)
+
+static netdev2_t _netdev;
+static gnrc_netdev2_t _dev;
+static uint8_t _sent[SENT_NUMOF];
+static unsigned _sent_num;
+
+/* takes the place of the device */
+static int _send(gnrc_netdev2_t *dev, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *payload = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+
+    (void)dev;
+    if ((payload != NULL) && (_sent_num < SENT_NUMOF)) {
+        _sent[_sent_num] = *((uint8_t *)payload->data);
+    }
+    _sent_num++;
+    gnrc_pktbuf_release(pkt);
+    return 0;
+}
+
+/* builds a packet with the given DSCP, identified by the first payload byte */
+static gnrc_pktsnip_t *_pkt(uint8_t dscp, uint8_t id, size_t len)
+{
+    gnrc_pktsnip_t *payload, *ipv6, *netif;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return NULL;
+    }
+    memset(payload->data, id, len);
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    memset(ipv6->data, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(ipv6->data);
+    ipv6_hdr_set_tc_dscp(ipv6->data, dscp);
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    netif->next = ipv6;
+    return netif;
+}
+
+static void _put(uint8_t dscp, uint8_t id, size_t len)
+{
+    gnrc_pktsnip_t *pkt = _pkt(dscp, id, len);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_netdev2_txq_test_put(&_dev, pkt);
+}
+
+static void _send_all(void)
+{
+    while (gnrc_netdev2_txq_test_send_next(&_dev)) {}
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    memset(&_netdev, 0, sizeof(_netdev));
+    memset(&_dev, 0, sizeof(_dev));
+    _dev.send = _send;
+    _dev.dev = &_netdev;
+    gnrc_netdev2_txq_test_init(&_dev);
+    memset(_sent, 0, sizeof(_sent));
+    _sent_num = 0;
+}
+
+static void tear_down(void)
+{
+    _send_all();
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_txq__order(void)
+{
+    _put(DSCP_BULK, 1, 8);
+    _put(DSCP_BULK, 2, 8);
+    _put(DSCP_PRIO, 3, 8);
+    _put(DSCP_CTRL, 4, 8);
+    _put(DSCP_PRIO, 5, 8);
+    _send_all();
+    TEST_ASSERT_EQUAL_INT(5, _sent_num);
+    TEST_ASSERT_EQUAL_INT(4, _sent[0]);
+    TEST_ASSERT_EQUAL_INT(3, _sent[1]);
+    TEST_ASSERT_EQUAL_INT(5, _sent[2]);
+    TEST_ASSERT_EQUAL_INT(1, _sent[3]);
+    TEST_ASSERT_EQUAL_INT(2, _sent[4]);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netdev2_txq_test_send_next(&_dev));
+}
+
+static void test_txq__marked(void)
+{
+    gnrc_pktsnip_t *pkt = _pkt(DSCP_CTRL, 2, 8);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* 6LoWPAN marks the packet, then compresses the IPv6 header away */
+    gnrc_netdev2_txq_mark(pkt);
+    TEST_ASSERT(((gnrc_netif_hdr_t *)pkt->data)->flags & GNRC_NETIF_HDR_FLAGS_TXQ_CTRL);
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt->next);
+
+    _put(DSCP_BULK, 1, 8);
+    gnrc_netdev2_txq_test_put(&_dev, pkt);
+    _send_all();
+    TEST_ASSERT_EQUAL_INT(2, _sent_num);
+    TEST_ASSERT_EQUAL_INT(2, _sent[0]);
+    TEST_ASSERT_EQUAL_INT(1, _sent[1]);
+}
+
+static void test_txq__evict_lower(void)
+{
+    /* the second bulk packet fills the queue, so the oldest bulk packet has
+     * to make room for the prioritized one */
+    _put(DSCP_BULK, 1, (GNRC_NETDEV2_TXQ_BYTES * 2) / 5);
+    _put(DSCP_BULK, 2, (GNRC_NETDEV2_TXQ_BYTES * 2) / 5);
+    _put(DSCP_PRIO, 3, (GNRC_NETDEV2_TXQ_BYTES * 2) / 5);
+    _send_all();
+    TEST_ASSERT_EQUAL_INT(2, _sent_num);
+    TEST_ASSERT_EQUAL_INT(3, _sent[0]);
+    TEST_ASSERT_EQUAL_INT(2, _sent[1]);
+}
+
+static void test_txq__no_evict_if_too_large(void)
+{
+    /* dropping the bulk packet would not make room for the prioritized one */
+    _put(DSCP_CTRL, 1, GNRC_NETDEV2_TXQ_BYTES / 2);
+    _put(DSCP_BULK, 2, GNRC_NETDEV2_TXQ_BYTES / 5);
+    _put(DSCP_PRIO, 3, GNRC_NETDEV2_TXQ_BYTES / 2);
+    _send_all();
+    TEST_ASSERT_EQUAL_INT(2, _sent_num);
+    TEST_ASSERT_EQUAL_INT(1, _sent[0]);
+    TEST_ASSERT_EQUAL_INT(2, _sent[1]);
+}
+
+static void test_txq__no_evict_if_class_full(void)
+{
+    _put(DSCP_BULK, 1, 8);
+    for (unsigned i = 0; i < GNRC_NETDEV2_TXQ_LEN; i++) {
+        _put(DSCP_CTRL, 2, 8);
+    }
+    /* the control class is full, dropping the bulk packet does not help */
+    _put(DSCP_CTRL, 3, 8);
+    _send_all();
+    TEST_ASSERT_EQUAL_INT(GNRC_NETDEV2_TXQ_LEN + 1, _sent_num);
+    TEST_ASSERT_EQUAL_INT(2, _sent[GNRC_NETDEV2_TXQ_LEN - 1]);
+    TEST_ASSERT_EQUAL_INT(1, _sent[GNRC_NETDEV2_TXQ_LEN]);
+}
+
+static Test *tests_gnrc_netdev2_txq_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_txq__order),
+        new_TestFixture(test_txq__marked),
+        new_TestFixture(test_txq__evict_lower),
+        new_TestFixture(test_txq__no_evict_if_too_large),
+        new_TestFixture(test_txq__no_evict_if_class_full),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netdev2_txq_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_netdev2_txq_tests;
+}
+
+void tests_gnrc_netdev2_txq(void)
+{
+    TESTS_RUN(tests_gnrc_netdev2_txq_tests());
+}
+/** @} */
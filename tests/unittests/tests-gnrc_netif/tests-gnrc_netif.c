@@ -14,10 +14,13 @@
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit/embUnit.h"
 #include "kernel_types.h"
+#include "net/eui64.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/netif/attr.h"
 
 #include "unittests-constants.h"
 #include "tests-gnrc_netif.h"
@@ -284,6 +287,140 @@ static void test_gnrc_netif_addr_from_str__success(void)
     TEST_ASSERT_EQUAL_INT(0xcd, out[1]);
 }
 
+static unsigned _attr_get_size_errors;
+
+/* like drivers, insists on the exact size for fixed size options */
+static int _attr_get(void *ctx, netopt_t opt, void *value, size_t max_len)
+{
+    const uint8_t *addr = ctx;
+
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            if (max_len != GNRC_NETIF_ATTR_MAXLEN) {
+                break;
+            }
+            memcpy(value, addr, 2);
+            return 2;
+        case NETOPT_SRC_LEN:
+            if (max_len != sizeof(uint16_t)) {
+                break;
+            }
+            *((uint16_t *)value) = 2;
+            return sizeof(uint16_t);
+        case NETOPT_IS_WIRED:
+            if ((value != NULL) || (max_len != 0)) {
+                break;
+            }
+            return 1;
+        case NETOPT_IPV6_IID:
+            if (max_len != sizeof(eui64_t)) {
+                break;
+            }
+            /* pretend the value does not fit into the cache */
+            return -EOVERFLOW;
+        default:
+            return -ENOTSUP;
+    }
+    _attr_get_size_errors++;
+    return -EINVAL;
+}
+
+static void test_gnrc_netif_attr_get__not_published(void)
+{
+    uint8_t out[2];
+    int res;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8, NETOPT_ADDRESS,
+                                                 out, sizeof(out), &res));
+}
+
+static void test_gnrc_netif_attr_get__success(void)
+{
+    uint8_t addr[] = { 0xab, 0xcd };
+    uint8_t out[2];
+    uint16_t src_len = 0;
+    int res = 0;
+
+    _attr_get_size_errors = 0;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_publish(TEST_UINT8, _attr_get,
+                                                     addr));
+    TEST_ASSERT_EQUAL_INT(0, _attr_get_size_errors);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_attr_get(TEST_UINT8, NETOPT_ADDRESS,
+                                                 out, sizeof(out), &res));
+    TEST_ASSERT_EQUAL_INT(2, res);
+    TEST_ASSERT_EQUAL_INT(0xab, out[0]);
+    TEST_ASSERT_EQUAL_INT(0xcd, out[1]);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_attr_get(TEST_UINT8, NETOPT_IS_WIRED,
+                                                 NULL, 0, &res));
+    TEST_ASSERT_EQUAL_INT(1, res);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_attr_get(TEST_UINT8,
+                                                 NETOPT_ADDRESS_LONG,
+                                                 out, sizeof(out), &res));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, res);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_attr_get(TEST_UINT8, NETOPT_SRC_LEN,
+                                                 &src_len, sizeof(src_len),
+                                                 &res));
+    TEST_ASSERT_EQUAL_INT(sizeof(uint16_t), res);
+    TEST_ASSERT_EQUAL_INT(2, src_len);
+    gnrc_netif_attr_remove(TEST_UINT8);
+}
+
+static void test_gnrc_netif_attr_get__not_cached(void)
+{
+    uint8_t addr[] = { 0xab, 0xcd };
+    uint8_t out[8];
+    int res;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_publish(TEST_UINT8, _attr_get,
+                                                     addr));
+    /* not a cached option */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8, NETOPT_CHANNEL,
+                                                 out, sizeof(out), &res));
+    /* value too large for the cache */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8, NETOPT_IPV6_IID,
+                                                 out, sizeof(out), &res));
+    /* buffer too small, left to the device */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8, NETOPT_ADDRESS,
+                                                 out, 1, &res));
+    /* other interface */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8 + 1,
+                                                 NETOPT_ADDRESS,
+                                                 out, sizeof(out), &res));
+    gnrc_netif_attr_remove(TEST_UINT8);
+}
+
+static void test_gnrc_netif_attr_publish__memfull(void)
+{
+    uint8_t addr[] = { 0xab, 0xcd };
+
+    for (int i = 0; i < GNRC_NETIF_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_publish(TEST_UINT8 + i,
+                                                         _attr_get, addr));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, gnrc_netif_attr_publish(TEST_UINT8 - 1,
+                                                           _attr_get, addr));
+    /* updating a published interface still works */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_publish(TEST_UINT8, _attr_get,
+                                                     addr));
+    for (int i = 0; i < GNRC_NETIF_NUMOF; i++) {
+        gnrc_netif_attr_remove(TEST_UINT8 + i);
+    }
+}
+
+static void test_gnrc_netif_attr_remove(void)
+{
+    uint8_t addr[] = { 0xab, 0xcd };
+    uint8_t out[2];
+    int res;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_add(TEST_UINT8));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_publish(TEST_UINT8, _attr_get,
+                                                     addr));
+    gnrc_netif_remove(TEST_UINT8);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_attr_get(TEST_UINT8, NETOPT_ADDRESS,
+                                                 out, sizeof(out), &res));
+}
+
 Test *tests_gnrc_netif_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -310,6 +447,11 @@ Test *tests_gnrc_netif_tests(void)
         new_TestFixture(test_gnrc_netif_addr_from_str__ill_leading_delimitter),
         new_TestFixture(test_gnrc_netif_addr_from_str__ill_extra_delimitter),
         new_TestFixture(test_gnrc_netif_addr_from_str__success),
+        new_TestFixture(test_gnrc_netif_attr_get__not_published),
+        new_TestFixture(test_gnrc_netif_attr_get__success),
+        new_TestFixture(test_gnrc_netif_attr_get__not_cached),
+        new_TestFixture(test_gnrc_netif_attr_publish__memfull),
+        new_TestFixture(test_gnrc_netif_attr_remove),
     };
 
     EMB_UNIT_TESTCALLER(gnrc_netif_tests, set_up, NULL, fixtures);
@@ -0,0 +1,453 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/hdr.h"
+
+#include "tests-gnrc_tcp.h"
+
+#define LOCAL_PORT      (1234U)
+#define PEER_PORT       (80U)
+#define PEER_ISS        (1000U)
+#define PEER_WND        (4096U)
+#define PEER_MSS        (100U)
+#define OUT_NUMOF       (8U)
+
+#define TICKS(ms)       (((ms) * 1000U) / GNRC_TCP_TICK_US)
+
+/* a segment TCP sent */
+typedef struct {
+    uint32_t seq;
+    uint32_t ack;
+    uint16_t flags;
+    uint16_t mss;
+    size_t len;
+} _out_t;
+
+static const ipv6_addr_t _local = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+static const ipv6_addr_t _peer = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02
+    } };
+static uint8_t _data[4 * PEER_MSS];
+static _out_t _out[OUT_NUMOF];
+static unsigned _out_num;
+static gnrc_netreg_entry_cbd_t _cbd;
+static gnrc_netreg_entry_t _netreg;
+
+/* takes the place of IPv6 */
+static void _capture(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_pktsnip_t *tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    (void)cmd;
+    (void)ctx;
+    if ((tcp != NULL) && (_out_num < OUT_NUMOF)) {
+        tcp_hdr_t *hdr = tcp->data;
+        _out_t *out = &_out[_out_num];
+
+        out->seq = byteorder_ntohl(hdr->seq_num);
+        out->ack = byteorder_ntohl(hdr->ack_num);
+        out->flags = tcp_hdr_get_flags(hdr);
+        out->mss = 0;
+        if (tcp_hdr_get_len(hdr) > TCP_HDR_MIN_SIZE) {
+            uint8_t *opt = (uint8_t *)(hdr + 1);
+
+            out->mss = (opt[2] << 8) | opt[3];
+        }
+        out->len = (tcp->next != NULL) ? tcp->next->size : 0;
+    }
+    _out_num++;
+    gnrc_pktbuf_release(pkt);
+}
+
+/* passes a segment from the peer to TCP */
+static void _feed(uint16_t port, uint32_t seq, uint32_t ack, uint16_t flags,
+                  size_t len)
+{
+    size_t hdr_len = TCP_HDR_MIN_SIZE +
+                     ((flags & TCP_FLAG_SYN) ? TCP_OPTION_LENGTH_MSS : 0);
+    gnrc_pktsnip_t *ipv6, *tcp;
+    ipv6_hdr_t *ip;
+    tcp_hdr_t *hdr;
+
+    ipv6 = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    ip = ipv6->data;
+    memset(ip, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(ip);
+    ip->len = byteorder_htons(hdr_len + len);
+    ip->nh = PROTNUM_TCP;
+    ip->src = _peer;
+    ip->dst = _local;
+    tcp = gnrc_pktbuf_add(ipv6, NULL, hdr_len + len, GNRC_NETTYPE_TCP);
+    TEST_ASSERT_NOT_NULL(tcp);
+    hdr = tcp->data;
+    memset(hdr, 0, hdr_len);
+    memset((uint8_t *)hdr + hdr_len, 'x', len);
+    hdr->src_port = byteorder_htons(PEER_PORT);
+    hdr->dst_port = byteorder_htons(port);
+    hdr->seq_num = byteorder_htonl(seq);
+    hdr->ack_num = byteorder_htonl(ack);
+    hdr->window = byteorder_htons(PEER_WND);
+    if (flags & TCP_FLAG_SYN) {
+        uint8_t *opt = (uint8_t *)(hdr + 1);
+
+        opt[0] = TCP_OPTION_KIND_MSS;
+        opt[1] = TCP_OPTION_LENGTH_MSS;
+        opt[2] = PEER_MSS >> 8;
+        opt[3] = PEER_MSS & 0xff;
+    }
+    tcp_hdr_set_off_ctl(hdr, hdr_len, flags);
+    /* the segment is still in one piece, as IPv6 passes it up */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_calc_csum(tcp, ipv6));
+    gnrc_tcp_test_receive(tcp);
+}
+
+static void _tick(unsigned ticks)
+{
+    while (ticks--) {
+        gnrc_tcp_test_tick();
+    }
+}
+
+/* actively opens a connection to the peer */
+static void _establish(gnrc_tcp_tcb_t **tcb)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_open(tcb, &_local, LOCAL_PORT));
+    TEST_ASSERT_EQUAL_INT(-EINPROGRESS, gnrc_tcp_connect(*tcb, &_peer, PEER_PORT));
+    _feed(LOCAL_PORT, PEER_ISS, (*tcb)->iss + 1, TCP_FLAG_SYN | TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, (*tcb)->state);
+    _out_num = 0;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_tcp_test_reset();
+    _out_num = 0;
+    _cbd.cb = _capture;
+    gnrc_netreg_entry_init_cb(&_netreg, GNRC_NETREG_DEMUX_CTX_ALL, &_cbd);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_netreg);
+}
+
+static void tear_down(void)
+{
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &_netreg);
+}
+
+/* frees all connections and checks that nothing leaked */
+static void _reset(void)
+{
+    gnrc_tcp_test_reset();
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_gnrc_tcp__handshake_active(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_open(&tcb, &_local, LOCAL_PORT));
+    TEST_ASSERT_EQUAL_INT(-EINPROGRESS, gnrc_tcp_connect(tcb, &_peer, PEER_PORT));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_SYN_SENT, tcb->state);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_SYN, _out[0].flags);
+    TEST_ASSERT(tcb->iss == _out[0].seq);
+    TEST_ASSERT(_out[0].mss > 0);
+
+    _feed(LOCAL_PORT, PEER_ISS, tcb->iss + 1, TCP_FLAG_SYN | TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, tcb->mss);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_ACK, _out[1].flags);
+    TEST_ASSERT(tcb->iss + 1 == _out[1].seq);
+    TEST_ASSERT(PEER_ISS + 1 == _out[1].ack);
+    _reset();
+}
+
+static void test_gnrc_tcp__handshake_passive(void)
+{
+    gnrc_tcp_tcb_t *listener, *tcb = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_open(&listener, &_local, LOCAL_PORT));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_listen(listener, 1));
+
+    _feed(LOCAL_PORT, PEER_ISS, 0, TCP_FLAG_SYN, 0);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_SYN | TCP_FLAG_ACK, _out[0].flags);
+    TEST_ASSERT(PEER_ISS + 1 == _out[0].ack);
+    TEST_ASSERT(_out[0].mss > 0);
+    /* nothing to accept before the handshake is complete */
+    TEST_ASSERT_EQUAL_INT(-EINPROGRESS, gnrc_tcp_accept(listener, &tcb));
+
+    _feed(LOCAL_PORT, PEER_ISS + 1, _out[0].seq + 1, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_accept(listener, &tcb));
+    TEST_ASSERT_NOT_NULL(tcb);
+    TEST_ASSERT(tcb != listener);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, tcb->mss);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_LISTEN, listener->state);
+    _reset();
+}
+
+static void test_gnrc_tcp__close_simultaneous(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t fin;
+
+    _establish(&tcb);
+    fin = tcb->iss + 1;
+
+    gnrc_tcp_close(tcb);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_FIN_WAIT_1, tcb->state);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_FIN | TCP_FLAG_ACK, _out[0].flags);
+    TEST_ASSERT(fin == _out[0].seq);
+
+    /* the peer's FIN crossed ours */
+    _feed(LOCAL_PORT, PEER_ISS + 1, fin, TCP_FLAG_FIN | TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_CLOSING, tcb->state);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_ACK, _out[1].flags);
+    TEST_ASSERT(PEER_ISS + 2 == _out[1].ack);
+
+    _feed(LOCAL_PORT, PEER_ISS + 2, fin + 1, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_TIME_WAIT, tcb->state);
+    _tick(TICKS(GNRC_TCP_TIME_WAIT_MS) - 1);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_TIME_WAIT, tcb->state);
+    _tick(1);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_CLOSED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(0, tcb->local_port);
+    _reset();
+}
+
+static void test_gnrc_tcp__fin_wait_2_timeout(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t fin;
+
+    _establish(&tcb);
+    fin = tcb->iss + 1;
+
+    gnrc_tcp_close(tcb);
+    _feed(LOCAL_PORT, PEER_ISS + 1, fin + 1, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_FIN_WAIT_2, tcb->state);
+    /* the peer is gone and never sends its FIN */
+    _tick(TICKS(GNRC_TCP_FIN_WAIT_2_MS) - 1);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_FIN_WAIT_2, tcb->state);
+    _tick(1);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_CLOSED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(0, tcb->local_port);
+    _reset();
+}
+
+static void test_gnrc_tcp__rto_backoff(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t rto = TICKS(GNRC_TCP_RTO_INIT_MS);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_open(&tcb, &_local, LOCAL_PORT));
+    TEST_ASSERT_EQUAL_INT(-EINPROGRESS, gnrc_tcp_connect(tcb, &_peer, PEER_PORT));
+    TEST_ASSERT_EQUAL_INT(rto, tcb->rto);
+    for (unsigned i = 1; i <= 2; i++) {
+        _out_num = 0;
+        _tick(rto - 1);
+        TEST_ASSERT_EQUAL_INT(0, _out_num);
+        _tick(1);
+        TEST_ASSERT_EQUAL_INT(1, _out_num);
+        TEST_ASSERT_EQUAL_INT(TCP_FLAG_SYN, _out[0].flags);
+        TEST_ASSERT(tcb->iss == _out[0].seq);
+        rto *= 2;
+        TEST_ASSERT_EQUAL_INT(rto, tcb->rto);
+        TEST_ASSERT_EQUAL_INT(i, tcb->retries);
+    }
+
+    _feed(LOCAL_PORT, PEER_ISS, tcb->iss + 1, TCP_FLAG_SYN | TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, tcb->state);
+    /* Karn: the retransmitted SYN was not timed */
+    TEST_ASSERT_EQUAL_INT(rto, tcb->rto);
+    _out_num = 0;
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, gnrc_tcp_send(tcb, _data, PEER_MSS));
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, _out[0].len);
+    _tick(rto);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    TEST_ASSERT(_out[0].seq == _out[1].seq);
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, _out[1].len);
+    TEST_ASSERT_EQUAL_INT(2 * rto, tcb->rto);
+    /* RFC 5681, 3.1: back to slow start */
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, tcb->cwnd);
+    TEST_ASSERT_EQUAL_INT(2 * PEER_MSS, tcb->ssthresh);
+
+    _feed(LOCAL_PORT, PEER_ISS + 1, _out[1].seq + PEER_MSS, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(0, tcb->retries);
+    TEST_ASSERT(!tcb->rtx_timer.armed);
+    _reset();
+}
+
+static void test_gnrc_tcp__rto_give_up(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_tcp_open(&tcb, &_local, LOCAL_PORT));
+    TEST_ASSERT_EQUAL_INT(-EINPROGRESS, gnrc_tcp_connect(tcb, &_peer, PEER_PORT));
+    for (unsigned i = 0; i <= GNRC_TCP_MAX_RETRIES; i++) {
+        TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_SYN_SENT, tcb->state);
+        _tick(tcb->rto);
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_CLOSED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, tcb->error);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_MAX_RETRIES + 1, _out_num);
+    _reset();
+}
+
+static void test_gnrc_tcp__fast_retransmit(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t una;
+
+    _establish(&tcb);
+    una = tcb->iss + 1;
+
+    TEST_ASSERT_EQUAL_INT(4 * PEER_MSS, tcb->cwnd);
+    TEST_ASSERT_EQUAL_INT(sizeof(_data), gnrc_tcp_send(tcb, _data, sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(4, _out_num);
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT(una + (i * PEER_MSS) == _out[i].seq);
+    }
+
+    _out_num = 0;
+    for (unsigned i = 1; i < GNRC_TCP_DUPACK_THRESH; i++) {
+        _feed(LOCAL_PORT, PEER_ISS + 1, una, TCP_FLAG_ACK, 0);
+        TEST_ASSERT_EQUAL_INT(i, tcb->dupacks);
+        TEST_ASSERT_EQUAL_INT(0, _out_num);
+    }
+    _feed(LOCAL_PORT, PEER_ISS + 1, una, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT(una == _out[0].seq);
+    TEST_ASSERT_EQUAL_INT(PEER_MSS, _out[0].len);
+    TEST_ASSERT_EQUAL_INT(2 * PEER_MSS, tcb->ssthresh);
+    TEST_ASSERT_EQUAL_INT(tcb->ssthresh + (GNRC_TCP_DUPACK_THRESH * PEER_MSS),
+                          tcb->cwnd);
+    /* further duplicates inflate the window */
+    _feed(LOCAL_PORT, PEER_ISS + 1, una, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(tcb->ssthresh + ((GNRC_TCP_DUPACK_THRESH + 1) * PEER_MSS),
+                          tcb->cwnd);
+
+    /* full acknowledgement ends fast recovery */
+    _feed(LOCAL_PORT, PEER_ISS + 1, una + sizeof(_data), TCP_FLAG_ACK, 0);
+    TEST_ASSERT(una + sizeof(_data) == tcb->snd_una);
+    TEST_ASSERT_EQUAL_INT(0, tcb->dupacks);
+    TEST_ASSERT(tcb->cwnd <= tcb->ssthresh);
+    TEST_ASSERT(!tcb->rtx_timer.armed);
+    _reset();
+}
+
+static void test_gnrc_tcp__out_of_window(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t rcv_nxt;
+
+    _establish(&tcb);
+    rcv_nxt = tcb->rcv_nxt;
+
+    /* far beyond the window: only acknowledged */
+    _feed(LOCAL_PORT, PEER_ISS + 100000U, tcb->iss + 1, TCP_FLAG_ACK, 10);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_ACK, _out[0].flags);
+    TEST_ASSERT(rcv_nxt == _out[0].ack);
+    /* out of order: duplicate ACK */
+    _feed(LOCAL_PORT, PEER_ISS + 11, tcb->iss + 1, TCP_FLAG_ACK, 10);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    TEST_ASSERT(rcv_nxt == _out[1].ack);
+    /* in order */
+    _feed(LOCAL_PORT, PEER_ISS + 1, tcb->iss + 1, TCP_FLAG_ACK, 10);
+    TEST_ASSERT(rcv_nxt + 10 == tcb->rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, tcb->state);
+    _reset();
+}
+
+static void test_gnrc_tcp__rst(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    _establish(&tcb);
+
+    /* a reset out of the window is ignored */
+    _feed(LOCAL_PORT, PEER_ISS + 100000U, 0, TCP_FLAG_RST, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_ESTABLISHED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(0, _out_num);
+
+    _feed(LOCAL_PORT, PEER_ISS + 1, 0, TCP_FLAG_RST, 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_STATE_CLOSED, tcb->state);
+    TEST_ASSERT_EQUAL_INT(-ECONNRESET, tcb->error);
+    TEST_ASSERT_EQUAL_INT(0, _out_num);
+    TEST_ASSERT_EQUAL_INT(-ECONNRESET, gnrc_tcp_send(tcb, _data, 1));
+    _reset();
+}
+
+static void test_gnrc_tcp__rst_no_connection(void)
+{
+    _feed(LOCAL_PORT + 1, PEER_ISS, 0, TCP_FLAG_SYN, 0);
+    TEST_ASSERT_EQUAL_INT(1, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_RST | TCP_FLAG_ACK, _out[0].flags);
+    TEST_ASSERT(PEER_ISS + 1 == _out[0].ack);
+
+    _feed(LOCAL_PORT + 1, PEER_ISS, 5000, TCP_FLAG_ACK, 0);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    TEST_ASSERT_EQUAL_INT(TCP_FLAG_RST, _out[1].flags);
+    TEST_ASSERT_EQUAL_INT(5000, _out[1].seq);
+
+    /* never answer a reset */
+    _feed(LOCAL_PORT + 1, PEER_ISS, 0, TCP_FLAG_RST, 0);
+    TEST_ASSERT_EQUAL_INT(2, _out_num);
+    _reset();
+}
+
+Test *tests_gnrc_tcp_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp__handshake_active),
+        new_TestFixture(test_gnrc_tcp__handshake_passive),
+        new_TestFixture(test_gnrc_tcp__close_simultaneous),
+        new_TestFixture(test_gnrc_tcp__fin_wait_2_timeout),
+        new_TestFixture(test_gnrc_tcp__rto_backoff),
+        new_TestFixture(test_gnrc_tcp__rto_give_up),
+        new_TestFixture(test_gnrc_tcp__fast_retransmit),
+        new_TestFixture(test_gnrc_tcp__out_of_window),
+        new_TestFixture(test_gnrc_tcp__rst),
+        new_TestFixture(test_gnrc_tcp__rst_no_connection),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_tests;
+}
+
+void tests_gnrc_tcp(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_tests());
+}
+/** @} */
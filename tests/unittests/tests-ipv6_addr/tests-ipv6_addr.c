@@ -16,6 +16,7 @@
 
 #include "embUnit/embUnit.h"
 
+#include "bitarithm.h"
 #include "byteorder.h"
 #include "net/ipv6/addr.h"
 
@@ -574,6 +575,155 @@ static void test_ipv6_addr_init_prefix(void)
     TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&a, &c));
 }
 
+static void test_ipv6_addr_init_prefix_64(void)
+{
+    ipv6_addr_t a = { {
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+    ipv6_addr_t b = { {
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+        }
+    };
+    ipv6_addr_t c =  { {
+            0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+
+    ipv6_addr_init_prefix(&c, &b, 64);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&a, &c));
+}
+
+static void test_ipv6_addr_init_prefix_100(void)
+{
+    ipv6_addr_t a = { {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0a, 0x0b, 0xc0, 0xf0, 0xf0, 0xf0
+        }
+    };
+    ipv6_addr_t b = { {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0a, 0x0b, 0xcc, 0xcc, 0xcc, 0xcc
+        }
+    };
+    ipv6_addr_t c =  { {
+            0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+            0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0
+        }
+    };
+
+    ipv6_addr_init_prefix(&c, &b, 100);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&a, &c));
+}
+
+static void test_ipv6_addr_init_mask(void)
+{
+    ipv6_addr_t a = { {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00
+        }
+    };
+    ipv6_addr_t mask;
+
+    ipv6_addr_init_mask(&mask, 100);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&a, &mask));
+    ipv6_addr_init_mask(&mask, 0);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_is_unspecified(&mask));
+    ipv6_addr_init_mask(&mask, 200);
+    TEST_ASSERT_EQUAL_INT(0, ipv6_addr_match_prefix(&mask, &ipv6_addr_unspecified));
+    TEST_ASSERT_EQUAL_INT(128, bitarithm_bits_set(mask.u32[0].u32) +
+                          bitarithm_bits_set(mask.u32[1].u32) +
+                          bitarithm_bits_set(mask.u32[2].u32) +
+                          bitarithm_bits_set(mask.u32[3].u32));
+}
+
+static void test_ipv6_addr_init_mask__static(void)
+{
+    static const ipv6_addr_t mask_0 = IPV6_ADDR_MASK(0);
+    static const ipv6_addr_t mask_3 = IPV6_ADDR_MASK(3);
+    static const ipv6_addr_t mask_64 = IPV6_ADDR_MASK(64);
+    static const ipv6_addr_t mask_127 = IPV6_ADDR_MASK(127);
+    static const ipv6_addr_t mask_128 = IPV6_ADDR_MASK(128);
+    ipv6_addr_t mask;
+
+    ipv6_addr_init_mask(&mask, 0);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&mask_0, &mask));
+    ipv6_addr_init_mask(&mask, 3);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&mask_3, &mask));
+    ipv6_addr_init_mask(&mask, 64);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&mask_64, &mask));
+    ipv6_addr_init_mask(&mask, 127);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&mask_127, &mask));
+    ipv6_addr_init_mask(&mask, 128);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&mask_128, &mask));
+}
+
+static void test_ipv6_addr_match_mask(void)
+{
+    static const ipv6_addr_t mask_64 = IPV6_ADDR_MASK(64);
+    ipv6_addr_t a = { {
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+    ipv6_addr_t b = a;
+
+    b.u8[15] = 0xff;
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_match_mask(&a, &b, &mask_64));
+    b.u8[7] = 0x00;
+    TEST_ASSERT_EQUAL_INT(false, ipv6_addr_match_mask(&a, &b, &mask_64));
+}
+
+static void test_ipv6_addr_init_prefix_mask(void)
+{
+    static const ipv6_addr_t mask_31 = IPV6_ADDR_MASK(31);
+    ipv6_addr_t a = { {
+            0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+    ipv6_addr_t b = { {
+            0x00, 0x01, 0x02, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        }
+    };
+    ipv6_addr_t c =  { {
+            0xff, 0xfe, 0xfd, 0xfe, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+
+    ipv6_addr_init_prefix_mask(&c, &b, &mask_31);
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(&a, &c));
+}
+
+static void test_ipv6_addr_match_prefix__all_lengths(void)
+{
+    ipv6_addr_t a = { {
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        }
+    };
+
+    for (unsigned i = 0; i < 128; i++) {
+        ipv6_addr_t b = a;
+        ipv6_addr_t mask;
+
+        /* flip bit i and the least significant one */
+        b.u8[i / 8] ^= 0x80 >> (i % 8);
+        if (i < 127) {
+            b.u8[15] ^= 0x01;
+        }
+        TEST_ASSERT_EQUAL_INT(i, ipv6_addr_match_prefix(&a, &b));
+        ipv6_addr_init_mask(&mask, i);
+        TEST_ASSERT_EQUAL_INT(true, ipv6_addr_match_mask(&a, &b, &mask));
+        ipv6_addr_init_mask(&mask, i + 1);
+        TEST_ASSERT_EQUAL_INT(false, ipv6_addr_match_mask(&a, &b, &mask));
+    }
+}
+
 static void test_ipv6_addr_init_iid(void)
 {
     ipv6_addr_t a = { {
@@ -1062,6 +1212,13 @@ Test *tests_ipv6_addr_tests(void)
         new_TestFixture(test_ipv6_addr_match_prefix_match_128),
         new_TestFixture(test_ipv6_addr_match_prefix_same_pointer),
         new_TestFixture(test_ipv6_addr_init_prefix),
+        new_TestFixture(test_ipv6_addr_init_prefix_64),
+        new_TestFixture(test_ipv6_addr_init_prefix_100),
+        new_TestFixture(test_ipv6_addr_init_mask),
+        new_TestFixture(test_ipv6_addr_init_mask__static),
+        new_TestFixture(test_ipv6_addr_match_mask),
+        new_TestFixture(test_ipv6_addr_init_prefix_mask),
+        new_TestFixture(test_ipv6_addr_match_prefix__all_lengths),
         new_TestFixture(test_ipv6_addr_init_iid),
         new_TestFixture(test_ipv6_addr_set_unspecified),
         new_TestFixture(test_ipv6_addr_set_loopback),
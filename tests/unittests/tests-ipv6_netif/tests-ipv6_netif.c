@@ -476,6 +476,94 @@ static void test_ipv6_netif_find_best_src_addr__other_subnet(void)
     TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &addr1));
 }
 
+static void test_ipv6_netif_find_best_src_addr__added_addr(void)
+{
+    ipv6_addr_t ll_addr = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t addr1 = DEFAULT_TEST_IPV6_ADDR;
+    ipv6_addr_t addr2 = DEFAULT_TEST_IPV6_PREFIX64;
+    ipv6_addr_t *out = NULL;
+
+    ll_addr.u8[15] = 1;
+    ipv6_addr_set_link_local_prefix(&ll_addr);
+
+    test_ipv6_netif_add__success(); /* adds DEFAULT_TEST_NETIF as interface */
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_netif_add_addr(DEFAULT_TEST_NETIF, &ll_addr, 64, 0));
+
+    TEST_ASSERT_NOT_NULL((out = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &ll_addr));
+
+    /* a later added address with a better match must not be hidden by the cache */
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_netif_add_addr(DEFAULT_TEST_NETIF, &addr1, 64, 0));
+    TEST_ASSERT_NOT_NULL((out = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &addr1));
+}
+
+static void test_ipv6_netif_find_best_src_addr__removed_addr(void)
+{
+    ipv6_addr_t ll_addr = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t addr1 = DEFAULT_TEST_IPV6_ADDR;
+    ipv6_addr_t addr2 = DEFAULT_TEST_IPV6_PREFIX64;
+    ipv6_addr_t *out = NULL;
+
+    /* Adds DEFAULT_TEST_NETIF as interface and to it fe80::1 and addr1 */
+    test_ipv6_netif_find_best_src_addr__added_addr();
+
+    /* a removed address must not be returned from the cache */
+    gnrc_ipv6_netif_remove_addr(DEFAULT_TEST_NETIF, &addr1);
+    ll_addr.u8[15] = 1;
+    ipv6_addr_set_link_local_prefix(&ll_addr);
+    TEST_ASSERT_NOT_NULL((out = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &ll_addr));
+
+    gnrc_ipv6_netif_reset_addr(DEFAULT_TEST_NETIF);
+    TEST_ASSERT_NULL(gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false));
+}
+
+static void test_ipv6_netif_find_best_src_addr__ll_only(void)
+{
+    ipv6_addr_t ll_addr = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t addr2 = DEFAULT_TEST_IPV6_PREFIX64;
+    ipv6_addr_t *out = NULL;
+
+    /* Adds DEFAULT_TEST_NETIF as interface and to it fe80::1 and addr1 */
+    test_ipv6_netif_find_best_src_addr__added_addr();
+
+    /* ll_only is part of the key of a cached result */
+    ll_addr.u8[15] = 1;
+    ipv6_addr_set_link_local_prefix(&ll_addr);
+    TEST_ASSERT_NOT_NULL((out = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, true)));
+    TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &ll_addr));
+}
+
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+static void test_ipv6_netif_find_best_src_addr__cache_hit(void)
+{
+    ipv6_addr_t addr1 = DEFAULT_TEST_IPV6_ADDR;
+    ipv6_addr_t addr2 = DEFAULT_TEST_IPV6_PREFIX64;
+    gnrc_ipv6_netif_t *iface;
+    ipv6_addr_t *out1 = NULL, *out2 = NULL;
+
+    test_ipv6_netif_add__success(); /* adds DEFAULT_TEST_NETIF as interface */
+    TEST_ASSERT_NOT_NULL((iface = gnrc_ipv6_netif_get(DEFAULT_TEST_NETIF)));
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_netif_add_addr(DEFAULT_TEST_NETIF, &addr1, 64, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, iface->src_cache_hits);
+    TEST_ASSERT_NOT_NULL((out1 = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(0, iface->src_cache_hits);
+    TEST_ASSERT_EQUAL_INT(1, iface->src_cache_misses);
+    TEST_ASSERT_NOT_NULL((out2 = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(1, iface->src_cache_hits);
+    TEST_ASSERT_EQUAL_INT(1, iface->src_cache_misses);
+    TEST_ASSERT(out1 == out2);
+
+    gnrc_ipv6_netif_src_cache_flush(DEFAULT_TEST_NETIF);
+    TEST_ASSERT_NOT_NULL((out2 = gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &addr2, false)));
+    TEST_ASSERT_EQUAL_INT(1, iface->src_cache_hits);
+    TEST_ASSERT_EQUAL_INT(2, iface->src_cache_misses);
+    TEST_ASSERT(out1 == out2);
+}
+#endif
+
 static void test_ipv6_netif_addr_is_non_unicast__unicast(void)
 {
     ipv6_addr_t addr = DEFAULT_TEST_IPV6_ADDR;
@@ -565,6 +653,12 @@ Test *tests_ipv6_netif_tests(void)
         new_TestFixture(test_ipv6_netif_find_best_src_addr__success),
         new_TestFixture(test_ipv6_netif_find_best_src_addr__multicast_input),
         new_TestFixture(test_ipv6_netif_find_best_src_addr__other_subnet),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__added_addr),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__removed_addr),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__ll_only),
+#if GNRC_IPV6_NETIF_SRC_CACHE_SIZE > 0
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__cache_hit),
+#endif
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__unicast),
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__anycast),
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__multicast1),
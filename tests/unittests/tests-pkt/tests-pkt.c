@@ -22,8 +22,9 @@
 #include "unittests-constants.h"
 #include "tests-pkt.h"
 
-#define _INIT_ELEM(len, data, next) \
-    { 1, (next), (data), (len), GNRC_NETTYPE_UNDEF }
+#define _INIT_ELEM(len, _data, _next) \
+    { .users = 1, .next = (_next), .data = (_data), .size = (len), \
+      .type = GNRC_NETTYPE_UNDEF }
 #define _INIT_ELEM_STATIC_DATA(data, next) _INIT_ELEM(sizeof(data), data, next)
 
 static void test_pkt_len__NULL(void)
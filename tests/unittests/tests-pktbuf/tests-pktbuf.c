@@ -14,6 +14,7 @@
  */
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/uio.h>
 
 #include "embUnit.h"
@@ -238,6 +239,142 @@ static void test_pktbuf_add__unaligned_in_aligned_hole(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_add_headroom__prepend_in_headroom(void)
+{
+    gnrc_pktsnip_t *hdr, *pkt = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                                         sizeof(TEST_STRING16),
+                                                         GNRC_PKTBUF_HEADROOM,
+                                                         GNRC_NETTYPE_UNDEF);
+    size_t headroom;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+    TEST_ASSERT(pkt->headroom >= GNRC_PKTBUF_HEADROOM);
+    headroom = pkt->headroom;
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_add(pkt, TEST_STRING8, sizeof(TEST_STRING8),
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(hdr->next == pkt);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING8, hdr->data);
+    /* header lies directly in front of pkt and took the rest of the headroom */
+    TEST_ASSERT(((uint8_t *)hdr->data) + sizeof(TEST_STRING8) <= (uint8_t *)pkt);
+    TEST_ASSERT((uint8_t *)hdr > ((uint8_t *)pkt) - headroom);
+    TEST_ASSERT_EQUAL_INT(0, pkt->headroom);
+    TEST_ASSERT(hdr->headroom < headroom);
+    gnrc_pktbuf_release(hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_headroom__headroom_too_small(void)
+{
+    gnrc_pktsnip_t *hdr, *pkt = gnrc_pktbuf_add_headroom(NULL, TEST_STRING4,
+                                                         sizeof(TEST_STRING4), 1,
+                                                         GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_add(pkt, TEST_STRING16, sizeof(TEST_STRING16),
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(hdr->next == pkt);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, hdr->data);
+    TEST_ASSERT(pkt->headroom > 0);
+    TEST_ASSERT_EQUAL_INT(0, hdr->headroom);
+    gnrc_pktbuf_release(hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_headroom__next_shared(void)
+{
+    gnrc_pktsnip_t *hdr, *pkt = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                                         sizeof(TEST_STRING16),
+                                                         GNRC_PKTBUF_HEADROOM,
+                                                         GNRC_NETTYPE_UNDEF);
+    size_t headroom;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    headroom = pkt->headroom;
+    gnrc_pktbuf_hold(pkt, 1);
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_add(pkt, TEST_STRING8, sizeof(TEST_STRING8),
+                                                GNRC_NETTYPE_TEST)));
+    /* the other user may prepend to pkt, too, so its headroom is left alone */
+    TEST_ASSERT_EQUAL_INT(headroom, pkt->headroom);
+    TEST_ASSERT_EQUAL_INT(0, hdr->headroom);
+    gnrc_pktbuf_release(hdr);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_slice__src_NULL(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_slice(NULL, NULL, 0, 4, GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_slice__size_0(void)
+{
+    gnrc_pktsnip_t *src = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_slice(NULL, src, 0, 0, GNRC_NETTYPE_TEST));
+    TEST_ASSERT_EQUAL_INT(1, src->users);
+    gnrc_pktbuf_release(src);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_slice__exceeds_src(void)
+{
+    gnrc_pktsnip_t *src = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_slice(NULL, src, 4, sizeof(TEST_STRING16) - 3,
+                                           GNRC_NETTYPE_TEST));
+    TEST_ASSERT_EQUAL_INT(1, src->users);
+    gnrc_pktbuf_release(src);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_slice__success(void)
+{
+    gnrc_pktsnip_t *slice, *src = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                                  sizeof(TEST_STRING16),
+                                                  GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *next = gnrc_pktbuf_add(NULL, TEST_STRING4, sizeof(TEST_STRING4),
+                                           GNRC_NETTYPE_UNDEF);
+
+    src = gnrc_pktbuf_add(src, TEST_STRING8, sizeof(TEST_STRING8), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL((slice = gnrc_pktbuf_add_slice(next, src, 4, 3, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(slice->next == next);
+    TEST_ASSERT(slice->data == ((uint8_t *)src->data) + 4);
+    TEST_ASSERT_EQUAL_INT(3, slice->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_TEST, slice->type);
+    TEST_ASSERT_EQUAL_INT(1, slice->users);
+    TEST_ASSERT_EQUAL_INT(2, src->users);
+    TEST_ASSERT_EQUAL_INT(1, src->next->users);
+    /* data stays until slice is released */
+    gnrc_pktbuf_release(src);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(slice->data, TEST_STRING8 + 4, 3));
+    gnrc_pktbuf_release(slice);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_slice__of_slice(void)
+{
+    gnrc_pktsnip_t *slice1, *slice2, *src = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                                            sizeof(TEST_STRING16),
+                                                            GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL((slice1 = gnrc_pktbuf_add_slice(NULL, src, 2, 8, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((slice2 = gnrc_pktbuf_add_slice(NULL, slice1, 2, 4,
+                                                         GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(slice2->data == ((uint8_t *)src->data) + 4);
+    TEST_ASSERT_EQUAL_INT(1, slice1->users);
+    TEST_ASSERT_EQUAL_INT(3, src->users);
+    gnrc_pktbuf_release(slice1);
+    gnrc_pktbuf_release(src);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(slice2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_mark__pkt_NULL__size_0(void)
 {
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(NULL, 0, GNRC_NETTYPE_TEST));
@@ -281,7 +418,8 @@ static void test_pktbuf_mark__pkt_NOT_NULL__size_greater_than_pkt_size(void)
 
 static void test_pktbuf_mark__pkt_NOT_NULL__pkt_data_NULL(void)
 {
-    gnrc_pktsnip_t pkt = { 1, NULL, NULL, sizeof(TEST_STRING16), GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .users = 1, .size = sizeof(TEST_STRING16),
+                           .type = GNRC_NETTYPE_TEST };
 
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(&pkt, sizeof(TEST_STRING16) - 1,
                                       GNRC_NETTYPE_TEST));
@@ -567,7 +705,8 @@ static void test_pktbuf_hold__pkt_null(void)
 
 static void test_pktbuf_hold__pkt_external(void)
 {
-    gnrc_pktsnip_t pkt = { 1, NULL, TEST_STRING8, sizeof(TEST_STRING8), GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .users = 1, .data = TEST_STRING8, .size = sizeof(TEST_STRING8),
+                           .type = GNRC_NETTYPE_TEST };
 
     gnrc_pktbuf_hold(&pkt, 1);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
@@ -671,6 +810,26 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_start_write__slice(void)
+{
+    gnrc_pktsnip_t *pkt_copy, *slice, *src = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                                             sizeof(TEST_STRING16),
+                                                             GNRC_NETTYPE_TEST);
+
+    slice = gnrc_pktbuf_add_slice(NULL, src, 0, sizeof(TEST_STRING16), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(slice);
+    TEST_ASSERT_NOT_NULL((pkt_copy = gnrc_pktbuf_start_write(slice)));
+    TEST_ASSERT(pkt_copy != slice);
+    TEST_ASSERT(pkt_copy->data != src->data);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt_copy->data);
+    /* slice was released with the copy */
+    TEST_ASSERT_EQUAL_INT(1, src->users);
+
+    gnrc_pktbuf_release(pkt_copy);
+    gnrc_pktbuf_release(src);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_get_iovec__1_elem(void)
 {
     struct iovec *vec;
@@ -713,6 +872,29 @@ static void test_pktbuf_get_iovec__3_elem(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_get_iovec__headroom(void)
+{
+    struct iovec *vec;
+    size_t len;
+    gnrc_pktsnip_t *snip = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                                    sizeof(TEST_STRING16),
+                                                    GNRC_PKTBUF_HEADROOM,
+                                                    GNRC_NETTYPE_UNDEF);
+    snip = gnrc_pktbuf_add(snip, TEST_STRING8, sizeof(TEST_STRING8), GNRC_NETTYPE_UNDEF);
+    snip = gnrc_pktbuf_get_iovec(snip, &len);
+    vec = (struct iovec *)snip->data;
+
+    TEST_ASSERT_EQUAL_INT(2, len);
+    TEST_ASSERT(snip->next->data == vec[0].iov_base);
+    TEST_ASSERT(snip->next->next->data == vec[1].iov_base);
+    /* I/O vector was taken from the headroom, too */
+    TEST_ASSERT((uint8_t *)snip < (uint8_t *)snip->next);
+    TEST_ASSERT_EQUAL_INT(0, snip->next->headroom);
+
+    gnrc_pktbuf_release(snip);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_get_iovec__null(void)
 {
     gnrc_pktsnip_t *res;
@@ -739,6 +921,14 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__success),
         new_TestFixture(test_pktbuf_add__packed_struct),
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
+        new_TestFixture(test_pktbuf_add_headroom__prepend_in_headroom),
+        new_TestFixture(test_pktbuf_add_headroom__headroom_too_small),
+        new_TestFixture(test_pktbuf_add_headroom__next_shared),
+        new_TestFixture(test_pktbuf_add_slice__src_NULL),
+        new_TestFixture(test_pktbuf_add_slice__size_0),
+        new_TestFixture(test_pktbuf_add_slice__exceeds_src),
+        new_TestFixture(test_pktbuf_add_slice__success),
+        new_TestFixture(test_pktbuf_add_slice__of_slice),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_0),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_not_0),
         new_TestFixture(test_pktbuf_mark__pkt_NOT_NULL__size_0),
@@ -764,8 +954,10 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
+        new_TestFixture(test_pktbuf_start_write__slice),
         new_TestFixture(test_pktbuf_get_iovec__1_elem),
         new_TestFixture(test_pktbuf_get_iovec__3_elem),
+        new_TestFixture(test_pktbuf_get_iovec__headroom),
         new_TestFixture(test_pktbuf_get_iovec__null),
     };
 
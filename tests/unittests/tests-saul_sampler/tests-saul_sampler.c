@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "saul_sampler.h"
+#include "tests-saul_sampler.h"
+
+#define TEST_RING_SIZE      (4U)
+#define TEST_INTERVAL_FAST  (10U * MS_IN_USEC)
+#define TEST_INTERVAL_SLOW  (10U * SEC_IN_USEC)
+
+static int16_t counter;
+static unsigned passes;
+
+static int _read_counter(void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = counter++;
+    res->unit = UNIT_NONE;
+    res->scale = 0;
+    return 1;
+}
+
+static int _read_axes(void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = 1;
+    res->val[1] = 2;
+    res->val[2] = 3;
+    res->unit = UNIT_G;
+    res->scale = -3;
+    return 3;
+}
+
+static int _read_broken(void *dev, phydat_t *res)
+{
+    (void)dev;
+    (void)res;
+    return -ECANCELED;
+}
+
+static const saul_driver_t counter_dri = { _read_counter, NULL, SAUL_SENSE_ANY };
+static const saul_driver_t axes_dri = { _read_axes, NULL, SAUL_SENSE_ACCEL };
+static const saul_driver_t broken_dri = { _read_broken, NULL, SAUL_SENSE_TEMP };
+
+static saul_reg_t counter_dev = { NULL, NULL, "counter", &counter_dri };
+static saul_reg_t axes_dev = { NULL, NULL, "axes", &axes_dri };
+static saul_reg_t broken_dev = { NULL, NULL, "broken", &broken_dri };
+
+static event_queue_t queue;
+static saul_sampler_entry_t entries[2];
+static saul_sampler_rec_t ring[TEST_RING_SIZE];
+static saul_sampler_t sampler;
+
+static void _cb(saul_sampler_t *s, void *arg)
+{
+    (void)s;
+    (void)arg;
+    passes++;
+}
+
+static void _stop_cb(saul_sampler_t *s, void *arg)
+{
+    (void)arg;
+    passes++;
+    saul_sampler_stop(s);
+}
+
+static void set_up(void)
+{
+    counter = 0;
+    passes = 0;
+    event_queue_init(&queue);
+    entries[0].dev = &counter_dev;
+    entries[0].interval = TEST_INTERVAL_FAST;
+    entries[1].dev = &axes_dev;
+    entries[1].interval = TEST_INTERVAL_SLOW;
+    saul_sampler_init(&sampler, entries, 2, ring, TEST_RING_SIZE, _cb, NULL);
+}
+
+static void tear_down(void)
+{
+    saul_sampler_stop(&sampler);
+}
+
+/* runs the first pass, which samples all entries */
+static void _first_pass(void)
+{
+    event_t *ev;
+
+    saul_sampler_start(&sampler, &queue);
+    ev = event_get(&queue);
+    TEST_ASSERT(ev == &sampler.event);
+    ev->handler(ev);
+}
+
+static void test_saul_sampler_start(void)
+{
+    saul_sampler_rec_t rec;
+
+    _first_pass();
+    TEST_ASSERT_EQUAL_INT(1, passes);
+    TEST_ASSERT_EQUAL_INT(2, saul_sampler_avail(&sampler));
+    TEST_ASSERT_EQUAL_INT(1, saul_sampler_read(&sampler, &rec));
+    TEST_ASSERT_EQUAL_INT(0, rec.entry);
+    TEST_ASSERT_EQUAL_INT(1, rec.dim);
+    TEST_ASSERT_EQUAL_INT(0, rec.data.val[0]);
+    TEST_ASSERT_EQUAL_INT(1, saul_sampler_read(&sampler, &rec));
+    TEST_ASSERT_EQUAL_INT(1, rec.entry);
+    TEST_ASSERT_EQUAL_INT(3, rec.dim);
+    TEST_ASSERT_EQUAL_INT(1, rec.data.val[0]);
+    TEST_ASSERT_EQUAL_INT(2, rec.data.val[1]);
+    TEST_ASSERT_EQUAL_INT(3, rec.data.val[2]);
+    TEST_ASSERT_EQUAL_INT(UNIT_G, rec.data.unit);
+    TEST_ASSERT_EQUAL_INT(-3, rec.data.scale);
+    TEST_ASSERT_EQUAL_INT(0, saul_sampler_read(&sampler, &rec));
+    TEST_ASSERT_EQUAL_INT(0, sampler.dropped);
+    TEST_ASSERT_EQUAL_INT(0, sampler.errors);
+}
+
+static void test_saul_sampler_interval(void)
+{
+    saul_sampler_rec_t rec;
+    event_t *ev;
+
+    _first_pass();
+    /* only the fast entry is due on the next timeout */
+    ev = event_wait(&queue);
+    TEST_ASSERT(ev == &sampler.event);
+    ev->handler(ev);
+    TEST_ASSERT_EQUAL_INT(2, passes);
+    TEST_ASSERT_EQUAL_INT(3, saul_sampler_avail(&sampler));
+    saul_sampler_read(&sampler, &rec);
+    saul_sampler_read(&sampler, &rec);
+    TEST_ASSERT_EQUAL_INT(1, saul_sampler_read(&sampler, &rec));
+    TEST_ASSERT_EQUAL_INT(0, rec.entry);
+    TEST_ASSERT_EQUAL_INT(1, rec.data.val[0]);
+}
+
+static void test_saul_sampler_overflow(void)
+{
+    saul_sampler_rec_t rec;
+
+    entries[1].interval = 0;
+    for (unsigned i = 0; i < (TEST_RING_SIZE + 2); i++) {
+        _first_pass();
+        saul_sampler_stop(&sampler);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE, saul_sampler_avail(&sampler));
+    TEST_ASSERT_EQUAL_INT(2, sampler.dropped);
+    /* the oldest records were overwritten */
+    for (unsigned i = 0; i < TEST_RING_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(1, saul_sampler_read(&sampler, &rec));
+        TEST_ASSERT_EQUAL_INT(i + 2, rec.data.val[0]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, saul_sampler_read(&sampler, &rec));
+}
+
+static void test_saul_sampler_errors(void)
+{
+    saul_sampler_rec_t rec;
+
+    entries[0].dev = &broken_dev;
+    entries[1].dev = NULL;
+    _first_pass();
+    TEST_ASSERT_EQUAL_INT(1, sampler.errors);
+    TEST_ASSERT_EQUAL_INT(0, saul_sampler_read(&sampler, &rec));
+}
+
+static void test_saul_sampler_stop_from_cb(void)
+{
+    sampler.cb = _stop_cb;
+    _first_pass();
+    TEST_ASSERT_EQUAL_INT(1, passes);
+    TEST_ASSERT_NULL(sampler.queue);
+    /* neither posted again nor woken up by the timer of the fast entry */
+    xtimer_usleep(2 * TEST_INTERVAL_FAST);
+    TEST_ASSERT_NULL(event_get(&queue));
+    TEST_ASSERT_EQUAL_INT(1, passes);
+}
+
+Test *tests_saul_sampler_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_saul_sampler_start),
+        new_TestFixture(test_saul_sampler_interval),
+        new_TestFixture(test_saul_sampler_overflow),
+        new_TestFixture(test_saul_sampler_errors),
+        new_TestFixture(test_saul_sampler_stop_from_cb),
+    };
+
+    EMB_UNIT_TESTCALLER(saul_sampler_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&saul_sampler_tests;
+}
+
+void tests_saul_sampler(void)
+{
+    TESTS_RUN(tests_saul_sampler_tests());
+}
+/** @} */
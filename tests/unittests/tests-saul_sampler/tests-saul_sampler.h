@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``saul_sampler`` module
+ */
+#ifndef TESTS_SAUL_SAMPLER_H_
+#define TESTS_SAUL_SAMPLER_H_
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_saul_sampler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_SAUL_SAMPLER_H_ */
+/** @} */
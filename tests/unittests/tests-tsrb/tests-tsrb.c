@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2016 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "tsrb.h"
+#include "tests-tsrb.h"
+
+#define TEST_BUF_SIZE   (8U)
+
+static char buf[TEST_BUF_SIZE];
+static tsrb_t rb;
+
+static void set_up(void)
+{
+    tsrb_init(&rb, buf, sizeof(buf));
+}
+
+/* moves the counters to the middle of the buffer */
+static void _offset(unsigned n)
+{
+    char tmp[TEST_BUF_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(n, tsrb_add(&rb, "01234567", n));
+    TEST_ASSERT_EQUAL_INT(n, tsrb_get(&rb, tmp, n));
+}
+
+static void test_tsrb_add_get__wrap(void)
+{
+    char out[TEST_BUF_SIZE + 1];
+
+    _offset(5);
+    TEST_ASSERT_EQUAL_INT(TEST_BUF_SIZE, tsrb_add(&rb, "abcdefghi", 9));
+    TEST_ASSERT(tsrb_full(&rb));
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_add_one(&rb, 'x'));
+    TEST_ASSERT_EQUAL_INT(3, tsrb_get(&rb, out, 3));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(TEST_BUF_SIZE - 3, tsrb_get(&rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "defgh", TEST_BUF_SIZE - 3));
+    TEST_ASSERT(tsrb_empty(&rb));
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_get_one(&rb));
+}
+
+static void test_tsrb_peek(void)
+{
+    char out[TEST_BUF_SIZE];
+
+    _offset(6);
+    TEST_ASSERT_EQUAL_INT(4, tsrb_add(&rb, "wxyz", 4));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_peek(&rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "wxyz", 4));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_avail(&rb));
+    TEST_ASSERT_EQUAL_INT('w', tsrb_get_one(&rb));
+}
+
+static void test_tsrb_read_span(void)
+{
+    char *data;
+
+    _offset(6);
+    tsrb_add(&rb, "wxyz", 4);
+    /* the span ends at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(2, tsrb_read_span(&rb, &data));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, "wx", 2));
+    tsrb_read_commit(&rb, 2);
+    TEST_ASSERT_EQUAL_INT(2, tsrb_read_span(&rb, &data));
+    TEST_ASSERT(data == buf);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, "yz", 2));
+    tsrb_read_commit(&rb, 2);
+    TEST_ASSERT_EQUAL_INT(0, tsrb_read_span(&rb, &data));
+}
+
+static void test_tsrb_write_span(void)
+{
+    char out[TEST_BUF_SIZE];
+    char *data;
+
+    _offset(3);
+    TEST_ASSERT_EQUAL_INT(TEST_BUF_SIZE - 3, tsrb_write_span(&rb, &data));
+    TEST_ASSERT(data == &buf[3]);
+    memcpy(data, "abcde", 5);
+    tsrb_write_commit(&rb, 5);
+    TEST_ASSERT_EQUAL_INT(3, tsrb_write_span(&rb, &data));
+    TEST_ASSERT(data == buf);
+    memcpy(data, "f", 1);
+    tsrb_write_commit(&rb, 1);
+    TEST_ASSERT_EQUAL_INT(6, tsrb_get(&rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "abcdef", 6));
+}
+
+Test *tests_tsrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tsrb_add_get__wrap),
+        new_TestFixture(test_tsrb_peek),
+        new_TestFixture(test_tsrb_read_span),
+        new_TestFixture(test_tsrb_write_span),
+    };
+
+    EMB_UNIT_TESTCALLER(tsrb_tests, set_up, NULL, fixtures);
+
+    return (Test *)&tsrb_tests;
+}
+
+void tests_tsrb(void)
+{
+    TESTS_RUN(tests_tsrb_tests());
+}
+/** @} */